@@ -1112,10 +1112,34 @@
 #define Z_CLEARANCE_DEPLOY_PROBE   5 // <-- changed:  Z Clearance for Deploy/Stow
 #define Z_CLEARANCE_BETWEEN_PROBES  5 // Z Clearance between probe points
 #define Z_CLEARANCE_MULTI_PROBE     5 // Z Clearance between multiple probes
+//#define Z_CLEARANCE_ADJACENT_PROBES 2 // Z Clearance between neighboring grid points (flat, clean beds only)
 //#define Z_AFTER_PROBING           5 // Z position after probing is done
 
 #define Z_PROBE_LOW_POINT          -2 // Farthest distance below the trigger-point to go before stopping
 
+/**
+ * Latch the Z position on the exact step where the probe triggers.
+ * Readings then no longer depend on how soon the endstop is polled or
+ * on ENDSTOP_NOISE_THRESHOLD, so faster probing feedrates can be used.
+ * With ENDSTOP_INTERRUPTS_FEATURE the pin change does the latching.
+ */
+//#define PROBE_STEP_LATCH
+
+/**
+ * Scan the bed with an analog height sensor (eddy-current, strain-gauge, etc.)
+ * Instead of touching down at every point G29 holds the probe at a fixed
+ * height and samples the sensor while sweeping each row of the mesh.
+ * The ADC reading is converted to a gap with a linear model.
+ */
+//#define PROBE_ANALOG_SCAN
+#if ENABLED(PROBE_ANALOG_SCAN)
+  //#define PROBE_ANALOG_PIN          -1 // Analog input for the height sensor. Override the pins file.
+  #define PROBE_SCAN_HEIGHT            2 // (mm) Height of the probe tip over the bed while scanning
+  #define PROBE_SCAN_ZERO_COUNT      512 // ADC reading with the probe tip at the bed surface
+  #define PROBE_SCAN_MM_PER_COUNT  0.005 // (mm) Gap change for each ADC count
+  #define PROBE_SCAN_FEEDRATE    (50*60) // (mm/min) Sweep speed
+#endif
+
 // For M851 give a range for adjusting the Z probe offset
 #define Z_PROBE_OFFSET_RANGE_MIN -2 // <-- changed
 #define Z_PROBE_OFFSET_RANGE_MAX 5 // <-- changed
@@ -1473,6 +1497,7 @@
 
   #define UBL_MESH_EDIT_MOVES_Z     // Sophisticated users prefer no movement of nozzle
   #define UBL_SAVE_ACTIVE_ON_M500   // Save the currently active mesh in the current slot on M500
+  //#define UBL_ORDERED_PROBING     // Probe in a serpentine walk from the nearest corner instead of nearest-remaining
 
   //#define UBL_Z_RAISE_WHEN_OFF_MESH 2.5 // When the nozzle is off the mesh, this value is used
                                           // as the Z-Height correction value.
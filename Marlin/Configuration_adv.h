@@ -398,6 +398,20 @@
 #define TEMP_SENSOR_AD8495_OFFSET 0.0
 #define TEMP_SENSOR_AD8495_GAIN   1.0
 
+/**
+ * ADC DMA Scan (STM32F1/F4/F7, LPC1768/9)
+ * Sample all analog inputs continuously in the background, so the temperature
+ * ISR reads every sensor in one call instead of starting one conversion per call.
+ * On STM32 a scan-mode ADC fills a circular DMA ring, averaged when read.
+ * LPC176x boards already sample in the background; only the sweep changes.
+ */
+//#define ADC_DMA_SCAN
+#if ENABLED(ADC_DMA_SCAN)
+  #define ADC_SCAN_OVERSAMPLE  8  // (STM32) Scans kept in the DMA ring and averaged for each read
+  #define ADC_SCAN_LOOPS      10  // Temperature ISR calls per sensor sweep. Lower for faster readings
+                                  // with ceramic hotends. Re-tune PID (M303) after changing.
+#endif
+
 /**
  * Controller Fan
  * To cool down the stepper drivers and MOSFETs.
@@ -1404,6 +1418,23 @@
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
 
+  /**
+   * Keep a per-layer index beside each print file (e.g., PART.GCO => PART.IDX)
+   * with the file position and estimated print time of every layer.
+   * A missing or outdated index is built in the background once a file is selected.
+   * Print progress then follows the estimated time, "M26 L<layer>" jumps to a layer,
+   * and "M27 L" reports the current layer.
+   */
+  //#define SD_LAYER_INDEX
+
+  /**
+   * Estimate the remaining print time with a model of the planner that
+   * reads the file ahead of the print, using the machine's feedrate,
+   * acceleration and jerk / junction deviation settings, plus M204 in the file.
+   * Used for the LCD remaining time, ExtUI, and "M79" reports.
+   */
+  //#define PRINT_TIME_ESTIMATOR
+
   /**
    * Set this option to one of the following (or the board's defaults apply):
    *
@@ -1460,6 +1491,10 @@
   // Swap the CW/CCW indicators in the graphics overlay
   //#define OVERLAY_GFX_REVERSE
 
+  // Only send the display pages that changed since the last screen update.
+  // Applies to displays driven by Marlin's own u8g_dev_* drivers.
+  //#define DOGM_PARTIAL_REFRESH
+
   /**
    * ST7920-based LCDs can emulate a 16 x 4 character display using
    * the ST7920 character-generator for very fast screen updates.
@@ -1643,6 +1678,10 @@
   // Output extra debug info for Touch UI events
   //#define TOUCH_UI_DEBUG
 
+  // STM32F1 with FT810 and up: Fill the next batch of commands while
+  // DMA sends the last one. The display must have its own SPI bus.
+  //#define TOUCH_UI_SPI_ASYNC
+
   // Developer menu (accessed by touching "About Printer" copyright text)
   //#define TOUCH_UI_DEVELOPER_MENU
 #endif
@@ -1967,6 +2006,15 @@
  */
 //#define MAXIMUM_STEPPER_RATE 250000
 
+/**
+ * ESP32 I2S stepper stream sample rate (in Hz)
+ *  Step and direction bits are rendered into the I2S DMA buffers ahead of
+ *  time, one sample per stepper tick. A step pulse lasts one sample, so a
+ *  higher rate allows faster stepping with shorter pulses.
+ *  Use 2500000 / n for n = 2 to 256 (e.g., 250000 = 4µs, 500000 = 2µs).
+ */
+//#define I2S_STEPPER_SAMPLE_RATE 250000
+
 // @section temperature
 
 // Control heater 0 and heater 1 in parallel.
@@ -2173,6 +2221,18 @@
     //#define TOOLCHANGE_PARK_X_ONLY          // X axis only move
     //#define TOOLCHANGE_PARK_Y_ONLY          // Y axis only move
   #endif
+
+  /**
+   * Heat the next tool ahead of its tool-change in an SD print, starting just
+   * in time according to the print time estimate. Each tool is heated to the
+   * temperature it had when it was last active (or first set to in the file).
+   * Requires PRINT_TIME_ESTIMATOR and more than one hotend.
+   */
+  //#define TOOLCHANGE_PREHEAT
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    #define TOOLCHANGE_PREHEAT_RATE      1.5  // (°C/s) Expected heat-up rate. Err on the slow side.
+    #define TOOLCHANGE_PREHEAT_MARGIN     10  // (seconds) Extra time to settle before the tool-change
+  #endif
 #endif // HAS_MULTI_EXTRUDER
 
 /**
@@ -2721,6 +2781,18 @@
    */
   #define TMC_DEBUG // <-- changed
 
+  /**
+   * Stream motor load (StallGuard result and CoolStep current) to the host.
+   * One driver of a moving axis is read per sample. The moves finished in
+   * each report interval are aggregated and reported on one line:
+   *   "TL:<first move>-<last move> X:<sg min>,<sg avg>,<sg max>,<cs avg> ..."
+   * M123 S<ms> sets the sample interval (1-255ms). M123 S0 stops the stream.
+   */
+  //#define TMC_LOAD_TELEMETRY
+  #if ENABLED(TMC_LOAD_TELEMETRY)
+    #define TMC_LOAD_REPORT_MS 250  // (ms) Shortest time between reports
+  #endif
+
   /**
    * You can set your own advanced settings by filling in predefined functions.
    * A list of available functions can be found on the library github page
@@ -3341,6 +3413,20 @@
 
 //#define MEATPACK                // Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
 
+/**
+ * Heatshrink G-code Compression
+ * Print heatshrink-compressed *.HS files (e.g., "part.gcode.hs") from SD, and
+ * accept compressed blocks over serial. "M37 S<bytes>" announces a block that
+ * directly follows its line. Each block is an independent heatshrink stream.
+ * Compress with the window and lookahead set here, e.g.: heatshrink -e -w 8 -l 4
+ * Each decoder uses 2^HEATSHRINK_WINDOW_BITS + 32 bytes of SRAM.
+ */
+//#define GCODE_HEATSHRINK
+#if ENABLED(GCODE_HEATSHRINK)
+  #define HEATSHRINK_WINDOW_BITS     8  // 8 for AVR. Up to 11 on boards with plenty of SRAM.
+  #define HEATSHRINK_LOOKAHEAD_BITS  4
+#endif
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -3463,6 +3549,17 @@
  * Implement M486 to allow Marlin to skip objects
  */
 //#define CANCEL_OBJECTS
+#if ENABLED(CANCEL_OBJECTS)
+  #define CANCEL_OBJECTS_COUNT 32       // Objects that can be canceled (up to 127)
+
+  /**
+   * Drop the moves of canceled objects as they're read from SD, instead of
+   * queueing and parsing them. Object labels are also recognized from the
+   * slicer comments of Cura (;MESH:) and PrusaSlicer (; printing object).
+   * Requires BUFSIZE of 4 or more.
+   */
+  //#define CANCEL_OBJECTS_FAST_SKIP
+#endif
 
 /**
  * I2C position encoders for closed loop control.
@@ -3774,6 +3871,19 @@
   //#define SERVICE_INTERVAL_2  200 // print hours
   //#define SERVICE_NAME_3      "Service 3"
   //#define SERVICE_INTERVAL_3    1 // print hours
+
+  /**
+   * Keep the statistics in a ring of records at the top of the EEPROM.
+   * Each save appends one record (sequence number + CRC) to the next slot,
+   * so no single cell takes every save, and the record is written a few
+   * bytes per idle loop so a save never stalls the main loop.
+   * Existing statistics are carried over on first boot.
+   */
+  //#define PRINTCOUNTER_RING
+  #if ENABLED(PRINTCOUNTER_RING)
+    #define PRINTCOUNTER_RING_SLOTS 8 // Number of records in the ring (2-16)
+    //#define PRINTCOUNTER_HISTOGRAMS // Count jobs by duration, filament used, and how they ended (M78)
+  #endif
 #endif
 
 // @section develop
@@ -3796,6 +3906,36 @@
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
 
+/**
+ * Boot Profiler
+ * Time each step of setup() and report the timings with M101.
+ */
+//#define BOOT_PROFILER
+#if ENABLED(BOOT_PROFILER)
+  #define BOOT_PROFILER_STEPS 40      // Number of steps to record
+#endif
+
+/**
+ * Deferred Startup
+ * Leave non-critical startup work for after setup() so hosts can connect sooner.
+ * The bootscreen stays up without blocking, and the print statistics and TMC
+ * connection test are loaded and run from idle(), one step per call.
+ */
+//#define DEFERRED_STARTUP
+
+/**
+ * Idle Task Scheduler
+ * Give each task run by idle() a period, a priority and a time budget.
+ * Background tasks (UI, SD media, file scanning) are put off while the
+ * planner is running low on moves or the idle() pass is over its budget.
+ * M102 reports the runs, mean, max and total time of each task.
+ */
+//#define IDLE_TASK_SCHEDULER
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #define IDLE_PASS_BUDGET_US  2000   // (µs) Time for one idle() pass before background tasks are put off
+  #define IDLE_TASK_MAX_DELAY   250   // (ms) Longest a background task may be put off
+#endif
+
 /**
  * Postmortem Debugging captures misbehavior and outputs the CPU status and backtrace to serial.
  * When running in the debugger it will break for debugging. This is useful to help understand
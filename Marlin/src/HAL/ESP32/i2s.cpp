@@ -47,6 +47,7 @@ typedef struct {
   uint32_t     **buffers;
   uint32_t     *current;
   uint32_t     rw_pos;
+  uint32_t     samples;  // Running count of samples rendered
   lldesc_t     **desc;
   xQueueHandle queue;
 } i2s_dma_t;
@@ -139,24 +140,43 @@ static void IRAM_ATTR i2s_intr_handler_default(void *arg) {
   I2S0.int_clr.val = I2S0.int_st.val; //clear pending interrupt
 }
 
+// Wait for the DMA to hand back a buffer it has sent
+static inline void i2s_next_buffer() {
+  xQueueReceive(dma.queue, &dma.current, portMAX_DELAY);
+  dma.rw_pos = 0;
+}
+
+// Render a run of samples holding the current port data
+static void i2s_fill_samples(uint32_t count) {
+  const uint32_t data = i2s_port_data;
+  dma.samples += count;
+  while (count) {
+    if (dma.rw_pos >= DMA_SAMPLE_COUNT) i2s_next_buffer();
+    const uint32_t run = _MIN(count, DMA_SAMPLE_COUNT - dma.rw_pos);
+    uint32_t *out = dma.current + dma.rw_pos, * const end = out + run;
+    while (out < end) *out++ = data;
+    dma.rw_pos += run;
+    count -= run;
+  }
+}
+
+/**
+ * Render the step schedule into the DMA buffers, as far ahead as they go.
+ * Each step event takes one pulse sample per step from pulse_phase_isr,
+ * then the rest of its interval is filled in a single run, so there is
+ * no per-sample call between steps. The task only blocks when all the
+ * buffers are queued for output.
+ */
 void stepperTask(void* parameter) {
-  uint32_t remaining = 0;
-
-  while (1) {
-    xQueueReceive(dma.queue, &dma.current, portMAX_DELAY);
-    dma.rw_pos = 0;
-
-    while (dma.rw_pos < DMA_SAMPLE_COUNT) {
-      // Fill with the port data post pulse_phase until the next step
-      if (remaining) {
-        i2s_push_sample();
-        remaining--;
-      }
-      else {
-        Stepper::pulse_phase_isr();
-        remaining = Stepper::block_phase_isr();
-      }
-    }
+  dma.rw_pos = DMA_SAMPLE_COUNT; // Fetch a buffer on the first sample
+
+  for (;;) {
+    const uint32_t start = dma.samples;
+    Stepper::pulse_phase_isr();
+    const uint32_t interval = Stepper::block_phase_isr(),
+                   pulsed = dma.samples - start;
+    // The pulse samples are part of the interval, but always leave one low sample
+    i2s_fill_samples(interval > pulsed ? interval - pulsed : 1);
   }
 }
 
@@ -179,7 +199,9 @@ int i2s_init() {
    *
    *   for fwclk = 250kHz (4µS pulse time)
    *      N = 10
-   *      M = 20
+   *      M = 2
+   *
+   *   so N = 2.5MHz / I2S_STEPPER_SAMPLE_RATE
    */
 
   // Allocate the array of pointers to the buffers
@@ -289,7 +311,7 @@ int i2s_init() {
 
   // set clock
   I2S0.clkm_conf.clka_en = 0;       // Use PLL/2 as reference
-  I2S0.clkm_conf.clkm_div_num = 10; // minimum value of 2, reset value of 4, max 256
+  I2S0.clkm_conf.clkm_div_num = 2500000UL / (I2S_STEPPER_SAMPLE_RATE); // minimum value of 2, reset value of 4, max 256
   I2S0.clkm_conf.clkm_div_a = 0;    // 0 at reset, what about divide by 0? (not an issue)
   I2S0.clkm_conf.clkm_div_b = 0;    // 0 at reset
 
@@ -337,7 +359,9 @@ uint8_t i2s_state(uint8_t pin) {
 }
 
 void i2s_push_sample() {
+  if (dma.rw_pos >= DMA_SAMPLE_COUNT) i2s_next_buffer();
   dma.current[dma.rw_pos++] = i2s_port_data;
+  dma.samples++;
 }
 
 #endif // ARDUINO_ARCH_ESP32
@@ -37,6 +37,14 @@
   #error "Only enable one WiFi option, either WIFISUPPORT or ESP3D_WIFISUPPORT."
 #endif
 
+#if ENABLED(I2S_STEPPER_STREAM)
+  #if (2500000UL % (I2S_STEPPER_SAMPLE_RATE)) || 2500000UL / (I2S_STEPPER_SAMPLE_RATE) < 2 || 2500000UL / (I2S_STEPPER_SAMPLE_RATE) > 256
+    #error "I2S_STEPPER_SAMPLE_RATE must be 2500000 / n, with n from 2 to 256."
+  #elif MINIMUM_STEPPER_PULSE > 1000000UL / (I2S_STEPPER_SAMPLE_RATE)
+    #error "MINIMUM_STEPPER_PULSE is longer than one I2S sample. Lower I2S_STEPPER_SAMPLE_RATE."
+  #endif
+#endif
+
 #if ENABLED(POSTMORTEM_DEBUGGING)
   #error "POSTMORTEM_DEBUGGING is not yet supported on ESP32."
 #endif
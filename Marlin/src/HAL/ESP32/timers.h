@@ -51,8 +51,11 @@ typedef uint64_t hal_timer_t;
 #define HAL_TIMER_RATE APB_CLK_FREQ // frequency of timer peripherals
 
 #if ENABLED(I2S_STEPPER_STREAM)
+  #ifndef I2S_STEPPER_SAMPLE_RATE
+    #define I2S_STEPPER_SAMPLE_RATE  250000                           // 250khz, 4µs pulses of i2s word clock
+  #endif
   #define STEPPER_TIMER_PRESCALE     1
-  #define STEPPER_TIMER_RATE         250000                           // 250khz, 4µs pulses of i2s word clock
+  #define STEPPER_TIMER_RATE         I2S_STEPPER_SAMPLE_RATE          // one tick per i2s sample
   #define STEPPER_TIMER_TICKS_PER_US ((STEPPER_TIMER_RATE) / 1000000) // stepper timer ticks per µs // wrong would be 0.25
 #else
   #define STEPPER_TIMER_PRESCALE     40
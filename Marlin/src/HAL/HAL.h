@@ -51,6 +51,11 @@
   #define PGMSTR(NAM,STR) const char NAM[] = STR
 #endif
 
+// Scoped profiling marker, for HALs that can measure the code it covers
+#ifndef HAL_PROFILE
+  #define HAL_PROFILE(ID) NOOP
+#endif
+
 inline void watchdog_refresh() {
   TERN_(USE_WATCHDOG, HAL_watchdog_refresh());
 }
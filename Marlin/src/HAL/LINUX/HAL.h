@@ -50,6 +50,11 @@ uint8_t _getc();
 #define B10 2
 
 #include "hardware/Clock.h"
+#include "hardware/CycleModel.h"
+
+#ifdef HAL_CYCLE_MODEL
+  #define HAL_PROFILE(ID) CycleModel::Scope _cycle_scope(CycleModel::ID)
+#endif
 
 #include "../shared/Marduino.h"
 #include "../shared/math_32bit.h"
@@ -109,7 +114,18 @@ inline uint8_t HAL_get_reset_source(void) { return RST_POWER_ON; }
 
 inline void HAL_reboot() {}  // reboot the board or restart the bootloader
 
+// Step trace: log planned blocks to planner_block_log.csv and mark where the
+// stepper starts each one in the GPIO trace (enable GPIO_LOGGING in main.cpp).
+// Check the result with buildroot/share/scripts/step_trace_check.py
+//#define HAL_STEP_TRACE 1
+#ifdef HAL_STEP_TRACE
+  void HAL_step_trace_planned(const uint8_t index); // The planner has filled block_buffer[index]
+  void HAL_step_trace_started(const uint8_t index); // The stepper has picked up block_buffer[index]
+  void HAL_step_trace_aborted(const uint8_t index); // The stepper has cut block_buffer[index] short
+#endif
+
 /* ---------------- Delay in cycles */
 FORCE_INLINE static void DELAY_CYCLES(uint64_t x) {
+  TERN_(HAL_CYCLE_MODEL, CycleModel::Skip skip(x)); // Model the busy-wait, not the sleep
   Clock::delayCycles(x);
 }
@@ -24,6 +24,7 @@
 #include <iostream>
 #include "../../inc/MarlinConfig.h"
 #include "hardware/Clock.h"
+#include "hardware/Timer.h"
 #include "../shared/Delay.h"
 
 // Interrupts
@@ -36,16 +37,30 @@ void _delay_ms(const int delay_ms) {
 }
 
 uint32_t millis() {
+  TERN_(TIMER_EVENT_LOOP, Timer::dispatch());
   return (uint32_t)Clock::millis();
 }
 
+uint32_t micros() {
+  TERN_(TIMER_EVENT_LOOP, Timer::dispatch());
+  return (uint32_t)Clock::micros();
+}
+
+#ifdef TIMER_EVENT_LOOP
+  // The ISRs only run when this thread dispatches them, so wait actively
+  static void wait_nanos(const uint64_t ns) {
+    const uint64_t end = Clock::nanos() + ns;
+    while (Clock::nanos() < end) { Timer::dispatch(); std::this_thread::yield(); }
+  }
+#endif
+
 // This is required for some Arduino libraries we are using
 void delayMicroseconds(uint32_t us) {
-  Clock::delayMicros(us);
+  TERN(TIMER_EVENT_LOOP, wait_nanos(us * 1000ULL), Clock::delayMicros(us));
 }
 
 extern "C" void delay(const int msec) {
-  Clock::delayMillis(msec);
+  TERN(TIMER_EVENT_LOOP, wait_nanos(msec * 1000000ULL), Clock::delayMillis(msec));
 }
 
 // IO functions
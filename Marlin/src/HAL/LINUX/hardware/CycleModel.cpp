@@ -0,0 +1,146 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+
+#ifdef HAL_CYCLE_MODEL
+
+#include <chrono>
+
+/**
+ * Cost table, in target cycles per host nanosecond of marked code.
+ * These are starting points for a ~3 GHz x86-64 host. For real numbers,
+ * time the same code on a board (e.g., toggle a pin around Stepper::isr
+ * and scope it), then divide by the host time this model reports.
+ *
+ * The LPC1768 row is copied from the SAM3X row and has not been measured.
+ * Both are Cortex-M3 parts with software float and 5-cycle flash reads
+ * behind a prefetch buffer at full clock, so their cycle counts should be
+ * close. Remeasure on an LPC board before trusting small margins.
+ *
+ *                   f_cpu       Stepper::isr  Temperature::tick  Planner::recalculate  GCodeParser::parse
+ */
+#if CYCLE_MODEL_TARGET == CYCLE_MODEL_AVR
+  const CycleModel::Target CycleModel::target = { "AVR",      16000000UL, { 40, 40, 120, 30 } };
+#elif CYCLE_MODEL_TARGET == CYCLE_MODEL_SAM3X
+  const CycleModel::Target CycleModel::target = { "SAM3X",    84000000UL, {  8,  8,  25,  6 } };
+#elif CYCLE_MODEL_TARGET == CYCLE_MODEL_LPC1768
+  const CycleModel::Target CycleModel::target = { "LPC1768", 100000000UL, {  8,  8,  25,  6 } }; // SAM3X figures
+#else
+  #error "Unknown CYCLE_MODEL_TARGET."
+#endif
+
+static const char * const marker_name[CycleModel::COUNT] = { "Stepper::isr", "Temperature::tick", "Planner::recalculate", "GCodeParser::parse" };
+
+CycleModel::Stats CycleModel::stats[COUNT];
+uint64_t CycleModel::over_budget; // = 0
+float CycleModel::worst_load; // = 0
+thread_local CycleModel::Scope* CycleModel::current; // = nullptr
+
+static inline uint64_t host_nanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+CycleModel::Scope::Scope(const Id id) : id(id), nested(0), extra_cycles(0), parent(current) {
+  current = this;
+  start = host_nanos();
+}
+
+CycleModel::Scope::~Scope() {
+  const uint64_t elapsed = host_nanos() - start,
+                 ns = elapsed > nested ? elapsed - nested : 0,
+                 cycles = uint64_t(ns * target.cycles_per_ns[id] / (CYCLE_MODEL_HOST_SCALE)) + extra_cycles;
+  current = parent;
+  if (parent) parent->nested += elapsed;
+
+  Stats &s = stats[id];
+  s.count++;
+  s.host_ns += ns;
+  s.cycles += cycles;
+  if (cycles > s.cycles_max) s.cycles_max = cycles;
+
+  if (id == STEPPER_ISR) {
+    // The ISR has just programmed the interval until it runs again
+    const float interval_s = float(HAL_timer_get_compare(STEP_TIMER_NUM)) / (STEPPER_TIMER_RATE),
+                load = cycles / (interval_s * target.f_cpu);
+    if (load > 1) over_budget++;
+    if (load > worst_load) worst_load = load;
+  }
+}
+
+CycleModel::Skip::Skip(const uint64_t sim_cycles) : sim_cycles(sim_cycles) {
+  if (current) start = host_nanos();
+}
+
+CycleModel::Skip::~Skip() {
+  if (!current) return;
+  current->nested += host_nanos() - start;
+  current->extra_cycles += sim_cycles * target.f_cpu / (F_CPU);
+}
+
+CycleModel::Wait::Wait() {
+  if (current) start = host_nanos();
+}
+
+CycleModel::Wait::~Wait() {
+  if (!current) return;
+  const uint64_t ns = host_nanos() - start;
+  current->nested += ns;
+  current->extra_cycles += ns * target.f_cpu / 1000000000ULL;
+}
+
+void CycleModel::report(FILE *out) {
+  fprintf(out, "target %s at %lu Hz\n", target.name, (unsigned long)target.f_cpu);
+  fprintf(out, "marker count host_ns_avg cycles_avg cycles_max\n");
+  for (uint8_t i = 0; i < COUNT; i++) {
+    const Stats &s = stats[i];
+    const uint64_t n = s.count ? s.count : 1;
+    fprintf(out, "%s %lu %lu %lu %lu\n", marker_name[i], (unsigned long)s.count,
+      (unsigned long)(s.host_ns / n), (unsigned long)(s.cycles / n), (unsigned long)s.cycles_max);
+  }
+  fprintf(out, "stepper ISR over budget: %lu, worst load %.0f%%\n", (unsigned long)over_budget, worst_load * 100);
+  const Stats &s = stats[STEPPER_ISR];
+  if (s.cycles_max)
+    fprintf(out, "stepper ISR rate the target sustains: %lu/s worst case, %lu/s on average\n",
+      (unsigned long)(target.f_cpu / s.cycles_max), (unsigned long)(target.f_cpu / _MAX(s.cycles / _MAX(s.count, uint64_t(1)), uint64_t(1))));
+}
+
+void CycleModel::task() {
+  static millis_t next_report; // = 0
+  static uint64_t warned; // = 0
+  const millis_t ms = millis();
+  if (PENDING(ms, next_report)) return;
+  next_report = ms + 1000;
+
+  FILE * const out = fopen("cycle_model.txt", "w");
+  if (out) { report(out); fclose(out); }
+
+  if (over_budget > warned) {
+    fprintf(stderr, "cycle model: %lu stepper ISR(s) would overrun on %s, worst load %.0f%%\n",
+      (unsigned long)(over_budget - warned), target.name, worst_load * 100);
+    warned = over_budget;
+  }
+}
+
+#endif // HAL_CYCLE_MODEL
+#endif // __PLAT_LINUX__
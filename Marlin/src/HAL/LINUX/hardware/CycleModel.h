@@ -0,0 +1,127 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Virtual MCU cycle cost model
+ *
+ * HAL_PROFILE(ID) markers in the firmware open a Scope that measures the
+ * host time spent in that code, minus any nested markers (e.g., an ISR
+ * that interrupted it). The host time is turned into target MCU cycles
+ * with a per-target, per-marker factor from the cost table below.
+ *
+ * After each stepper ISR the modeled cycles are compared with the time
+ * until the next one, as programmed in the step timer. Calls that would
+ * not have finished in time on the target are counted as over budget.
+ * The totals go to cycle_model.txt once a second, and a warning goes to
+ * stderr whenever the over-budget count grows.
+ *
+ * Time spent in simulated hardware (pin callbacks, logging) is left out,
+ * and DELAY_CYCLES counts the cycles it asks for instead of its sleep.
+ * Polling the step timer (e.g., for timed step pulses) counts as wall time.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Enable to model the HAL_PROFILE markers (see also CYCLE_MODEL_TARGET)
+//#define HAL_CYCLE_MODEL
+#ifdef HAL_CYCLE_MODEL
+
+#define CYCLE_MODEL_AVR     1   // ATmega2560, 16 MHz, 8-bit, software float
+#define CYCLE_MODEL_SAM3X   2   // SAM3X8E (DUE, Archim), 84 MHz Cortex-M3, software float
+#define CYCLE_MODEL_LPC1768 3   // LPC1768, 100 MHz Cortex-M3, software float
+
+#ifndef CYCLE_MODEL_TARGET
+  #define CYCLE_MODEL_TARGET CYCLE_MODEL_SAM3X
+#endif
+
+// Scale all factors for a host faster (>1) or slower (<1) than the one the table was made on
+#ifndef CYCLE_MODEL_HOST_SCALE
+  #define CYCLE_MODEL_HOST_SCALE 1.0
+#endif
+
+class CycleModel {
+public:
+  enum Id : uint8_t { STEPPER_ISR, TEMP_TICK, PLANNER_RECALC, GCODE_PARSE, COUNT };
+
+  struct Target {
+    const char *name;
+    uint32_t f_cpu;
+    float cycles_per_ns[COUNT];   // Target cycles per host nanosecond, for each marker
+  };
+  static const Target target;
+
+  struct Stats {
+    uint64_t count,
+             host_ns,             // Host time, excluding nested markers
+             cycles,              // Modeled target cycles
+             cycles_max;
+  };
+  static Stats stats[COUNT];
+
+  static uint64_t over_budget;    // Stepper ISRs modeled to run past the next one
+  static float worst_load;        // Largest modeled ISR time / interval seen
+
+  class Skip;
+  class Wait;
+
+  class Scope {
+  public:
+    Scope(const Id id);
+    ~Scope();
+  private:
+    friend class Skip;
+    friend class Wait;
+    Id id;
+    uint64_t start, nested, extra_cycles;
+    Scope *parent;
+  };
+
+  // Leave host time out of the enclosing Scope, optionally in place of
+  // a number of cycles at the simulator's F_CPU
+  class Skip {
+  public:
+    Skip(const uint64_t sim_cycles=0);
+    ~Skip();
+  private:
+    uint64_t start, sim_cycles;
+  };
+
+  // Host time spent polling the clock takes as long on the target
+  class Wait {
+  public:
+    Wait();
+    ~Wait();
+  private:
+    uint64_t start;
+  };
+
+  // Write the report and warnings. Call from the main thread.
+  static void task();
+  static void report(FILE *out);
+
+private:
+  static thread_local Scope *current;
+};
+
+#endif // HAL_CYCLE_MODEL
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "Clock.h"
+#include "CycleModel.h"
 #include "../../../inc/MarlinConfigPre.h"
 #include <stdint.h>
 
@@ -34,16 +35,19 @@ struct GpioEvent {
     RISE,
     SET_VALUE,
     SETM,
-    SETD
+    SETD,
+    MARK    // Not a pin change: 'value' is a marker id
   };
   uint64_t timestamp;
   pin_type pin_id;
   GpioEvent::Type event;
+  uint16_t value;   // Pin value, mode, or direction after the event
 
-  GpioEvent(uint64_t timestamp, pin_type pin_id, GpioEvent::Type event){
+  GpioEvent(uint64_t timestamp, pin_type pin_id, GpioEvent::Type event, uint16_t value=0){
     this->timestamp = timestamp;
     this->pin_id = pin_id;
     this->event = event;
+    this->value = value;
   }
 };
 
@@ -85,7 +89,8 @@ public:
     if (!valid_pin(pin)) return;
     GpioEvent::Type evt_type = value > 1 ? GpioEvent::SET_VALUE : value > pin_map[pin].value ? GpioEvent::RISE : value < pin_map[pin].value ? GpioEvent::FALL : GpioEvent::NOP;
     pin_map[pin].value = value;
-    GpioEvent evt(Clock::nanos(), pin, evt_type);
+    GpioEvent evt(Clock::nanos(), pin, evt_type, value);
+    TERN_(HAL_CYCLE_MODEL, CycleModel::Skip skip); // Simulated hardware, not firmware
     if (pin_map[pin].cb) {
       pin_map[pin].cb->interrupt(evt);
     }
@@ -104,7 +109,8 @@ public:
   static void setMode(pin_type pin, uint8_t value) {
     if (!valid_pin(pin)) return;
     pin_map[pin].mode = value;
-    GpioEvent evt(Clock::nanos(), pin, GpioEvent::Type::SETM);
+    GpioEvent evt(Clock::nanos(), pin, GpioEvent::Type::SETM, value);
+    TERN_(HAL_CYCLE_MODEL, CycleModel::Skip skip); // Simulated hardware, not firmware
     if (pin_map[pin].cb) pin_map[pin].cb->interrupt(evt);
     if (Gpio::logger) Gpio::logger->log(evt);
   }
@@ -117,7 +123,8 @@ public:
   static void setDir(pin_type pin, uint8_t value) {
     if (!valid_pin(pin)) return;
     pin_map[pin].dir = value;
-    GpioEvent evt(Clock::nanos(), pin, GpioEvent::Type::SETD);
+    GpioEvent evt(Clock::nanos(), pin, GpioEvent::Type::SETD, value);
+    TERN_(HAL_CYCLE_MODEL, CycleModel::Skip skip); // Simulated hardware, not firmware
     if (pin_map[pin].cb) pin_map[pin].cb->interrupt(evt);
     if (Gpio::logger) Gpio::logger->log(evt);
   }
@@ -132,6 +139,11 @@ public:
     pin_map[pin].cb = per;
   }
 
+  // Put a marker in the log, e.g., at the start of a planner block
+  static void mark(uint16_t id) {
+    if (Gpio::logger) Gpio::logger->log(GpioEvent(Clock::nanos(), 0, GpioEvent::Type::MARK, id));
+  }
+
   static void attachLogger(IOLogger* logger) {
     Gpio::logger = logger;
   }
@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "Clock.h"
+#include <math.h>
+#include <random>
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_ANALOG_SCAN)
+
+#include "HeightSensor.h"
+
+HeightSensor::HeightSensor(pin_t adc, const LinearAxis &x, const LinearAxis &y, const LinearAxis &z)
+  : adc_pin(adc), x_axis(x), y_axis(y), z_axis(z) {
+  last = Clock::micros();
+}
+
+HeightSensor::~HeightSensor() {
+}
+
+double HeightSensor::bed_height(const double x, const double y) {
+  // A slight tilt with a gentle wave across it
+  return 0.002 * x - 0.0015 * y + 0.08 * sin(x * 0.03) * cos(y * 0.02);
+}
+
+void HeightSensor::update() {
+  auto now = Clock::micros();
+  if (now - last < 100) return;
+  last = now;
+
+  // Axis positions are in steps, with the endstop at min_position
+  constexpr float spu[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+  constexpr xyz_pos_t offset = NOZZLE_TO_PROBE_OFFSET;
+  const double px = (x_axis.position - x_axis.min_position) / spu[X_AXIS] + offset.x,
+               py = (y_axis.position - y_axis.min_position) / spu[Y_AXIS] + offset.y,
+               pz = (z_axis.position - z_axis.min_position) / spu[Z_AXIS] + offset.z;
+
+  const double gap = pz - bed_height(px, py);
+  const double noise = (rand() % 3) - 1;
+  const int32_t count = PROBE_SCAN_ZERO_COUNT + lround(gap / (PROBE_SCAN_MM_PER_COUNT)) + noise;
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = uint16_t(constrain(count, 0, 0x3FF) << 2);
+}
+
+void HeightSensor::interrupt(GpioEvent ev) {
+  // unused
+}
+
+#endif // PROBE_ANALOG_SCAN
+#endif // __PLAT_LINUX__
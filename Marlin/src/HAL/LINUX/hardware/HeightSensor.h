@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "Gpio.h"
+#include "LinearAxis.h"
+
+// A simulated analog height sensor over a warped bed
+class HeightSensor: public Peripheral {
+public:
+  HeightSensor(pin_t adc, const LinearAxis &x, const LinearAxis &y, const LinearAxis &z);
+  virtual ~HeightSensor();
+  void interrupt(GpioEvent ev);
+  void update();
+
+  // Height of the simulated bed surface at (x, y) in mm
+  static double bed_height(const double x, const double y);
+
+  pin_t adc_pin;
+  const LinearAxis &x_axis, &y_axis, &z_axis;
+  uint64_t last;
+};
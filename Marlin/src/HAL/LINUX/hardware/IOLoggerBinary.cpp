@@ -0,0 +1,150 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "IOLoggerBinary.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Grow the file a big step at a time so the mapping is rarely moved
+static constexpr size_t map_step = 64UL << 20;
+
+IOLoggerBinary::IOLoggerBinary(std::string filename) : next_stream(0), dropped(0), map(nullptr), map_size(0), used(0) {
+  rings = new Ring[stream_count];
+  for (uint8_t s = 0; s < stream_count; s++) {
+    Ring &r = rings[s];
+    for (uint32_t i = 0; i < ring_size; i++) r.cell[i].seq.store(i, std::memory_order_relaxed);
+    r.head.store(0, std::memory_order_relaxed);
+    r.tail = 0;
+    r.last = 0;
+  }
+
+  fd = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0 || !reserve(sizeof(TraceHeader))) {
+    printf("IOLoggerBinary: unable to map %s\n", filename.c_str());
+    return;
+  }
+
+  TraceHeader &h = *(TraceHeader*)map;
+  memcpy(h.magic, "MGPT", 4);
+  h.version = 1;
+  h.streams = stream_count;
+  h.used = used = sizeof(TraceHeader);
+  h.dropped = 0;
+}
+
+IOLoggerBinary::~IOLoggerBinary() {
+  flush();
+  if (map) munmap(map, map_size);
+  if (fd >= 0) {
+    if (ftruncate(fd, used)) { /* keep the padded file, the header knows its length */ }
+    close(fd);
+  }
+  delete[] rings;
+}
+
+// Each thread sticks to one stream. Claiming one is a single atomic add,
+// which is safe inside a signal handler.
+IOLoggerBinary::Ring& IOLoggerBinary::ring() {
+  static thread_local int8_t stream = -1;
+  if (stream < 0) stream = next_stream.fetch_add(1, std::memory_order_relaxed) % stream_count;
+  return rings[stream];
+}
+
+void IOLoggerBinary::log(GpioEvent ev) {
+  Ring &r = ring();
+  uint32_t pos = r.head.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell &c = r.cell[pos & (ring_size - 1)];
+    const int32_t diff = int32_t(c.seq.load(std::memory_order_acquire) - pos);
+    if (diff == 0) {
+      if (r.head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        c.timestamp = ev.timestamp;
+        c.pin = ev.pin_id;
+        c.value = ev.value;
+        c.event = ev.event;
+        c.seq.store(pos + 1, std::memory_order_release);
+        return;
+      }
+    }
+    else if (diff < 0) {
+      // Full: flush() hasn't kept up
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    else
+      pos = r.head.load(std::memory_order_relaxed);
+  }
+}
+
+bool IOLoggerBinary::reserve(const size_t bytes) {
+  if (used + bytes <= map_size) return true;
+  if (fd < 0) return false;
+  if (map) munmap(map, map_size);
+  map_size += map_step;
+  map = nullptr;
+  if (ftruncate(fd, map_size)) return false;
+  void * const m = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (m == MAP_FAILED) return false;
+  map = (uint8_t*)m;
+  return true;
+}
+
+void IOLoggerBinary::put_varint(uint64_t v) {
+  while (v >= 0x80) { map[used++] = uint8_t(v) | 0x80; v >>= 7; }
+  map[used++] = uint8_t(v);
+}
+
+void IOLoggerBinary::flush() {
+  if (!map) return;
+
+  for (uint8_t s = 0; s < stream_count; s++) {
+    Ring &r = rings[s];
+    for (;;) {
+      Cell &c = r.cell[r.tail & (ring_size - 1)];
+      // Stop at the first event that isn't completely written yet
+      if (c.seq.load(std::memory_order_acquire) != r.tail + 1) break;
+
+      if (!reserve(1 + 3 * 10)) return;     // Tag plus three varints at most
+      const bool has_value = c.event != GpioEvent::RISE && c.event != GpioEvent::FALL;
+      map[used++] = (c.event & 0x07) | (has_value ? 0x08 : 0) | (s << 4);
+      // A signal can log between another event's timestamp and its push, so deltas may be negative
+      const int64_t delta = int64_t(c.timestamp - r.last);
+      put_varint(uint64_t(delta) << 1 ^ uint64_t(delta >> 63));
+      put_varint(uint16_t(c.pin));
+      if (has_value) put_varint(c.value);
+      r.last = c.timestamp;
+
+      c.seq.store(r.tail + ring_size, std::memory_order_release);
+      r.tail++;
+    }
+  }
+
+  TraceHeader &h = *(TraceHeader*)map;
+  h.used = used;
+  h.dropped = dropped.load(std::memory_order_relaxed);
+}
+
+#endif // __PLAT_LINUX__
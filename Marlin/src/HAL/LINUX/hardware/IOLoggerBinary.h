@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Binary GPIO trace recorder
+ *
+ * log() may be called from any thread, including from the timer signal
+ * handlers, so it takes no locks and never allocates. Each thread gets its
+ * own bounded ring of events. flush() drains the rings into a memory-mapped
+ * file in a compact form:
+ *
+ *   header  : TraceHeader (see below)
+ *   records : tag byte   - bits 0-2 event type, bit 3 value follows, bits 4-7 stream
+ *             varint     - nanoseconds since the previous record of the same stream, zigzag signed
+ *             varint     - pin
+ *             varint     - value (only for events other than RISE / FALL)
+ *
+ * Streams are written in drain order, so records are only ordered within a
+ * stream. buildroot/share/scripts/gpio_trace.py merges them by time and
+ * converts the trace to CSV or VCD.
+ */
+
+#include <atomic>
+#include <string>
+#include "Gpio.h"
+
+class IOLoggerBinary: public IOLogger {
+public:
+  IOLoggerBinary(std::string filename);
+  virtual ~IOLoggerBinary();
+  void flush();
+  void log(GpioEvent ev);
+
+  struct TraceHeader {
+    char magic[4];            // "MGPT"
+    uint16_t version;
+    uint16_t streams;
+    uint64_t used;            // Bytes of valid data, header included, updated on every flush
+    uint64_t dropped;         // Events lost to full rings
+  };
+
+private:
+  static constexpr uint8_t stream_count = 16;        // Fits the 4 stream bits of the tag
+  static constexpr uint32_t ring_size = 1UL << 15;   // Events per stream, a power of 2
+
+  struct Cell {
+    std::atomic<uint32_t> seq;
+    uint64_t timestamp;
+    pin_type pin;
+    uint16_t value;
+    uint8_t event;
+  };
+
+  // Bounded ring that any number of producers (here one thread and the
+  // signal handlers interrupting it) can push to without waiting on each other
+  struct Ring {
+    Cell cell[ring_size];
+    std::atomic<uint32_t> head;
+    uint32_t tail;            // Only touched by flush()
+    uint64_t last;            // Timestamp of the stream's last written record
+  };
+
+  Ring *rings;
+  std::atomic<uint8_t> next_stream;
+  std::atomic<uint64_t> dropped;
+
+  int fd;
+  uint8_t *map;
+  size_t map_size, used;
+
+  Ring& ring();
+  bool reserve(const size_t bytes);
+  void put_varint(uint64_t v);
+};
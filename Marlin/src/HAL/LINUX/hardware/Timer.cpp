@@ -23,6 +23,8 @@
 
 #include "Timer.h"
 #include <stdio.h>
+#include <string.h>
+#include <algorithm>
 
 Timer::Timer() {
   active = false;
@@ -36,6 +38,107 @@ Timer::Timer() {
   avg_error = 0;
 }
 
+#ifdef TIMER_EVENT_LOOP
+
+Timer *Timer::timers[Timer::max_timers];
+uint8_t Timer::timer_count; // = 0
+thread_local bool Timer::dispatch_thread; // = false
+bool Timer::dispatching; // = false
+
+Timer::~Timer() {}
+
+void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
+  id = sig_id;
+  frequency = sim_freq;
+  cbfn = fn;
+  deadline = UINT64_MAX;
+  memset(&stats, 0, sizeof(stats));
+  if (timer_count < max_timers) timers[timer_count++] = this;
+  dispatch_thread = true;
+}
+
+void Timer::start(uint32_t frequency) {
+  start_time = Clock::nanos();
+  setCompare(this->frequency / frequency);
+}
+
+// Matches missed while disabled aren't replayed. The next one is a period from now.
+void Timer::enable() {
+  if (!active) {
+    start_time = Clock::nanos();
+    deadline = start_time + std::max<uint64_t>(period, 1);
+  }
+  active = true;
+}
+
+void Timer::disable() { active = false; }
+
+// Like a match register on a counter that restarts at each match,
+// the next match comes 'compare' ticks after the last one
+void Timer::setCompare(uint32_t compare) {
+  this->compare = compare;
+  period = Clock::ticksToNanos(compare, frequency);
+  deadline = start_time + std::max<uint64_t>(period, 1);
+}
+
+void Timer::dispatch() {
+  if (dispatching || !dispatch_thread) return;
+  dispatching = true;
+
+  const uint64_t now = Clock::nanos();
+  for (;;) {
+    // The earliest match wins, ties going to the lower timer number
+    Timer *t = nullptr;
+    for (uint8_t i = 0; i < timer_count; i++) {
+      Timer * const c = timers[i];
+      if (c->active && c->deadline <= now && (!t || c->deadline < t->deadline)) t = c;
+    }
+    if (!t) break;
+
+    // The counter restarts at the match, and repeats unless the ISR sets a new compare
+    t->start_time = t->deadline;
+    t->deadline += std::max<uint64_t>(t->period, 1);
+
+    const uint64_t late = Clock::nanos() - t->start_time;
+    const auto begin = std::chrono::steady_clock::now();
+    t->cbfn();
+    const uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count(),
+                   cycles = Clock::nanosToTicks(uint64_t(ns * (TIMER_MCU_SLOWDOWN)));
+
+    Stats &s = t->stats;
+    s.count++;
+    s.host_ns += ns;        s.host_ns_max = std::max(s.host_ns_max, ns);
+    s.cycles += cycles;     s.cycles_max = std::max(s.cycles_max, cycles);
+    s.late_ns += late;      s.late_ns_max = std::max(s.late_ns_max, late);
+    if (late > t->period) t->overruns++;  // A whole period behind
+    t->avg_error = s.late_ns / s.count;
+  }
+
+  static uint64_t next_report; // = 0
+  if (now >= next_report) {
+    next_report = now + 1000000000ULL;
+    FILE * const out = fopen("timer_stats.txt", "w");
+    if (out) { report(out); fclose(out); }
+  }
+
+  dispatching = false;
+}
+
+void Timer::report(FILE *out) {
+  fprintf(out, "timer count host_ns_avg host_ns_max cycles_avg cycles_max late_ns_avg late_ns_max overruns\n");
+  for (uint8_t i = 0; i < timer_count; i++) {
+    const Timer &t = *timers[i];
+    const Stats &s = t.stats;
+    const uint64_t n = std::max<uint64_t>(s.count, 1);
+    fprintf(out, "%ld %lu %lu %lu %lu %lu %lu %lu %u\n", long(t.id), (unsigned long)s.count,
+      (unsigned long)(s.host_ns / n), (unsigned long)s.host_ns_max,
+      (unsigned long)(s.cycles / n), (unsigned long)s.cycles_max,
+      (unsigned long)(s.late_ns / n), (unsigned long)s.late_ns_max, t.overruns);
+  }
+}
+
+#else // !TIMER_EVENT_LOOP
+
 Timer::~Timer() {
   timer_delete(timerid);
 }
@@ -110,6 +213,8 @@ void Timer::setCompare(uint32_t compare) {
   this->start_time = Clock::nanos();
 }
 
+#endif // !TIMER_EVENT_LOOP
+
 uint32_t Timer::getCount() {
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
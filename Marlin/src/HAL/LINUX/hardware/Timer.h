@@ -30,6 +30,21 @@
 
 #include "Clock.h"
 
+/**
+ * By default each Timer is a POSIX timer that raises a signal, so the ISRs
+ * run whenever the host gets around to delivering it, overrunning even at
+ * 50kHz. With TIMER_EVENT_LOOP the timers are plain compare registers and
+ * the main thread dispatches the ISRs itself, in compare-match order, each
+ * time it reads the clock or waits. Every ISR's execution time is accounted
+ * in host nanoseconds and in estimated MCU cycles, and the totals are written
+ * to timer_stats.txt once a second.
+ */
+//#define TIMER_EVENT_LOOP
+#ifdef TIMER_EVENT_LOOP
+  // How much slower the target MCU runs Marlin than this host does at the same clock
+  #define TIMER_MCU_SLOWDOWN 1.0
+#endif
+
 class Timer {
 public:
   Timer();
@@ -48,19 +63,44 @@ public:
   uint32_t getOverruns() {return overruns;}
   uint32_t getAvgError() {return avg_error;}
 
-  intptr_t getID() {
-    return (*(intptr_t*)timerid);
-  }
+  #ifdef TIMER_EVENT_LOOP
+
+    intptr_t getID() { return id; }
+
+    // Run every ISR that is due, in order. Only the thread that called init() dispatches.
+    static void dispatch();
+
+    // Write the per-ISR statistics
+    static void report(FILE *out);
 
-  static void handler(int sig, siginfo_t *si, void *uc){
-    Timer* _this = (Timer*)si->si_value.sival_ptr;
-    _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
-    _this->avg_error /= 2; //very crude precision analysis (actually within +-500ns usually)
-    _this->start_time = Clock::nanos(); // wrap
-    _this->cbfn();
-    _this->overruns += timer_getoverrun(_this->timerid); // even at 50Khz this doesn't stay zero, again demonstrating the limitations
-                                                         // using a realtime linux kernel would help somewhat
-  }
+    struct Stats {
+      uint64_t count,         // ISRs run
+               host_ns,       // Host time spent in the ISR
+               host_ns_max,
+               cycles,        // Estimated MCU cycles spent in the ISR
+               cycles_max,
+               late_ns,       // Time from compare match to dispatch
+               late_ns_max;
+    };
+    const Stats& getStats() { return stats; }
+
+  #else
+
+    intptr_t getID() {
+      return (*(intptr_t*)timerid);
+    }
+
+    static void handler(int sig, siginfo_t *si, void *uc){
+      Timer* _this = (Timer*)si->si_value.sival_ptr;
+      _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
+      _this->avg_error /= 2; //very crude precision analysis (actually within +-500ns usually)
+      _this->start_time = Clock::nanos(); // wrap
+      _this->cbfn();
+      _this->overruns += timer_getoverrun(_this->timerid); // even at 50Khz this doesn't stay zero, again demonstrating the limitations
+                                                           // using a realtime linux kernel would help somewhat
+    }
+
+  #endif // !TIMER_EVENT_LOOP
 
 private:
   bool active;
@@ -73,4 +113,16 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+
+  #ifdef TIMER_EVENT_LOOP
+    static constexpr uint8_t max_timers = 4;
+    static Timer *timers[max_timers];
+    static uint8_t timer_count;
+    static thread_local bool dispatch_thread;
+    static bool dispatching;
+
+    intptr_t id;
+    uint64_t deadline;        // Clock::nanos() of the next compare match
+    Stats stats;
+  #endif
 };
@@ -19,12 +19,18 @@
 #ifdef __PLAT_LINUX__
 
 //#define GPIO_LOGGING // Full GPIO and Positional Logging
+//#define GPIO_LOGGING_CSV // Log GPIO as text instead of a binary trace (much slower)
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
 #include "hardware/IOLoggerCSV.h"
+#include "hardware/IOLoggerBinary.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/Timer.h"
+#if ENABLED(PROBE_ANALOG_SCAN)
+  #include "hardware/HeightSensor.h"
+#endif
 
 #include <stdio.h>
 #include <stdarg.h>
@@ -63,9 +69,16 @@ void simulation_loop() {
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  #if ENABLED(PROBE_ANALOG_SCAN)
+    HeightSensor height_sensor(PROBE_ANALOG_PIN, x_axis, y_axis, z_axis);
+  #endif
 
   #ifdef GPIO_LOGGING
-    IOLoggerCSV logger("all_gpio_log.csv");
+    #ifdef GPIO_LOGGING_CSV
+      IOLoggerCSV logger("all_gpio_log.csv");
+    #else
+      IOLoggerBinary logger("all_gpio_log.bin"); // Convert with buildroot/share/scripts/gpio_trace.py
+    #endif
     Gpio::attachLogger(&logger);
 
     std::ofstream position_log;
@@ -83,6 +96,7 @@ void simulation_loop() {
     y_axis.update();
     z_axis.update();
     extruder0.update();
+    TERN_(PROBE_ANALOG_SCAN, height_sensor.update());
 
     #ifdef GPIO_LOGGING
       if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
@@ -123,6 +137,8 @@ int main() {
   setup();
   for (;;) {
     loop();
+    TERN_(TIMER_EVENT_LOOP, Timer::dispatch());
+    TERN_(HAL_CYCLE_MODEL, CycleModel::task());
     std::this_thread::yield();
   }
 
@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#ifdef HAL_STEP_TRACE
+
+#include "../../module/planner.h"
+#include <fstream>
+
+static std::ofstream block_log;
+static planner_settings_t logged_settings;
+
+// Emit the settings the blocks are checked against, again whenever they change (e.g., M92, M203)
+static void log_settings() {
+  const planner_settings_t &s = planner.settings;
+  if (block_log.tellp() > 0 && !memcmp(&s, &logged_settings, sizeof(s))) return;
+  logged_settings = s;
+
+  auto row = [](const char *name, auto x, auto y, auto z, auto e) {
+    block_log << "# " << name << ": " << x << ", " << y << ", " << z << ", " << e << '\n';
+  };
+  // Columns are steppers, which on a Core machine are not the X/Y/Z axes
+  row("steppers", ANY(CORE_IS_XY, CORE_IS_XZ) ? "A" : "X", ANY(CORE_IS_XY, CORE_IS_YZ) ? "B" : "Y", ANY(CORE_IS_XZ, CORE_IS_YZ) ? "C" : "Z", "E");
+  row("steps_per_mm", s.axis_steps_per_mm[X_AXIS], s.axis_steps_per_mm[Y_AXIS], s.axis_steps_per_mm[Z_AXIS], s.axis_steps_per_mm[E_AXIS]);
+  row("max_feedrate", s.max_feedrate_mm_s[X_AXIS], s.max_feedrate_mm_s[Y_AXIS], s.max_feedrate_mm_s[Z_AXIS], s.max_feedrate_mm_s[E_AXIS]);
+  row("max_acceleration", s.max_acceleration_mm_per_s2[X_AXIS], s.max_acceleration_mm_per_s2[Y_AXIS], s.max_acceleration_mm_per_s2[Z_AXIS], s.max_acceleration_mm_per_s2[E_AXIS]);
+  row("step_pins", X_STEP_PIN, Y_STEP_PIN, Z_STEP_PIN, E0_STEP_PIN);
+  row("dir_pins", X_DIR_PIN, Y_DIR_PIN, Z_DIR_PIN, E0_DIR_PIN);
+  row("invert_dir", INVERT_X_DIR, INVERT_Y_DIR, INVERT_Z_DIR, INVERT_E0_DIR);
+  block_log << "# min_pulse_ns: " << 1000UL * (MINIMUM_STEPPER_PULSE) << '\n'
+            << "# pulse_tick_ns: " << 1000000000UL / (PULSE_TIMER_RATE) << '\n'
+            << "# max_step_rate: " << (MAXIMUM_STEPPER_RATE) << '\n'
+            << "# lin_advance: " << ENABLED(LIN_ADVANCE) << '\n'
+            << "# s_curve: " << ENABLED(S_CURVE_ACCELERATION) << '\n';
+}
+
+void HAL_step_trace_planned(const uint8_t index) {
+  if (!block_log.is_open()) block_log.open("planner_block_log.csv");
+  log_settings();
+
+  const block_t &b = planner.block_buffer[index];
+  block_log << int(index)
+            << ", " << b.steps.a << ", " << b.steps.b << ", " << b.steps.c << ", " << b.steps.e
+            << ", " << int(b.direction_bits) << ", " << b.step_event_count << ", " << int(b.extruder)
+            << ", " << b.millimeters << ", " << SQRT(b.nominal_speed_sqr) << ", " << b.acceleration
+            << ", " << SQRT(b.max_entry_speed_sqr) << '\n';
+  block_log.flush();
+}
+
+// Markers in the GPIO trace: the block index, plus 0x100 when the block is cut short
+void HAL_step_trace_started(const uint8_t index) { Gpio::mark(index); }
+void HAL_step_trace_aborted(const uint8_t index) { Gpio::mark(0x100 | index); }
+
+#endif // HAL_STEP_TRACE
+#endif // __PLAT_LINUX__
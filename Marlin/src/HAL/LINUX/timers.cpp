@@ -57,6 +57,7 @@ bool HAL_timer_interrupt_enabled(const uint8_t timer_num) {
 }
 
 void HAL_timer_set_compare(const uint8_t timer_num, const hal_timer_t compare) {
+  TERN_(HAL_CYCLE_MODEL, CycleModel::Skip skip); // A register write on the target
   timers[timer_num].setCompare(compare);
 }
 
@@ -65,6 +66,7 @@ hal_timer_t HAL_timer_get_compare(const uint8_t timer_num) {
 }
 
 hal_timer_t HAL_timer_get_count(const uint8_t timer_num) {
+  TERN_(HAL_CYCLE_MODEL, CycleModel::Wait wait); // Timed pulses spin on this
   return timers[timer_num].getCount();
 }
 
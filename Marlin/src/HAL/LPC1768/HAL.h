@@ -147,6 +147,9 @@ int freeMemory();
 
 #define HAL_ADC_RESOLUTION     12   // 15 bit maximum, raw temperature is stored as int16_t
 #define HAL_ADC_FILTERED            // Disable oversampling done in Marlin as ADC values already filtered in HAL
+#if ENABLED(ADC_DMA_SCAN)
+  #define HAL_ADC_SCAN              // All channels are sampled in the background (burst mode)
+#endif
 
 using FilteredADC = LPC176x::ADC<ADC_LOWPASS_K_VALUE, ADC_MEDIAN_FILTER_SIZE>;
 extern uint32_t HAL_adc_reading;
@@ -337,6 +337,10 @@ void SPIClass::dmaSend(void *buf, uint16_t length, bool minc) {
   waitSpiTxEnd(_currentSetting->spi_d);
 
   SSP_DMACmd(_currentSetting->spi_d, SSP_DMA_TX, DISABLE);
+
+  // Drop the bytes received while sending, so later reads don't get them
+  while (SSP_GetStatus(_currentSetting->spi_d, SSP_STAT_RXFIFO_NOTEMPTY) == SET)
+    SSP_ReceiveData(_currentSetting->spi_d);
 }
 
 uint16_t SPIClass::read() {
@@ -143,8 +143,219 @@ extern "C" {
 // ADC
 // ------------------------
 
-// TODO: Make sure this doesn't cause any delay
-void HAL_adc_start_conversion(const uint8_t adc_pin) { HAL_adc_result = analogRead(adc_pin); }
+#if ENABLED(ADC_DMA_SCAN)
+
+  /**
+   * Each ADC converts its analog pins continuously in scan mode, and DMA
+   * stores the scans in a circular ring of ADC_SCAN_OVERSAMPLE scans.
+   * A read only averages the ring for the pin, so the temperature ISR
+   * never waits on a conversion. Pins on an ADC with no DMA request
+   * (e.g., ADC2 on STM32F1) fall back to analogRead.
+   */
+
+  #ifndef ADC_SCAN_OVERSAMPLE
+    #define ADC_SCAN_OVERSAMPLE 8
+  #endif
+
+  static const pin_t adc_pins[] = {
+    #if HAS_TEMP_ADC_0
+      TEMP_0_PIN,
+    #endif
+    #if HAS_TEMP_ADC_PROBE
+      TEMP_PROBE_PIN,
+    #endif
+    #if HAS_HEATED_BED
+      TEMP_BED_PIN,
+    #endif
+    #if HAS_TEMP_CHAMBER
+      TEMP_CHAMBER_PIN,
+    #endif
+    #if HAS_TEMP_ADC_1
+      TEMP_1_PIN,
+    #endif
+    #if HAS_TEMP_ADC_2
+      TEMP_2_PIN,
+    #endif
+    #if HAS_TEMP_ADC_3
+      TEMP_3_PIN,
+    #endif
+    #if HAS_TEMP_ADC_4
+      TEMP_4_PIN,
+    #endif
+    #if HAS_TEMP_ADC_5
+      TEMP_5_PIN,
+    #endif
+    #if HAS_TEMP_ADC_6
+      TEMP_6_PIN,
+    #endif
+    #if HAS_TEMP_ADC_7
+      TEMP_7_PIN,
+    #endif
+    #if ENABLED(FILAMENT_WIDTH_SENSOR)
+      FILWIDTH_PIN,
+    #endif
+    #if HAS_ADC_BUTTONS
+      ADC_KEYPAD_PIN,
+    #endif
+    #if HAS_JOY_ADC_X
+      JOY_X_PIN,
+    #endif
+    #if HAS_JOY_ADC_Y
+      JOY_Y_PIN,
+    #endif
+    #if HAS_JOY_ADC_Z
+      JOY_Z_PIN,
+    #endif
+    #if ENABLED(POWER_MONITOR_CURRENT)
+      POWER_MONITOR_CURRENT_PIN,
+    #endif
+    #if ENABLED(POWER_MONITOR_VOLTAGE)
+      POWER_MONITOR_VOLTAGE_PIN,
+    #endif
+    #if ENABLED(PROBE_ANALOG_SCAN)
+      PROBE_ANALOG_PIN,
+    #endif
+  };
+
+  #define ADC_PIN_COUNT COUNT(adc_pins)
+
+  // The ADCs that have a DMA request, with the stream or channel for it
+  typedef decltype(DMA_HandleTypeDef::Instance) dma_instance_t;
+  static const struct { ADC_TypeDef *adc; dma_instance_t dma; uint32_t request; } scan_unit[] = {
+    #if defined(STM32F4xx) || defined(STM32F7xx)
+      { ADC1, DMA2_Stream4, DMA_CHANNEL_0 },
+      #ifdef ADC2
+        { ADC2, DMA2_Stream2, DMA_CHANNEL_1 },
+      #endif
+      #ifdef ADC3
+        { ADC3, DMA2_Stream1, DMA_CHANNEL_2 },
+      #endif
+    #elif defined(STM32F1xx)
+      { ADC1, DMA1_Channel1, 0 },
+      #ifdef ADC3
+        { ADC3, DMA2_Channel5, 0 },
+      #endif
+    #endif
+  };
+
+  #define SCAN_UNITS COUNT(scan_unit)
+
+  static struct {
+    ADC_HandleTypeDef adc;
+    DMA_HandleTypeDef dma;
+    uint8_t count;                                                // Pins in the scan
+    volatile uint16_t ring[(ADC_SCAN_OVERSAMPLE) * ADC_PIN_COUNT]; // Written by DMA
+  } scan[SCAN_UNITS];
+
+  // The ADC and scan rank of each pin. SCAN_UNITS for analogRead.
+  static struct { uint8_t unit, rank; } pin_slot[ADC_PIN_COUNT];
+
+  static void adc_clock_enable(ADC_TypeDef * const adc) {
+    if (adc == ADC1) __HAL_RCC_ADC1_CLK_ENABLE();
+    #ifdef ADC2
+      else if (adc == ADC2) __HAL_RCC_ADC2_CLK_ENABLE();
+    #endif
+    #ifdef ADC3
+      else if (adc == ADC3) __HAL_RCC_ADC3_CLK_ENABLE();
+    #endif
+  }
+
+  static bool adc_scan_start(const uint8_t u) {
+    auto &s = scan[u];
+    adc_clock_enable(scan_unit[u].adc);
+
+    s.adc.Instance = scan_unit[u].adc;
+    ADC_InitTypeDef &init = s.adc.Init;
+    #ifdef STM32F1xx
+      init.ScanConvMode          = ADC_SCAN_ENABLE;
+    #else
+      init.ClockPrescaler        = ADC_CLOCK_SYNC_PCLK_DIV8;
+      init.Resolution            = ADC_RESOLUTION_12B;
+      init.ScanConvMode          = ENABLE;
+      init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_NONE;
+      init.DMAContinuousRequests = ENABLE;
+      init.EOCSelection          = ADC_EOC_SEQ_CONV;
+    #endif
+    init.ContinuousConvMode      = ENABLE;
+    init.DiscontinuousConvMode   = DISABLE;
+    init.ExternalTrigConv        = ADC_SOFTWARE_START;
+    init.DataAlign               = ADC_DATAALIGN_RIGHT;
+    init.NbrOfConversion         = s.count;
+    if (HAL_ADC_Init(&s.adc) != HAL_OK) return false;
+
+    LOOP_L_N(i, ADC_PIN_COUNT) {
+      if (pin_slot[i].unit != u) continue;
+      const PinName pin = digitalPinToPinName(adc_pins[i]);
+      pinmap_pinout(pin, PinMap_ADC);
+      ADC_ChannelConfTypeDef config = { 0 };
+      config.Channel      = STM_PIN_CHANNEL(pinmap_function(pin, PinMap_ADC)); // Channel numbers are the channel constants on F1/F4/F7
+      config.Rank         = pin_slot[i].rank + 1;
+      config.SamplingTime = TERN(STM32F1xx, ADC_SAMPLETIME_239CYCLES_5, ADC_SAMPLETIME_480CYCLES); // Slow, for high impedance thermistors
+      if (HAL_ADC_ConfigChannel(&s.adc, &config) != HAL_OK) return false;
+    }
+
+    #ifdef STM32F1xx
+      if (s.adc.Instance == ADC1) __HAL_RCC_DMA1_CLK_ENABLE(); else __HAL_RCC_DMA2_CLK_ENABLE();
+      HAL_ADCEx_Calibration_Start(&s.adc);
+    #else
+      __HAL_RCC_DMA2_CLK_ENABLE();
+      s.dma.Init.Channel           = scan_unit[u].request;
+      s.dma.Init.FIFOMode          = DMA_FIFOMODE_DISABLE;
+    #endif
+    s.dma.Instance                 = scan_unit[u].dma;
+    s.dma.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+    s.dma.Init.PeriphInc           = DMA_PINC_DISABLE;
+    s.dma.Init.MemInc              = DMA_MINC_ENABLE;
+    s.dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    s.dma.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+    s.dma.Init.Mode                = DMA_CIRCULAR;
+    s.dma.Init.Priority            = DMA_PRIORITY_LOW;
+    if (HAL_DMA_Init(&s.dma) != HAL_OK) return false;
+    __HAL_LINKDMA(&s.adc, DMA_Handle, s.dma);
+
+    return HAL_ADC_Start_DMA(&s.adc, (uint32_t*)s.ring, s.count * (ADC_SCAN_OVERSAMPLE)) == HAL_OK;
+  }
+
+  void HAL_adc_init() {
+    analogReadResolution(HAL_ADC_RESOLUTION);
+
+    // Put each pin in the scan of its ADC
+    LOOP_L_N(i, ADC_PIN_COUNT) {
+      ADC_TypeDef * const adc = (ADC_TypeDef*)pinmap_peripheral(digitalPinToPinName(adc_pins[i]), PinMap_ADC);
+      uint8_t u = 0;
+      while (u < SCAN_UNITS && scan_unit[u].adc != adc) u++;
+      pin_slot[i].unit = u;
+      if (u < SCAN_UNITS) pin_slot[i].rank = scan[u].count++;
+    }
+
+    LOOP_L_N(u, SCAN_UNITS) {
+      if (scan[u].count && !adc_scan_start(u))
+        LOOP_L_N(i, ADC_PIN_COUNT) if (pin_slot[i].unit == u) pin_slot[i].unit = SCAN_UNITS;
+    }
+  }
+
+  void HAL_adc_start_conversion(const uint8_t adc_pin) {
+    LOOP_L_N(i, ADC_PIN_COUNT) {
+      if (adc_pins[i] != adc_pin) continue;
+      const uint8_t u = pin_slot[i].unit;
+      if (u == SCAN_UNITS) break;
+      const uint8_t stride = scan[u].count;
+      const volatile uint16_t *in = &scan[u].ring[pin_slot[i].rank];
+      uint32_t sum = 0;
+      LOOP_L_N(n, ADC_SCAN_OVERSAMPLE) { sum += *in; in += stride; }
+      HAL_adc_result = (sum / (ADC_SCAN_OVERSAMPLE)) >> (12 - (HAL_ADC_RESOLUTION));
+      return;
+    }
+    HAL_adc_result = analogRead(adc_pin);
+  }
+
+#else
+
+  // TODO: Make sure this doesn't cause any delay
+  void HAL_adc_start_conversion(const uint8_t adc_pin) { HAL_adc_result = analogRead(adc_pin); }
+
+#endif
+
 uint16_t HAL_adc_get_result() { return HAL_adc_result; }
 
 // Reset the system (to initiate a firmware flash)
@@ -164,7 +164,11 @@ static inline int freeMemory() {
 // ADC
 //
 
-#define HAL_ANALOG_SELECT(pin) pinMode(pin, INPUT)
+#if ENABLED(ADC_DMA_SCAN)
+  #define HAL_ANALOG_SELECT(pin) pinMode(pin, INPUT_ANALOG) // The scan never reapplies analog mode
+#else
+  #define HAL_ANALOG_SELECT(pin) pinMode(pin, INPUT)
+#endif
 
 #define HAL_ADC_VREF         3.3
 #define HAL_ADC_RESOLUTION  ADC_RESOLUTION // 12
@@ -172,7 +176,12 @@ static inline int freeMemory() {
 #define HAL_READ_ADC()      HAL_adc_result
 #define HAL_ADC_READY()     true
 
-inline void HAL_adc_init() { analogReadResolution(HAL_ADC_RESOLUTION); }
+#if ENABLED(ADC_DMA_SCAN)
+  #define HAL_ADC_SCAN              // All pins are sampled in the background into a DMA ring
+  void HAL_adc_init();
+#else
+  inline void HAL_adc_init() { analogReadResolution(HAL_ADC_RESOLUTION); }
+#endif
 
 void HAL_adc_start_conversion(const uint8_t adc_pin);
 
@@ -46,6 +46,10 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4 hardware."
 #endif
 
+#if ENABLED(ADC_DMA_SCAN) && NOT_TARGET(STM32F1xx, STM32F4xx, STM32F7xx)
+  #error "ADC_DMA_SCAN is currently only supported on STM32F1, STM32F4, and STM32F7 hardware."
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on STM32."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
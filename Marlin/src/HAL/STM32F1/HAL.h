@@ -230,6 +230,9 @@ void HAL_adc_init();
 #define HAL_START_ADC(pin)  HAL_adc_start_conversion(pin)
 #define HAL_READ_ADC()      HAL_adc_result
 #define HAL_ADC_READY()     true
+#if ENABLED(ADC_DMA_SCAN)
+  #define HAL_ADC_SCAN              // All pins are already sampled in the background by DMA
+#endif
 
 void HAL_adc_start_conversion(const uint8_t adc_pin);
 uint16_t HAL_adc_get_result();
@@ -152,6 +152,28 @@
   #include "feature/tmc_util.h"
 #endif
 
+#if ENABLED(TMC_LOAD_TELEMETRY)
+  #include "feature/tmc_telemetry.h"
+#endif
+
+#if HAS_SD_LOOKAHEAD
+  #include "feature/sd_lookahead.h"
+#endif
+
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #include "feature/toolchange_preheat.h"
+#endif
+
+#if EITHER(BOOT_PROFILER, DEFERRED_STARTUP)
+  #include "feature/boot_tasks.h"
+#endif
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #include "feature/idle_tasks.h"
+#else
+  #define IDLE_TASK(T, C) C
+#endif
+
 #if HAS_CUTTER
   #include "feature/spindle_laser.h"
 #endif
@@ -354,6 +376,7 @@ void startOrResumeJob() {
   if (!printingIsPaused()) {
     TERN_(GCODE_REPEAT_MARKERS, repeat.reset());
     TERN_(CANCEL_OBJECTS, cancelable.reset());
+    TERN_(CANCEL_OBJECTS_FAST_SKIP, cancelable.sd_reset());
     TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator = 0);
     #if BOTH(LCD_SET_PROGRESS_MANUALLY, USE_M73_REMAINING_TIME)
       ui.reset_remaining_time();
@@ -720,57 +743,69 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
     if (++idle_depth > 5) SERIAL_ECHOLNPAIR("idle() call depth: ", idle_depth);
   #endif
 
+  TERN_(IDLE_TASK_SCHEDULER, idle_tasks.begin_pass());
+
   // Core Marlin activities
-  manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep));
+  IDLE_TASK(INACTIVITY, manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep)));
 
   // Manage Heaters (and Watchdog)
-  thermalManager.manage_heater();
+  IDLE_TASK(HEATER, thermalManager.manage_heater());
 
   // Max7219 heartbeat, animation, etc
-  TERN_(MAX7219_DEBUG, max7219.idle_tasks());
+  TERN_(MAX7219_DEBUG, IDLE_TASK(MAX7219, max7219.idle_tasks()));
 
   // Return if setup() isn't completed
   if (marlin_state == MF_INITIALIZING) goto IDLE_DONE;
 
+  // Run startup steps left for after setup()
+  TERN_(DEFERRED_STARTUP, if (boot_tasks.pending()) IDLE_TASK(STARTUP, boot_tasks.task()));
+
   // Handle filament runout sensors
-  TERN_(HAS_FILAMENT_SENSOR, runout.run());
+  TERN_(HAS_FILAMENT_SENSOR, IDLE_TASK(RUNOUT, runout.run()));
 
   // Run HAL idle tasks
-  TERN_(HAL_IDLETASK, HAL_idletask());
+  TERN_(HAL_IDLETASK, IDLE_TASK(HAL, HAL_idletask()));
 
   // Check network connection
-  TERN_(HAS_ETHERNET, ethernet.check());
+  TERN_(HAS_ETHERNET, IDLE_TASK(ETHERNET, ethernet.check()));
 
   // Handle Power-Loss Recovery
   #if ENABLED(POWER_LOSS_RECOVERY) && PIN_EXISTS(POWER_LOSS)
-    if (printJobOngoing()) recovery.outage();
+    if (printJobOngoing()) IDLE_TASK(POWER_LOSS, recovery.outage());
   #endif
 
   // Run StallGuard endstop checks
   #if ENABLED(SPI_ENDSTOPS)
     if (endstops.tmc_spi_homing.any
       && TERN1(IMPROVE_HOMING_RELIABILITY, ELAPSED(millis(), sg_guard_period))
-    ) LOOP_L_N(i, 4) // Read SGT 4 times per idle loop
+    ) IDLE_TASK(SPI_ENDSTOPS, LOOP_L_N(i, 4) { // Read SGT 4 times per idle loop
         if (endstops.tmc_spi_homing_check()) break;
+      });
   #endif
 
   // Handle SD Card insert / remove
-  TERN_(SDSUPPORT, card.manage_media());
+  TERN_(SDSUPPORT, IDLE_TASK(MEDIA, card.manage_media()));
+
+  // Read the file ahead of the print, for the layer index, time estimate and tool preheat
+  TERN_(HAS_SD_LOOKAHEAD, IDLE_TASK(SD_LOOKAHEAD, sd_lookahead.task()));
+
+  // Heat the next tool ahead of its tool-change
+  TERN_(TOOLCHANGE_PREHEAT, IDLE_TASK(TOOLCHANGE_PREHEAT, toolchange_preheat.task()));
 
   // Handle USB Flash Drive insert / remove
-  TERN_(USB_FLASH_DRIVE_SUPPORT, Sd2Card::idle());
+  TERN_(USB_FLASH_DRIVE_SUPPORT, IDLE_TASK(USB_DRIVE, Sd2Card::idle()));
 
   // Announce Host Keepalive state (if any)
-  TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
+  TERN_(HOST_KEEPALIVE_FEATURE, IDLE_TASK(KEEPALIVE, gcode.host_keepalive()));
 
   // Update the Print Job Timer state
-  TERN_(PRINTCOUNTER, print_job_timer.tick());
+  TERN_(PRINTCOUNTER, IDLE_TASK(JOB_TIMER, print_job_timer.tick()));
 
   // Update the Beeper queue
-  TERN_(USE_BEEPER, buzzer.tick());
+  TERN_(USE_BEEPER, IDLE_TASK(BUZZER, buzzer.tick()));
 
   // Handle UI input / draw events
-  TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+  IDLE_TASK(UI, TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update()));
 
   // Run i2c Position Encoders
   #if ENABLED(I2C_POSITION_ENCODERS)
@@ -779,7 +814,7 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
     if (planner.has_blocks_queued()) {
       const millis_t ms = millis();
       if (ELAPSED(ms, i2cpem_next_update_ms)) {
-        I2CPEM.update();
+        IDLE_TASK(I2CPEM, I2CPEM.update());
         i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
       }
     }
@@ -788,25 +823,27 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
 
   // Auto-report Temperatures / SD Status
   #if HAS_AUTO_REPORTING
-    if (!gcode.autoreport_paused) {
+    if (!gcode.autoreport_paused) IDLE_TASK(AUTOREPORT, {
       TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
-    }
+      TERN_(TMC_LOAD_TELEMETRY, tmc_telemetry.auto_reporter.tick());
+    });
   #endif
 
   // Update the Průša MMU2
-  TERN_(HAS_PRUSA_MMU2, mmu2.mmu_loop());
+  TERN_(HAS_PRUSA_MMU2, IDLE_TASK(MMU2, mmu2.mmu_loop()));
 
   // Handle Joystick jogging
-  TERN_(POLL_JOG, joystick.inject_jog_moves());
+  TERN_(POLL_JOG, IDLE_TASK(JOYSTICK, joystick.inject_jog_moves()));
 
   // Direct Stepping
-  TERN_(DIRECT_STEPPING, page_manager.write_responses());
+  TERN_(DIRECT_STEPPING, IDLE_TASK(DIRECT_STEPPING, page_manager.write_responses()));
 
   // Update the LVGL interface
-  TERN_(HAS_TFT_LVGL_UI, LV_TASK_HANDLER());
+  TERN_(HAS_TFT_LVGL_UI, IDLE_TASK(LVGL, LV_TASK_HANDLER()));
 
   IDLE_DONE:
+  TERN_(IDLE_TASK_SCHEDULER, idle_tasks.end_pass());
   TERN_(MARLIN_DEV_MODE, idle_depth--);
   return;
 }
@@ -887,7 +924,7 @@ void minkill(const bool steppers_off/*=false*/) {
 void stop() {
   thermalManager.disable_all_heaters(); // 'unpause' taken care of in here
 
-  print_job_timer.stop();
+  print_job_timer.halt();
 
   #if ENABLED(PROBING_FANS_OFF)
     if (thermalManager.fans_paused) thermalManager.set_fans_paused(false); // put things back the way they were
@@ -978,11 +1015,14 @@ void setup() {
 
   tmc_standby_setup();  // TMC Low Power Standby pins must be set early or they're not usable
 
-  #if ENABLED(MARLIN_DEV_MODE)
+  #if EITHER(MARLIN_DEV_MODE, BOOT_PROFILER)
     auto log_current_ms = [&](PGM_P const msg) {
-      SERIAL_ECHO_START();
-      SERIAL_CHAR('['); SERIAL_ECHO(millis()); SERIAL_ECHOPGM("] ");
-      SERIAL_ECHOLNPGM_P(msg);
+      TERN_(BOOT_PROFILER, boot_tasks.step(msg));
+      #if ENABLED(MARLIN_DEV_MODE)
+        SERIAL_ECHO_START();
+        SERIAL_CHAR('['); SERIAL_ECHO(millis()); SERIAL_ECHOPGM("] ");
+        SERIAL_ECHOLNPGM_P(msg);
+      #endif
     };
     #define SETUP_LOG(M) log_current_ms(PSTR(M))
   #else
@@ -990,6 +1030,14 @@ void setup() {
   #endif
   #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
 
+  // Steps the host doesn't need to wait for may be left for idle()
+  #if ENABLED(DEFERRED_STARTUP)
+    #define SETUP_DEFER(C) boot_tasks.defer(PSTR(STRINGIFY(C)), []{ C; })
+  #else
+    #define SETUP_DEFER(C) SETUP_RUN(C)
+  #endif
+
+  TERN_(BOOT_PROFILER, boot_tasks.step(PSTR("MYSERIAL0.begin(BAUDRATE)")));
   MYSERIAL0.begin(BAUDRATE);
   millis_t serial_connect_timeout = millis() + 1000UL;
   while (!MYSERIAL0.connected() && PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
@@ -1175,7 +1223,12 @@ void setup() {
 
   SETUP_RUN(thermalManager.init());   // Initialize temperature loop
 
-  SETUP_RUN(print_job_timer.init());  // Initial setup of print job timer
+  #if BOTH(DEFERRED_STARTUP, PRINTCOUNTER)
+    SETUP_RUN(print_job_timer.init(false));     // Initial setup of print job timer...
+    SETUP_DEFER(print_job_timer.ensureLoaded()); // ...with statistics loaded later, or by start()
+  #else
+    SETUP_RUN(print_job_timer.init());  // Initial setup of print job timer
+  #endif
 
   SETUP_RUN(endstops.init());         // Init endstops and pullups
 
@@ -1402,7 +1455,7 @@ void setup() {
   #endif
 
   #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF)
-    SETUP_RUN(test_tmc_connection(true, true, true, true));
+    SETUP_DEFER(test_tmc_connection(true, true, true, true));
   #endif
 
   #if HAS_PRUSA_MMU2
@@ -1450,6 +1503,7 @@ void setup() {
 
   marlin_state = MF_RUNNING;
 
+  TERN_(BOOT_PROFILER, boot_tasks.done());
   SETUP_LOG("setup() completed.");
 }
 
@@ -1468,7 +1522,13 @@ void setup() {
  */
 void loop() {
   do {
-    idle();
+    #if ENABLED(IDLE_TASK_SCHEDULER)
+      idle_tasks.loop_pass = true;      // Only this pass can let loop() plan more moves
+      idle();
+      idle_tasks.loop_pass = false;
+    #else
+      idle();
+    #endif
 
     #if ENABLED(SDSUPPORT)
       if (card.flag.abort_sd_printing) abortSDPrinting();
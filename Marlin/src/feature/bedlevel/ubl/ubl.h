@@ -74,6 +74,12 @@ private:
   static bool g29_parameter_parsing() _O0;
   static void shift_mesh_height();
   static void probe_entire_mesh(const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) _O0;
+  #if BOTH(HAS_BED_PROBE, PROBE_ANALOG_SCAN)
+    static void scan_entire_mesh(const bool do_ubl_mesh_map) _O0;
+  #endif
+  #if BOTH(HAS_BED_PROBE, UBL_ORDERED_PROBING)
+    static mesh_index_pair next_planned_mesh_point(uint8_t &plan_index, const xy_bool_t &flip);
+  #endif
   static void tilt_mesh_based_on_3pts(const float &z1, const float &z2, const float &z3);
   static void tilt_mesh_based_on_probed_grid(const bool do_ubl_mesh_map);
   static bool smart_fill_one(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir);
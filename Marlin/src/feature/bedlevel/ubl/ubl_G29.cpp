@@ -38,6 +38,10 @@
 #include "../../../gcode/gcode.h"
 #include "../../../libs/least_squares_fit.h"
 
+#if ENABLED(PROBE_ANALOG_SCAN)
+  #include "../../probe_scan.h"
+#endif
+
 #if HAS_MULTI_HOTEND
   #include "../../../module/tool_change.h"
 #endif
@@ -724,9 +728,75 @@ void unified_bed_leveling::shift_mesh_height() {
 }
 
 #if HAS_BED_PROBE
+
+  #if ENABLED(UBL_ORDERED_PROBING)
+    /**
+     * Step along a serpentine walk of the mesh, beginning at the corner given by 'flip',
+     * and return the next invalid point the probe can reach. Consecutive points of the
+     * walk are neighbors, so the whole plan is fixed by the starting corner.
+     */
+    mesh_index_pair unified_bed_leveling::next_planned_mesh_point(uint8_t &plan_index, const xy_bool_t &flip) {
+      mesh_index_pair next;
+      next.invalidate();
+      while (plan_index < GRID_MAX_POINTS) {
+        const uint8_t row = plan_index / (GRID_MAX_POINTS_X), col = plan_index - row * (GRID_MAX_POINTS_X);
+        plan_index++;
+        xy_int8_t pos = { int8_t(TEST(row, 0) ? (GRID_MAX_POINTS_X) - 1 - col : col), int8_t(row) };
+        if (flip.x) pos.x = (GRID_MAX_POINTS_X) - 1 - pos.x;
+        if (flip.y) pos.y = (GRID_MAX_POINTS_Y) - 1 - pos.y;
+        if (!isnan(z_values[pos.x][pos.y])) continue;
+        next.pos = pos;
+        if (probe.can_reach(next.meshpos())) return next;
+      }
+      next.invalidate();
+      return next;
+    }
+  #endif
+
+  #if ENABLED(PROBE_ANALOG_SCAN)
+    /**
+     * Sweep the height sensor along each row of the mesh, alternating direction,
+     * and fill in the invalid points the probe can reach.
+     */
+    void unified_bed_leveling::scan_entire_mesh(const bool do_ubl_mesh_map) {
+      float row_z[GRID_MAX_POINTS_X];
+      LOOP_L_N(j, GRID_MAX_POINTS_Y) {
+        if (do_ubl_mesh_map) display_map(g29_map_type);
+
+        SERIAL_ECHOLNPAIR("Scanning mesh row ", int(j + 1), "/", GRID_MAX_POINTS_Y, ".");
+        TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), int(j + 1), int(GRID_MAX_POINTS_Y)));
+
+        // The reachable span of the row
+        int8_t lo = -1, hi = -1;
+        LOOP_L_N(i, GRID_MAX_POINTS_X)
+          if (probe.can_reach(mesh_index_to_xpos(i), mesh_index_to_ypos(j))) { if (lo < 0) lo = i; hi = i; }
+        if (lo < 0) continue;
+
+        const bool rev = TEST(j, 0);
+        const xy_pos_t start = { mesh_index_to_xpos(rev ? hi : lo), mesh_index_to_ypos(j) },
+                       end = { mesh_index_to_xpos(rev ? lo : hi), mesh_index_to_ypos(j) };
+        if (lo == hi) {
+          // A single point can't be swept, so probe it
+          if (isnan(z_values[lo][j])) row_z[0] = probe.probe_at_point(start, PROBE_PT_RAISE, g29_verbose_level);
+        }
+        else if (probe_scan.scan_row(start, end, hi - lo + 1, row_z)) break;
+
+        for (int8_t i = lo; i <= hi; i++) {
+          if (!isnan(z_values[i][j])) continue;
+          const float measured_z = row_z[rev ? hi - i : i - lo];
+          z_values[i][j] = measured_z;
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(i, j, measured_z));
+        }
+        SERIAL_FLUSH(); // Prevent host M105 buffer overrun.
+      }
+    }
+  #endif
+
   /**
    * Probe all invalidated locations of the mesh that can be reached by the probe.
    * This attempts to fill in locations closest to the nozzle's start location first.
+   * With UBL_ORDERED_PROBING the points are visited in a serpentine walk that starts
+   * at the mesh corner nearest the probe.
    */
   void unified_bed_leveling::probe_entire_mesh(const xy_pos_t &nearby, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) {
     probe.deploy(); // Deploy before ui.capture() to allow for PAUSE_BEFORE_DEPLOY_STOW
@@ -734,10 +804,28 @@ void unified_bed_leveling::shift_mesh_height() {
     TERN_(HAS_LCD_MENU, ui.capture());
 
     save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
-    uint8_t count = GRID_MAX_POINTS;
 
     mesh_index_pair best;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::MESH_START));
+
+    #if ENABLED(PROBE_ANALOG_SCAN)
+
+    UNUSED(do_furthest); UNUSED(best);
+    scan_entire_mesh(do_ubl_mesh_map);
+
+    #else
+
+    uint8_t count = GRID_MAX_POINTS;
+
+    #if ENABLED(UBL_ORDERED_PROBING)
+      // Plan the walk once, starting from the corner nearest the probe
+      const xy_pos_t ref = nearby + probe.offset_xy;
+      const xy_bool_t flip = { ref.x > 0.5f * ((MESH_MIN_X) + (MESH_MAX_X)), ref.y > 0.5f * ((MESH_MIN_Y) + (MESH_MAX_Y)) };
+      uint8_t plan_index = 0;
+      mesh_index_pair next;
+      if (!do_furthest) next = next_planned_mesh_point(plan_index, flip);
+    #endif
+
     do {
       if (do_ubl_mesh_map) display_map(g29_map_type);
 
@@ -757,16 +845,27 @@ void unified_bed_leveling::shift_mesh_height() {
         }
       #endif
 
+      ProbePtRaise raise_after = stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE;
+
+      #if ENABLED(UBL_ORDERED_PROBING)
+        if (!do_furthest) {
+          best = next;
+          next = next_planned_mesh_point(plan_index, flip);
+          #if HAS_ADJACENT_PROBE_CLEARANCE
+            // Unreachable points break the walk, so check for a true neighbor
+            if (!stow_probe && next.valid() && ABS(next.pos.x - best.pos.x) <= 1 && ABS(next.pos.y - best.pos.y) <= 1)
+              raise_after = PROBE_PT_NEAR_RAISE;
+          #endif
+        }
+        else
+      #endif
       best = do_furthest
         ? find_furthest_invalid_mesh_point()
         : find_closest_mesh_point_of_type(INVALID, nearby, true);
 
       if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::PROBE_START));
-        const float measured_z = probe.probe_at_point(
-                      best.meshpos(),
-                      stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, g29_verbose_level
-                    );
+        const float measured_z = probe.probe_at_point(best.meshpos(), raise_after, g29_verbose_level);
         z_values[best.pos.x][best.pos.y] = measured_z;
         #if ENABLED(EXTENSIBLE_UI)
           ExtUI::onMeshUpdate(best.pos, ExtUI::PROBE_FINISH);
@@ -777,6 +876,8 @@ void unified_bed_leveling::shift_mesh_height() {
 
     } while (best.pos.x >= 0 && --count);
 
+    #endif // !PROBE_ANALOG_SCAN
+
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::MESH_FINISH));
 
     // Release UI during stow to allow for PAUSE_BEFORE_DEPLOY_STOW
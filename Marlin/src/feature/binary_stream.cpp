@@ -28,7 +28,11 @@
 #include "binary_stream.h"
 
 char* SDFileTransferProtocol::Packet::Open::data = nullptr;
-size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
+size_t SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
+#if ENABLED(BINARY_STREAM_COMPRESSION)
+  static uint8_t decode_buffer[512]; // One SD sector
+  heatshrink_sink SDFileTransferProtocol::decode_sink = { decode_buffer, sizeof(decode_buffer), 0, write_sector };
+#endif
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
 
 BinaryStream binaryStream[NUM_SERIAL];
@@ -39,7 +39,6 @@ inline int bs_read_serial(const uint8_t index) {
 
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   static heatshrink_decoder hsd;
-  static uint8_t decode_buffer[512] = {};
 #endif
 
 class SDFileTransferProtocol  {
@@ -69,34 +68,27 @@ private:
       if (!card.isFileOpen()) return false;
     }
     transfer_active = true;
-    data_waiting = 0;
-    TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_reset(&hsd));
+    #if ENABLED(BINARY_STREAM_COMPRESSION)
+      decode_sink.count = 0;
+      heatshrink_decoder_reset(&hsd);
+    #endif
     return true;
   }
 
+  #if ENABLED(BINARY_STREAM_COMPRESSION)
+    // The decoder fills a whole sector before it's written, so
+    // the SD library can write it without going through its cache
+    static bool write_sector(heatshrink_sink *sink) {
+      if (!dummy_transfer && card.write(sink->buf, sink->count) < 0) return false;
+      sink->count = 0;
+      return true;
+    }
+  #endif
+
   static bool file_write(char* buffer, const size_t length) {
     #if ENABLED(BINARY_STREAM_COMPRESSION)
-      if (compression) {
-        size_t total_processed = 0, processed_count = 0;
-        HSD_poll_res presult;
-
-        while (total_processed < length) {
-          heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
-          total_processed += processed_count;
-          do {
-            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
-            data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
-              if (!dummy_transfer)
-                if (card.write(decode_buffer, data_waiting) < 0) {
-                  return false;
-                }
-              data_waiting = 0;
-            }
-          } while (presult == HSDR_POLL_MORE);
-        }
-        return true;
-      }
+      if (compression)  // Decode the whole packet straight out of the receive buffer
+        return heatshrink_decoder_inflate(&hsd, reinterpret_cast<uint8_t*>(buffer), length, &decode_sink) == HSDR_POLL_EMPTY;
     #endif
     return (dummy_transfer || card.write(buffer, length) >= 0);
   }
@@ -105,10 +97,7 @@ private:
     if (!dummy_transfer) {
       #if ENABLED(BINARY_STREAM_COMPRESSION)
         // flush any buffered data
-        if (data_waiting) {
-          if (card.write(decode_buffer, data_waiting) < 0) return false;
-          data_waiting = 0;
-        }
+        if (decode_sink.count && !write_sector(&decode_sink)) return false;
       #endif
       card.closefile();
       card.release();
@@ -131,7 +120,8 @@ private:
 
   enum class FileTransfer : uint8_t { QUERY, OPEN, CLOSE, WRITE, ABORT };
 
-  static size_t data_waiting, transfer_timeout, idle_timeout;
+  static size_t transfer_timeout, idle_timeout;
+  TERN_(BINARY_STREAM_COMPRESSION, static heatshrink_sink decode_sink);
   static bool transfer_active, dummy_transfer, compression;
 
 public:
@@ -0,0 +1,124 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/boot_tasks.cpp - Profile the steps of setup() and run deferred steps
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if EITHER(BOOT_PROFILER, DEFERRED_STARTUP)
+
+#include "boot_tasks.h"
+
+BootTasks boot_tasks;
+
+#if ENABLED(BOOT_PROFILER)
+
+  BootTasks::step_t BootTasks::steps[BOOT_PROFILER_STEPS];
+  uint8_t BootTasks::step_count; // = 0
+  bool BootTasks::finished; // = false
+  millis_t BootTasks::setup_ms; // = 0
+
+  BootTasks::step_t* BootTasks::add_step(PGM_P const name, const millis_t ms) {
+    if (step_count >= COUNT(steps)) return nullptr;
+    step_t &s = steps[step_count++];
+    s.name = name;
+    s.start_ms = ms;
+    s.duration_ms = 0;
+    s.deferred = finished;
+    return &s;
+  }
+
+  void BootTasks::end_step(const millis_t ms) {
+    if (step_count) {
+      step_t &last = steps[step_count - 1];
+      last.duration_ms = ms - last.start_ms;
+    }
+  }
+
+  void BootTasks::step(PGM_P const name) {
+    if (finished) return;
+    const millis_t ms = millis();
+    end_step(ms);
+    add_step(name, ms);
+  }
+
+  void BootTasks::done() {
+    setup_ms = millis();
+    end_step(setup_ms);
+    finished = true;
+  }
+
+  void BootTasks::report() {
+    SERIAL_ECHOLNPGM("Boot profile (start ms, duration ms):");
+    LOOP_L_N(i, step_count) {
+      const step_t &s = steps[i];
+      SERIAL_ECHOPAIR(" ", s.start_ms, " ", s.duration_ms);
+      if (s.deferred) SERIAL_ECHOPGM(" (deferred)");
+      SERIAL_CHAR(' ');
+      SERIAL_ECHOLNPGM_P(s.name);
+    }
+    if (step_count >= COUNT(steps)) SERIAL_ECHOLNPGM(" (log full)");
+    if (finished) SERIAL_ECHOLNPAIR("setup() completed at ", setup_ms, "ms");
+    #if ENABLED(DEFERRED_STARTUP)
+      if (pending()) SERIAL_ECHOLNPAIR("Deferred steps waiting: ", task_count);
+    #endif
+  }
+
+#endif // BOOT_PROFILER
+
+#if ENABLED(DEFERRED_STARTUP)
+
+  BootTasks::task_t BootTasks::tasks[DEFERRED_STARTUP_TASKS];
+  uint8_t BootTasks::task_index, BootTasks::task_count; // = 0
+
+  // Queue a step, or run it right away if the queue is full
+  void BootTasks::defer(PGM_P const name, const task_fn_t fn) {
+    const uint8_t i = task_index + task_count;
+    if (i >= COUNT(tasks)) {
+      TERN_(BOOT_PROFILER, step(name));
+      fn();
+      return;
+    }
+    tasks[i].name = name;
+    tasks[i].fn = fn;
+    task_count++;
+  }
+
+  void BootTasks::task() {
+    if (!task_count) return;
+    const task_t &t = tasks[task_index++];
+    task_count--;
+    #if ENABLED(BOOT_PROFILER)
+      const millis_t ms = millis();
+      step_t * const s = add_step(t.name, ms);
+      t.fn();
+      if (s) s->duration_ms = millis() - ms;
+    #else
+      t.fn();
+    #endif
+  }
+
+#endif // DEFERRED_STARTUP
+
+#endif // BOOT_PROFILER || DEFERRED_STARTUP
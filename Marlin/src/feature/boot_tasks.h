@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/boot_tasks.h - Profile the steps of setup() and run deferred steps
+ *
+ * With BOOT_PROFILER each step logged by setup() is timestamped, so M101 can
+ * report how long each one took. With DEFERRED_STARTUP, steps that the host
+ * doesn't need to wait for are queued and run from idle() after setup().
+ */
+
+#include "../inc/MarlinConfig.h"
+
+// Deferred steps that can be queued
+#define DEFERRED_STARTUP_TASKS 4
+
+class BootTasks {
+  public:
+    typedef void (*task_fn_t)();
+
+    #if ENABLED(BOOT_PROFILER)
+      static void step(PGM_P const name);   // End the running step and start the named one
+      static void done();                   // End the last step of setup()
+      static void report();
+    #endif
+
+    #if ENABLED(DEFERRED_STARTUP)
+      static void defer(PGM_P const name, const task_fn_t fn);
+      static void task();                   // Run the next deferred step
+      static inline bool pending() { return task_count > 0; }
+    #endif
+
+  private:
+    #if ENABLED(BOOT_PROFILER)
+      typedef struct {
+        PGM_P name;
+        millis_t start_ms, duration_ms;
+        bool deferred;
+      } step_t;
+      static step_t steps[BOOT_PROFILER_STEPS];
+      static uint8_t step_count;
+      static bool finished;
+      static millis_t setup_ms;             // Time from reset to the end of setup()
+      static step_t* add_step(PGM_P const name, const millis_t ms);
+      static void end_step(const millis_t ms);
+    #endif
+
+    #if ENABLED(DEFERRED_STARTUP)
+      typedef struct {
+        PGM_P name;
+        task_fn_t fn;
+      } task_t;
+      static task_t tasks[DEFERRED_STARTUP_TASKS];
+      static uint8_t task_index, task_count;
+    #endif
+};
+
+extern BootTasks boot_tasks;
@@ -31,14 +31,14 @@ CancelObject cancelable;
 
 int8_t CancelObject::object_count, // = 0
        CancelObject::active_object = -1;
-uint32_t CancelObject::canceled; // = 0x0000
+uint8_t CancelObject::canceled[(CANCEL_OBJECTS_COUNT + 7) / 8]; // = { 0 }
 bool CancelObject::skipping; // = false
 
 void CancelObject::set_active_object(const int8_t obj) {
   active_object = obj;
-  if (WITHIN(obj, 0, 31)) {
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_COUNT - 1)) {
     if (obj >= object_count) object_count = obj + 1;
-    skipping = TEST(canceled, obj);
+    skipping = is_canceled(obj);
   }
   else
     skipping = false;
@@ -52,15 +52,15 @@ void CancelObject::set_active_object(const int8_t obj) {
 }
 
 void CancelObject::cancel_object(const int8_t obj) {
-  if (WITHIN(obj, 0, 31)) {
-    SBI(canceled, obj);
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_COUNT - 1)) {
+    SBI(canceled[obj >> 3], obj & 7);
     if (obj == active_object) skipping = true;
   }
 }
 
 void CancelObject::uncancel_object(const int8_t obj) {
-  if (WITHIN(obj, 0, 31)) {
-    CBI(canceled, obj);
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_COUNT - 1)) {
+    CBI(canceled[obj >> 3], obj & 7);
     if (obj == active_object) skipping = false;
   }
 }
@@ -69,13 +69,165 @@ void CancelObject::report() {
   if (active_object >= 0)
     SERIAL_ECHO_MSG("Active Object: ", active_object);
 
-  if (canceled) {
-    SERIAL_ECHO_START();
-    SERIAL_ECHOPGM("Canceled:");
-    for (int i = 0; i < object_count; i++)
-      if (TEST(canceled, i)) { SERIAL_CHAR(' '); SERIAL_ECHO(i); }
-    SERIAL_EOL();
-  }
+  bool any = false;
+  for (int i = 0; i < object_count; i++)
+    if (is_canceled(i)) {
+      if (!any) { SERIAL_ECHO_START(); SERIAL_ECHOPGM("Canceled:"); any = true; }
+      SERIAL_CHAR(' '); SERIAL_ECHO(i);
+    }
+  if (any) SERIAL_EOL();
 }
 
+#if ENABLED(CANCEL_OBJECTS_FAST_SKIP)
+
+  //
+  // The SD reader runs ahead of the command queue, so it keeps its own idea
+  // of the current object. Moves of a canceled object are dropped before they
+  // reach the queue, and the last E and F they would have set are passed on
+  // to the next line that is kept.
+  //
+  static int8_t sd_object = -1;             // Object at the SD read position
+  static bool sd_relative_e,
+              sd_m486_labels,               // The file has M486 S, so ignore label comments
+              sd_label_made;                // The line was made from a label comment
+  static char sd_e_word[16], sd_f_word[12]; // Values from the dropped moves, if any
+  static char sd_comment[24];               // Start of a comment line, to find a label prefix
+  static uint8_t sd_comment_len,
+                 sd_label_at;               // Where the label name starts, 0 if not a label
+  typedef struct { uint32_t hash; uint8_t len; } label_t;
+  static label_t sd_label;                  // The name being read, hashed a character at a time
+  static label_t label[CANCEL_OBJECTS_COUNT]; // Slicer labels seen so far, by length and hash
+  static uint8_t label_count;
+
+  void CancelObject::sd_reset() {
+    sd_object = -1;
+    sd_relative_e = sd_m486_labels = sd_label_made = false;
+    sd_e_word[0] = sd_f_word[0] = '\0';
+    sd_comment_len = sd_label_at = label_count = 0;
+  }
+
+  // Copy the value of a word, if it's on the line
+  static void copy_word(const char *p, const char code, char * const dst, const uint8_t size) {
+    p = strchr(p, code);
+    if (!p) return;
+    uint8_t i = 0;
+    for (++p; i < size - 1 && (NUMERIC(*p) || *p == '-' || *p == '.'); ++p) dst[i++] = *p;
+    dst[i] = '\0';
+  }
+
+  /**
+   * Look at a line read from SD, before it goes into the queue.
+   * Return true if it's a move of a canceled object and should be dropped.
+   */
+  bool CancelObject::sd_skip_line(const char * const cmd) {
+    if (sd_label_made) { sd_label_made = false; return false; }
+
+    const char *p = cmd;
+    while (*p == ' ') ++p;
+    if (*p == 'N') { while (*p && *p != ' ') ++p; while (*p == ' ') ++p; }
+
+    const char letter = *p;
+    if (letter != 'G' && letter != 'M') return false;
+    const int code = atoi(p + 1);
+    do ++p; while (NUMERIC(*p));   // Past the command, so 'G1' isn't a word
+
+    if (letter == 'M') switch (code) {
+      case 82: sd_relative_e = false; break;
+      case 83: sd_relative_e = true; break;
+      case 486: {
+        const char * const s = strchr(p, 'S');
+        if (s) { sd_object = atoi(s + 1); sd_m486_labels = true; }
+      } break;
+    }
+    else switch (code) {
+      case 0: case 1: case 2: case 3:
+        if (!is_canceled(sd_object)) break;
+        if (!sd_relative_e) copy_word(p, 'E', sd_e_word, sizeof(sd_e_word));
+        copy_word(p, 'F', sd_f_word, sizeof(sd_f_word));
+        return true;
+      case 90: sd_relative_e = false; break;
+      case 91: sd_relative_e = true; break;
+      case 92: if (strchr(p, 'E')) sd_e_word[0] = '\0'; break;
+    }
+    return false;
+  }
+
+  /**
+   * Take a comment character as it's read. Only the start of the comment is
+   * kept, to find a label prefix. The name after the prefix is hashed as it
+   * streams in, so labels that differ late in a long name stay apart.
+   */
+  void CancelObject::sd_comment_char(const char c) {
+    if (!sd_comment_len && c == ' ') return;  // Skip leading spaces
+
+    if (sd_label_at) {
+      sd_label.hash = (sd_label.hash ^ uint8_t(c)) * 0x01000193;
+      if (sd_label.len < 255) ++sd_label.len;
+    }
+
+    if (sd_comment_len < sizeof(sd_comment) - 1) {
+      sd_comment[sd_comment_len++] = c;
+      if (!sd_label_at) {
+        sd_comment[sd_comment_len] = '\0';
+        if ( (sd_comment_len == 5 && !strcmp_P(sd_comment, PSTR("MESH:")))
+          || (sd_comment_len == 16 && !strcmp_P(sd_comment, PSTR("printing object ")))
+        ) {
+          sd_label_at = sd_comment_len;
+          sd_label = { 0x811C9DC5, 0 };       // 32-bit FNV-1a
+        }
+      }
+    }
+  }
+
+  // Object index for the label just read, in order of first appearance.
+  // Labels must match in length and 32-bit FNV-1a hash to be the same object.
+  static int8_t label_index() {
+    LOOP_L_N(i, label_count) if (label[i].hash == sd_label.hash && label[i].len == sd_label.len) return i;
+    if (label_count >= CANCEL_OBJECTS_COUNT) return -1;
+    label[label_count] = sd_label;
+    return label_count++;
+  }
+
+  /**
+   * Turn a slicer's object label comment into M486 S, for files without M486.
+   *   Cura:         ;MESH:<name> and ;MESH:NONMESH
+   *   PrusaSlicer:  ; printing object <name> and ; stop printing object <name>
+   */
+  bool CancelObject::sd_label_comment(char * const cmd) {
+    const uint8_t len = sd_comment_len, at = sd_label_at;
+    sd_comment_len = sd_label_at = 0;
+    if (!len || sd_m486_labels) return false;
+    sd_comment[len] = '\0';
+
+    int8_t obj = -1;
+    if (at == 5) {
+      if (sd_label.len != 7 || strcmp_P(sd_comment + 5, PSTR("NONMESH"))) obj = label_index();
+    }
+    else if (at == 16)
+      obj = label_index();
+    else if (strncmp_P(sd_comment, PSTR("stop printing object"), 20))
+      return false;
+
+    sd_object = obj;
+    sd_label_made = true;
+    sprintf_P(cmd, PSTR("M486 S%i"), int(obj));
+    return true;
+  }
+
+  // Lines needed to pass on the E and F of dropped moves
+  uint8_t CancelObject::sd_flush_lines() { return !!sd_e_word[0] + !!sd_f_word[0]; }
+
+  void CancelObject::sd_get_flush_line(char * const cmd) {
+    if (sd_e_word[0]) {
+      sprintf_P(cmd, PSTR("G92 E%s"), sd_e_word);
+      sd_e_word[0] = '\0';
+    }
+    else {
+      sprintf_P(cmd, PSTR("G1 F%s"), sd_f_word);
+      sd_f_word[0] = '\0';
+    }
+  }
+
+#endif // CANCEL_OBJECTS_FAST_SKIP
+
 #endif // CANCEL_OBJECTS
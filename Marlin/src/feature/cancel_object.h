@@ -21,21 +21,31 @@
  */
 #pragma once
 
-#include <stdint.h>
+#include "../inc/MarlinConfig.h"
 
 class CancelObject {
 public:
   static bool skipping;
   static int8_t object_count, active_object;
-  static uint32_t canceled;
+  static uint8_t canceled[(CANCEL_OBJECTS_COUNT + 7) / 8];
   static void set_active_object(const int8_t obj);
   static void cancel_object(const int8_t obj);
   static void uncancel_object(const int8_t obj);
   static void report();
-  static inline bool is_canceled(const int8_t obj) { return TEST(canceled, obj); }
+  static inline bool is_canceled(const int8_t obj) { return WITHIN(obj, 0, CANCEL_OBJECTS_COUNT - 1) && TEST(canceled[obj >> 3], obj & 7); }
   static inline void clear_active_object() { set_active_object(-1); }
   static inline void cancel_active_object() { cancel_object(active_object); }
-  static inline void reset() { canceled = 0x0000; object_count = 0; clear_active_object(); }
+  static inline void reset() { ZERO(canceled); object_count = 0; clear_active_object(); }
+
+  #if ENABLED(CANCEL_OBJECTS_FAST_SKIP)
+    // Follow object labels as lines are read from SD, dropping the moves of canceled objects
+    static void sd_reset();
+    static bool sd_skip_line(const char * const cmd);
+    static void sd_comment_char(const char c);
+    static bool sd_label_comment(char * const cmd);
+    static uint8_t sd_flush_lines();
+    static void sd_get_flush_line(char * const cmd);
+  #endif
 };
 
 extern CancelObject cancelable;
@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/heatshrink_gcode.h - Decoder for heatshrink-compressed G-code
+ *
+ * Compressed bytes are sunk in pieces no larger than the decoder input
+ * buffer, only after all decoded output has been read, so the decoder
+ * always takes the whole piece.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../libs/heatshrink/heatshrink_decoder.h"
+
+class GcodeInflater {
+  public:
+    static constexpr size_t sink_size = HEATSHRINK_STATIC_INPUT_BUFFER_SIZE;
+
+    void reset() {
+      heatshrink_decoder_reset(&hsd);
+      out_count = out_index = 0;
+    }
+
+    // Return true if a decoded byte is ready, decoding more of the input if needed
+    bool has_output() {
+      if (out_index < out_count) return true;
+      size_t count;
+      heatshrink_decoder_poll(&hsd, out_buf, sizeof(out_buf), &count);
+      out_count = count;
+      out_index = 0;
+      return count > 0;
+    }
+
+    // Sink up to sink_size compressed bytes. Only call when has_output() is false.
+    void sink(uint8_t * const buf, const size_t len) {
+      size_t count;
+      heatshrink_decoder_sink(&hsd, buf, len, &count);
+    }
+
+    // Get the next decoded byte, or -1 if more input is needed
+    int16_t read() { return has_output() ? out_buf[out_index++] : -1; }
+
+  private:
+    heatshrink_decoder hsd;
+    uint8_t out_buf[16], out_count, out_index;
+};
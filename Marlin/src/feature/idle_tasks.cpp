@@ -0,0 +1,119 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/idle_tasks.cpp - Cooperative scheduling of the tasks run by idle()
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+#include "idle_tasks.h"
+#include "../module/planner.h"
+#include "../gcode/queue.h"
+
+IdleTasks idle_tasks;
+
+IdleTasks::task_state_t IdleTasks::state[IDLE_TASK_COUNT];
+bool IdleTasks::loop_pass; // = false
+millis_t IdleTasks::pass_ms;
+uint32_t IdleTasks::now_us, IdleTasks::run_us, IdleTasks::pass_start_us;
+uint8_t IdleTasks::depth; // = 0
+bool IdleTasks::starving;
+
+#define _TASK_NAME(N,...) static PGMSTR(idle_task_##N, #N);
+IDLE_TASK_LIST(_TASK_NAME)
+
+#define _TASK_INFO(N,P,MS,US) { idle_task_##N, IdleTasks::P, MS, US },
+static const IdleTasks::task_info_t task_info[] PROGMEM = { IDLE_TASK_LIST(_TASK_INFO) };
+
+#define TASK_PRIORITY(T) IdleTasks::Priority(pgm_read_byte(&task_info[T].priority))
+#define TASK_PERIOD(T)   pgm_read_word(&task_info[T].period_ms)
+#define TASK_BUDGET(T)   pgm_read_word(&task_info[T].budget_us)
+#define TASK_NAME(T)     (PGM_P)pgm_read_ptr(&task_info[T].name)
+
+void IdleTasks::begin_pass() {
+  pass_ms = millis();
+  now_us = micros();
+  if (depth++) return;  // A nested pass keeps the budget of the outer one
+  pass_start_us = now_us;
+  // Moves are running out while there are commands to plan them from.
+  // Calls from inside a command can't get to the next one by returning sooner.
+  starving = loop_pass
+          && planner.has_blocks_queued()
+          && planner.movesplanned() < (BLOCK_BUFFER_SIZE) / 2
+          && queue.has_commands_queued();
+}
+
+bool IdleTasks::due(const IdleTask t) {
+  task_state_t &s = state[t];
+
+  if (TASK_PERIOD(t) && PENDING(pass_ms, s.next_ms)) return false;
+
+  // Only the outer pass can get on sooner by putting tasks off
+  if (depth == 1 && TASK_PRIORITY(t) == BACKGROUND && PENDING(pass_ms, s.last_ms + (IDLE_TASK_MAX_DELAY))) {
+    if (starving || now_us - pass_start_us + TASK_BUDGET(t) > (IDLE_PASS_BUDGET_US)) {
+      s.put_off++;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Periods are timed from the start of the pass, which is close enough for milliseconds.
+// Tasks that ran in a nested pass have their own time, so it's left out of this one.
+void IdleTasks::ran(const IdleTask t, const uint32_t start_us, const uint32_t start_run_us) {
+  now_us = micros();
+  const uint32_t us = now_us - start_us - (run_us - start_run_us);
+  run_us += us;
+  task_state_t &s = state[t];
+  s.runs++;
+  s.total_us += us;
+  NOLESS(s.max_us, us);
+  if (us > TASK_BUDGET(t)) s.over_budget++;
+  s.last_ms = pass_ms;
+  s.next_ms = pass_ms + TASK_PERIOD(t);
+}
+
+void IdleTasks::report() {
+  SERIAL_ECHOLNPGM("Idle tasks (runs, mean us, max us, total ms, put off, over budget):");
+  LOOP_L_N(i, IDLE_TASK_COUNT) {
+    const task_state_t &s = state[i];
+    if (!s.runs && !s.put_off) continue;
+    SERIAL_CHAR(' ');
+    SERIAL_ECHOPGM_P(TASK_NAME(i));
+    SERIAL_ECHOLNPAIR(" ", s.runs, " ", s.runs ? uint32_t(s.total_us / s.runs) : 0, " ", s.max_us,
+                      " ", uint32_t(s.total_us / 1000), " ", s.put_off, " ", s.over_budget);
+  }
+}
+
+void IdleTasks::reset_stats() {
+  LOOP_L_N(i, IDLE_TASK_COUNT) {
+    task_state_t &s = state[i];
+    s.runs = s.put_off = s.over_budget = s.max_us = 0;
+    s.total_us = 0;
+  }
+}
+
+#endif // IDLE_TASK_SCHEDULER
@@ -0,0 +1,126 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/idle_tasks.h - Cooperative scheduling of the tasks run by idle()
+ *
+ * Each task has a period, a priority and a time budget. Critical and normal
+ * tasks run whenever their period is up. Background tasks are also put off
+ * while the planner is running low on moves with commands waiting, or when
+ * their budget doesn't fit in what is left of the pass, but never for longer
+ * than IDLE_TASK_MAX_DELAY.
+ *
+ * A task may call idle() itself while it waits. That nested pass belongs to
+ * the outer one: it doesn't start a new budget, it doesn't put off background
+ * tasks, and the time of its task runs is not counted again in the outer task.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(POWER_LOSS_RECOVERY) && PIN_EXISTS(POWER_LOSS)
+  #define _IDLE_POWER_LOSS 1
+#endif
+
+// Pass the task to T only if the option O is enabled
+#define _IDLE_IF(O,T) TERN(O, T, _IDLE_SKIP)
+#define _IDLE_SKIP(...)
+
+// Name, priority, period (ms) and budget (µs) of each configured task, in the order idle() runs them.
+// A period of 0 runs the task on every pass.
+#define IDLE_TASK_LIST(T) \
+  T(INACTIVITY,         CRITICAL,    0,  500) \
+  T(HEATER,             CRITICAL,    0,  500) \
+  _IDLE_IF(MAX7219_DEBUG,           T)(MAX7219,            NORMAL,      0,  500) \
+  _IDLE_IF(DEFERRED_STARTUP,        T)(STARTUP,            NORMAL,      0, 2000) \
+  _IDLE_IF(HAS_FILAMENT_SENSOR,     T)(RUNOUT,             CRITICAL,    0,  200) \
+  _IDLE_IF(HAL_IDLETASK,            T)(HAL,                NORMAL,      0,  500) \
+  _IDLE_IF(HAS_ETHERNET,            T)(ETHERNET,           NORMAL,      0,  500) \
+  _IDLE_IF(_IDLE_POWER_LOSS,        T)(POWER_LOSS,         CRITICAL,    0,  200) \
+  _IDLE_IF(SPI_ENDSTOPS,            T)(SPI_ENDSTOPS,       CRITICAL,    0,  500) \
+  _IDLE_IF(SDSUPPORT,               T)(MEDIA,              BACKGROUND, 20, 1000) \
+  _IDLE_IF(HAS_SD_LOOKAHEAD,        T)(SD_LOOKAHEAD,       BACKGROUND,  0, 1500) \
+  _IDLE_IF(TOOLCHANGE_PREHEAT,      T)(TOOLCHANGE_PREHEAT, NORMAL,      0, 1000) \
+  _IDLE_IF(USB_FLASH_DRIVE_SUPPORT, T)(USB_DRIVE,          BACKGROUND,  0, 1000) \
+  _IDLE_IF(HOST_KEEPALIVE_FEATURE,  T)(KEEPALIVE,          NORMAL,      0,  200) \
+  _IDLE_IF(PRINTCOUNTER,            T)(JOB_TIMER,          NORMAL,      0,  200) \
+  _IDLE_IF(USE_BEEPER,              T)(BUZZER,             NORMAL,      0,  200) \
+  T(UI,                 BACKGROUND,  0, 1500) \
+  _IDLE_IF(I2C_POSITION_ENCODERS,   T)(I2CPEM,             NORMAL,      0,  500) \
+  _IDLE_IF(HAS_AUTO_REPORTING,      T)(AUTOREPORT,         NORMAL,      0,  500) \
+  _IDLE_IF(HAS_PRUSA_MMU2,          T)(MMU2,               NORMAL,      0,  500) \
+  _IDLE_IF(POLL_JOG,                T)(JOYSTICK,           NORMAL,      0,  500) \
+  _IDLE_IF(DIRECT_STEPPING,         T)(DIRECT_STEPPING,    CRITICAL,    0,  500) \
+  _IDLE_IF(HAS_TFT_LVGL_UI,         T)(LVGL,               BACKGROUND,  0, 1500)
+
+#define _IDLE_TASK_ENUM(N,...) IDLE_##N,
+enum IdleTask : uint8_t { IDLE_TASK_LIST(_IDLE_TASK_ENUM) IDLE_TASK_COUNT };
+#undef _IDLE_TASK_ENUM
+
+class IdleTasks {
+  public:
+    enum Priority : uint8_t { CRITICAL, NORMAL, BACKGROUND };
+
+    typedef struct {
+      PGM_P name;
+      Priority priority;
+      uint16_t period_ms,   // Shortest time between runs, or 0 to run on every pass
+               budget_us;   // Expected longest run
+    } task_info_t;
+
+    static bool loop_pass;                    // Set while loop() calls idle()
+    static uint32_t now_us,                   // Start of the pass, then the end of the last task run
+                    run_us;                   // Own time of all task runs, to leave nested runs out
+
+    static void begin_pass();                 // Call at the start of idle()
+    static inline void end_pass() { depth--; } // Call at the end of idle()
+    static bool due(const IdleTask t);        // Should the task run on this pass?
+    static void ran(const IdleTask t, const uint32_t start_us, const uint32_t start_run_us);
+
+    static void report();
+    static void reset_stats();
+
+  private:
+    typedef struct {
+      millis_t next_ms, last_ms;
+      uint32_t runs, put_off, over_budget, max_us;
+      uint64_t total_us;                      // 32 bits would wrap after 71 minutes
+    } task_state_t;
+
+    static task_state_t state[IDLE_TASK_COUNT];
+    static millis_t pass_ms;
+    static uint32_t pass_start_us;
+    static uint8_t depth;                     // Nesting of idle() calls
+    static bool starving;
+};
+
+extern IdleTasks idle_tasks;
+
+// Run C as task T, timed and only when it's due. Tasks run back to back,
+// so each one starts when the last one ended and the clock is read once.
+#define IDLE_TASK(T, C) do{ \
+  if (idle_tasks.due(IDLE_##T)) { \
+    const uint32_t _task_us = idle_tasks.now_us, _run_us = idle_tasks.run_us; \
+    C; \
+    idle_tasks.ran(IDLE_##T, _task_us, _run_us); \
+  } \
+}while(0)
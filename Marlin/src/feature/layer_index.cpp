@@ -0,0 +1,237 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/layer_index.cpp - Per-layer index of an SD print file
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_LAYER_INDEX)
+
+#include "layer_index.h"
+#include "../sd/cardreader.h"
+
+LayerIndex layer_index;
+
+LayerIndex::IndexState LayerIndex::state; // = CLOSED
+SdFile LayerIndex::index_file;
+layer_index_header_t LayerIndex::header;
+uint32_t LayerIndex::near_layer;
+layer_record_t LayerIndex::near_rec, LayerIndex::next_rec;
+
+static const char index_magic[4] = { 'M', 'L', 'I', '2' };
+
+//
+// Builder state. The scan models only what it needs to tell layers apart and estimate times.
+//
+static xyze_float_t scan_pos;
+static float scan_feedrate_mm_s, scan_time_s, layer_z;
+static bool relative_xyz, relative_e;
+static layer_record_t z_change;  // Where the nozzle last moved to a new height
+
+/**
+ * Open the index for a file selected to print, or start building it
+ */
+void LayerIndex::open(SdFile * const dir, const char * const fname, SdFile &gcode) {
+  close();
+  if (TERN0(GCODE_HEATSHRINK, card.flag.inflating)) return;
+
+  // A re-sliced file may have the same size, so also match its modified date and time
+  dir_t entry;
+  if (!gcode.dirEntry(&entry)) return;
+  const uint32_t gcode_size = gcode.fileSize(),
+                 gcode_stamp = uint32_t(entry.lastWriteDate) << 16 | entry.lastWriteTime;
+
+  // The same base name with an IDX extension
+  char iname[FILENAME_LENGTH];
+  uint8_t i = 0;
+  for (; i < 8 && fname[i] && fname[i] != '.'; ++i) iname[i] = fname[i];
+  strcpy_P(&iname[i], PSTR(".IDX"));
+
+  if (index_file.open(dir, iname, O_READ)) {
+    if (index_file.read(&header, sizeof(header)) == sizeof(header)
+      && !memcmp(header.magic, index_magic, sizeof(index_magic))
+      && header.gcode_size == gcode_size
+      && header.gcode_stamp == gcode_stamp
+      && index_file.fileSize() == sizeof(header) + header.layers * sizeof(layer_record_t)
+    ) {
+      state = LOADED;
+      near_layer = 0;
+      read_record(0, near_rec);
+      read_record(1, next_rec);
+      return;
+    }
+    index_file.close();
+  }
+
+  // Build a new index from the SD look-ahead, with the header filled in once it's complete
+  if (!index_file.open(dir, iname, O_CREAT | O_RDWR | O_TRUNC)) return;
+
+  memset(&header, 0, sizeof(header));
+  header.gcode_size = gcode_size;
+  header.gcode_stamp = gcode_stamp;
+  index_file.write(&header, sizeof(header));
+
+  relative_xyz = relative_e = false;
+  scan_pos.reset();
+  scan_feedrate_mm_s = 1;
+  scan_time_s = layer_z = 0;
+  z_change = { 0, 0, 0 };
+  state = BUILDING;
+}
+
+void LayerIndex::close() {
+  if (state != CLOSED) index_file.close();
+  state = CLOSED;
+}
+
+// Get a word's value, if it's on the line
+static bool scan_value(const char *p, const char code, float &value) {
+  for (; *p; ++p) if (*p == code) { value = strtof(p + 1, nullptr); return true; }
+  return false;
+}
+
+void LayerIndex::build_line(const char * const line, const uint32_t sdpos) {
+  const char *p = line;
+  const char letter = *p;
+  if (letter != 'G' && letter != 'M') return;
+  const int code = atoi(p + 1);
+  do ++p; while (NUMERIC(*p));   // Past the command, so 'G1' isn't a word
+
+  if (letter == 'M') {
+    if (code == 82 || code == 83) relative_e = (code == 83);
+    return;
+  }
+
+  float v;
+  switch (code) {
+    case 0: case 1: {
+      if (scan_value(p, 'F', v) && v > 0) scan_feedrate_mm_s = MMM_TO_MMS(v);
+      xyze_float_t dest = scan_pos;
+      LOOP_XYZ(a) if (scan_value(p, axis_codes[a], v)) dest[a] = relative_xyz ? dest[a] + v : v;
+      if (scan_value(p, 'E', v)) dest.e = relative_e ? dest.e + v : v;
+
+      const xyze_float_t d = dest - scan_pos;
+      float dist = SQRT(sq(d.x) + sq(d.y) + sq(d.z));
+      if (dist < 0.0001f) dist = ABS(d.e);
+
+      // A layer starts at the move to a new height, once there's extrusion at that height
+      if (d.z) z_change = { sdpos, dest.z, uint32_t(scan_time_s) };
+      scan_time_s += dist / scan_feedrate_mm_s;
+      scan_pos = dest;
+
+      if (d.e > 0 && (d.x || d.y) && (header.layers == 0 || scan_pos.z > layer_z + 0.0001f)) {
+        index_file.write(&z_change, sizeof(z_change));
+        header.layers++;
+        layer_z = scan_pos.z;
+      }
+    } break;
+
+    case 28: scan_pos.reset(); break;
+    case 90: relative_xyz = relative_e = false; break;
+    case 91: relative_xyz = relative_e = true; break;
+    case 92:
+      LOOP_XYZ(a) if (scan_value(p, axis_codes[a], v)) scan_pos[a] = v;
+      if (scan_value(p, 'E', v)) scan_pos.e = v;
+      break;
+  }
+}
+
+void LayerIndex::build_finish() {
+  memcpy(header.magic, index_magic, sizeof(index_magic));
+  header.time_s = scan_time_s;
+  if (!index_file.seekSet(0) || index_file.write(&header, sizeof(header)) != sizeof(header) || !index_file.sync()) {
+    index_file.close();
+    state = CLOSED;
+    return;
+  }
+
+  // The finished index is ready for lookups
+  state = LOADED;
+  near_layer = 0;
+  read_record(0, near_rec);
+  read_record(1, next_rec);
+}
+
+bool LayerIndex::read_record(const uint32_t layer, layer_record_t &rec) {
+  if (layer == 0) { rec = { 0, 0, 0 }; return true; }
+  if (layer > header.layers) { rec = { header.gcode_size, 0, header.time_s }; return true; }
+  return index_file.seekSet(sizeof(header) + (layer - 1) * sizeof(layer_record_t))
+      && index_file.read(&rec, sizeof(rec)) == sizeof(rec);
+}
+
+// Bring the layers around a file position into near_rec and next_rec
+bool LayerIndex::seek_layer(uint32_t sdpos) {
+  NOMORE(sdpos, header.gcode_size ? header.gcode_size - 1 : 0);
+  if (sdpos >= near_rec.sdpos && sdpos < next_rec.sdpos) return true;
+
+  uint32_t lo, hi;
+  if (sdpos >= next_rec.sdpos) {
+    // Usually the print has just moved on to the next layer
+    layer_record_t after;
+    if (!read_record(near_layer + 2, after)) return false;
+    if (sdpos < after.sdpos) {
+      near_layer++;
+      near_rec = next_rec;
+      next_rec = after;
+      return true;
+    }
+    lo = near_layer + 2;
+    hi = header.layers;
+  }
+  else {
+    lo = 0;
+    hi = near_layer - 1;
+  }
+
+  // Otherwise find the last layer starting at or before the position
+  while (lo < hi) {
+    const uint32_t mid = (lo + hi + 1) / 2;
+    layer_record_t rec;
+    if (!read_record(mid, rec)) return false;
+    if (rec.sdpos <= sdpos) lo = mid; else hi = mid - 1;
+  }
+  near_layer = lo;
+  return read_record(lo, near_rec) && read_record(lo + 1, next_rec);
+}
+
+uint32_t LayerIndex::layer_at(const uint32_t sdpos) {
+  if (!loaded() || !seek_layer(sdpos)) return 0;
+  return _MIN(near_layer, header.layers);
+}
+
+bool LayerIndex::layer_sdpos(const uint32_t layer, uint32_t &sdpos) {
+  layer_record_t rec;
+  if (!loaded() || !WITHIN(layer, 1, header.layers) || !read_record(layer, rec)) return false;
+  sdpos = rec.sdpos;
+  return true;
+}
+
+uint32_t LayerIndex::time_at(const uint32_t sdpos) {
+  if (!loaded() || !seek_layer(sdpos)) return 0;
+  const uint32_t span = next_rec.sdpos - near_rec.sdpos;
+  if (!span || next_rec.time_s <= near_rec.time_s) return near_rec.time_s;
+  return near_rec.time_s + uint64_t(next_rec.time_s - near_rec.time_s) * (sdpos - near_rec.sdpos) / span;
+}
+
+#endif // SD_LAYER_INDEX
@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/layer_index.h - Per-layer index of an SD print file
+ *
+ * A sidecar file with the same base name and an ".IDX" extension maps each
+ * layer to the file offset of the line that moves to its height, along with
+ * the estimated print time up to that point. A missing or stale index is
+ * built from the lines of the SD look-ahead when a file is selected to print.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../sd/SdFile.h"
+
+typedef struct [[gnu::packed]] {
+  char magic[4];          // "MLI2"
+  uint32_t gcode_size,    // Size and FAT modified date/time of the indexed file,
+           gcode_stamp;   // to spot a stale index
+  uint32_t layers,        // Number of layer records that follow
+           time_s;        // Estimated total print time
+} layer_index_header_t;
+
+typedef struct [[gnu::packed]] {
+  uint32_t sdpos;         // Offset of the line that moves to the layer height
+  float z;                // Layer height
+  uint32_t time_s;        // Estimated print time before the layer
+} layer_record_t;
+
+class LayerIndex {
+  public:
+    static void open(SdFile * const dir, const char * const fname, SdFile &gcode);
+    static void close();
+
+    static inline bool building() { return state == BUILDING; }
+    static inline bool loaded() { return state == LOADED; }
+
+    // Lines from the SD look-ahead, while building
+    static void build_line(const char * const line, const uint32_t sdpos);
+    static void build_finish();
+    static inline uint32_t layer_count() { return header.layers; }
+    static inline uint32_t total_time() { return header.time_s; }
+
+    // Layer at a file position. 0 up to the first layer change.
+    static uint32_t layer_at(const uint32_t sdpos);
+
+    // Get the file position where a layer starts
+    static bool layer_sdpos(const uint32_t layer, uint32_t &sdpos);
+
+    // Estimated print time up to a file position, interpolated within its layer
+    static uint32_t time_at(const uint32_t sdpos);
+
+    static inline uint16_t permyriad(const uint32_t sdpos) {
+      return header.time_s ? uint64_t(time_at(sdpos)) * 10000 / header.time_s : 0;
+    }
+
+  private:
+    enum IndexState : uint8_t { CLOSED, BUILDING, LOADED };
+    static IndexState state;
+    static SdFile index_file;
+    static layer_index_header_t header;
+
+    // Layers around the last lookup. Layer 0 and layer_count + 1 are the ends of the file.
+    static uint32_t near_layer;
+    static layer_record_t near_rec, next_rec;
+
+    static bool read_record(const uint32_t layer, layer_record_t &rec);
+    static bool seek_layer(uint32_t sdpos);
+};
+
+extern LayerIndex layer_index;
@@ -38,11 +38,12 @@ Mixer mixer;
 uint_fast8_t  Mixer::selected_vtool = 0;
 float         Mixer::collector[MIXING_STEPPERS]; // mix proportion. 0.0 = off, otherwise <= COLOR_A_MASK.
 mixer_comp_t  Mixer::color[NR_MIXING_VIRTUAL_TOOLS][MIXING_STEPPERS];
+int32_t       Mixer::p_accu[MIXING_STEPPERS] = { 0 };
 
 // Used in Stepper
-int_fast8_t   Mixer::runner = 0;
-mixer_comp_t  Mixer::s_color[MIXING_STEPPERS];
-mixer_accu_t  Mixer::accu[MIXING_STEPPERS] = { 0 };
+uint8_t       Mixer::runner = 0,
+              Mixer::s_step = 0;
+mixer_schedule_t Mixer::s_schedule = { 0 };
 
 #if EITHER(HAS_DUAL_MIXING, GRADIENT_MIX)
   mixer_perc_t Mixer::mix[MIXING_STEPPERS];
@@ -144,6 +145,36 @@ void Mixer::refresh_collector(const float proportion/*=1.0*/, const uint8_t t/*=
   //SERIAL_EOL();
 }
 
+/**
+ * Work out which stepper takes each E step of a block, so the Stepper ISR
+ * only has to read the schedule. A weighted round-robin spreads each
+ * stepper's steps evenly. Its running totals carry on from the previous
+ * block, so a run of short blocks gets the same steps as one long one.
+ */
+void Mixer::populate_block(mixer_schedule_t b_schedule, const uint32_t esteps) {
+  const mixer_comp_t * const b_color = TERN_(GRADIENT_MIX, gradient.enabled ? gradient.color :) color[selected_vtool];
+
+  int32_t total = 0;
+  MIXER_STEPPER_LOOP(i) total += b_color[i];
+
+  int32_t acc[MIXING_STEPPERS];
+  COPY(acc, p_accu);
+  const uint8_t carry_at = _MIN(esteps, uint32_t(MIXER_SCHEDULE_STEPS));
+  LOOP_L_N(s, MIXER_SCHEDULE_STEPS) {
+    uint8_t pick = 0;
+    MIXER_STEPPER_LOOP(i) {
+      acc[i] += b_color[i];
+      if (acc[i] > acc[pick]) pick = i;
+    }
+    acc[pick] -= total;
+
+    if (s & 1) b_schedule[s >> 1] |= pick << 4; else b_schedule[s >> 1] = pick;
+
+    // The next block picks up after this block's steps
+    if (s + 1 == carry_at) COPY(p_accu, acc);
+  }
+}
+
 #if ENABLED(GRADIENT_MIX)
 
   #include "../module/motion.h"
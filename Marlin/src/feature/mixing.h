@@ -28,19 +28,27 @@
 #ifndef __AVR__ // || HAS_DUAL_MIXING
   // Use 16-bit (or fastest) data for the integer mix factors
   typedef uint_fast16_t mixer_comp_t;
-  typedef uint_fast16_t mixer_accu_t;
   #define COLOR_A_MASK 0x8000
-  #define COLOR_MASK 0x7FFF
 #else
   // Use 8-bit data for the integer mix factors
   // Exactness is sacrificed for speed
-  #define MIXER_ACCU_SIGNED
   typedef uint8_t mixer_comp_t;
-  typedef int8_t mixer_accu_t;
   #define COLOR_A_MASK 0x80
-  #define COLOR_MASK 0x7F
 #endif
 
+/**
+ * Each block gets a schedule of which stepper takes each E step, worked out
+ * by the planner and packed two steppers to a byte. The schedule repeats for
+ * blocks with more E steps, so those are exact to 1 / MIXER_SCHEDULE_STEPS.
+ */
+#ifndef MIXER_SCHEDULE_STEPS
+  #define MIXER_SCHEDULE_STEPS TERN(__AVR__, 32, 64)
+#endif
+static_assert(!((MIXER_SCHEDULE_STEPS) & ((MIXER_SCHEDULE_STEPS) - 1)), "MIXER_SCHEDULE_STEPS must be a power of 2.");
+static_assert(MIXING_STEPPERS <= 16, "MIXING_STEPPERS must be 16 or less for the packed step schedule.");
+
+typedef uint8_t mixer_schedule_t[(MIXER_SCHEDULE_STEPS) / 2];
+
 typedef int8_t mixer_perc_t;
 
 #ifndef MIXING_VIRTUAL_TOOLS
@@ -61,9 +69,9 @@ enum MixTool {
 #define MAX_VTOOLS TERN(HAS_MIXER_SYNC_CHANNEL, 254, 255)
 static_assert(NR_MIXING_VIRTUAL_TOOLS <= MAX_VTOOLS, "MIXING_VIRTUAL_TOOLS must be <= " STRINGIFY(MAX_VTOOLS) "!");
 
-#define MIXER_BLOCK_FIELD       mixer_comp_t b_color[MIXING_STEPPERS]
-#define MIXER_POPULATE_BLOCK()  mixer.populate_block(block->b_color)
-#define MIXER_STEPPER_SETUP()   mixer.stepper_setup(current_block->b_color)
+#define MIXER_BLOCK_FIELD       mixer_schedule_t b_schedule
+#define MIXER_POPULATE_BLOCK()  mixer.populate_block(block->b_schedule, block->steps.e)
+#define MIXER_STEPPER_SETUP()   mixer.stepper_setup(current_block->b_schedule)
 #define MIXER_STEPPER_LOOP(VAR) for (uint_fast8_t VAR = 0; VAR < MIXING_STEPPERS; VAR++)
 
 #if ENABLED(GRADIENT_MIX)
@@ -109,18 +117,11 @@ class Mixer {
   }
 
   // Used when dealing with blocks
-  FORCE_INLINE static void populate_block(mixer_comp_t b_color[MIXING_STEPPERS]) {
-    #if ENABLED(GRADIENT_MIX)
-      if (gradient.enabled) {
-        MIXER_STEPPER_LOOP(i) b_color[i] = gradient.color[i];
-        return;
-      }
-    #endif
-    MIXER_STEPPER_LOOP(i) b_color[i] = color[selected_vtool][i];
-  }
+  static void populate_block(mixer_schedule_t b_schedule, const uint32_t esteps);
 
-  FORCE_INLINE static void stepper_setup(mixer_comp_t b_color[MIXING_STEPPERS]) {
-    MIXER_STEPPER_LOOP(i) s_color[i] = b_color[i];
+  FORCE_INLINE static void stepper_setup(const mixer_schedule_t b_schedule) {
+    memcpy(s_schedule, b_schedule, sizeof(s_schedule));
+    s_step = 0;
   }
 
   #if EITHER(HAS_DUAL_MIXING, GRADIENT_MIX)
@@ -232,20 +233,10 @@ class Mixer {
   // Used in Stepper
   FORCE_INLINE static uint8_t get_stepper() { return runner; }
   FORCE_INLINE static uint8_t get_next_stepper() {
-    for (;;) {
-      if (--runner < 0) runner = MIXING_STEPPERS - 1;
-      accu[runner] += s_color[runner];
-      if (
-        #ifdef MIXER_ACCU_SIGNED
-          accu[runner] < 0
-        #else
-          accu[runner] & COLOR_A_MASK
-        #endif
-      ) {
-        accu[runner] &= COLOR_MASK;
-        return runner;
-      }
-    }
+    const uint8_t s = s_step, packed = s_schedule[s >> 1];
+    s_step = (s + 1) & ((MIXER_SCHEDULE_STEPS) - 1);
+    runner = (s & 1) ? packed >> 4 : packed & 0x0F;
+    return runner;
   }
 
   private:
@@ -253,11 +244,11 @@ class Mixer {
   // Used up to Planner level
   static uint_fast8_t selected_vtool;
   static mixer_comp_t color[NR_MIXING_VIRTUAL_TOOLS][MIXING_STEPPERS];
+  static int32_t p_accu[MIXING_STEPPERS];   // Schedule totals where the last block left off
 
   // Used in Stepper
-  static int_fast8_t  runner;
-  static mixer_comp_t s_color[MIXING_STEPPERS];
-  static mixer_accu_t accu[MIXING_STEPPERS];
+  static uint8_t runner, s_step;
+  static mixer_schedule_t s_schedule;
 };
 
 extern Mixer mixer;
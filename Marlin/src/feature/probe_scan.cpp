@@ -0,0 +1,112 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * probe_scan.cpp - Fly over the bed sampling an analog height sensor
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_ANALOG_SCAN)
+
+#include "probe_scan.h"
+#include "../MarlinCore.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/probe.h"
+
+#define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
+#include "../core/debug_out.h"
+
+// Readings closer to a stop than this fraction of the spacing go into its fit
+#define SCAN_WINDOW 0.25f
+
+ProbeScan probe_scan;
+
+volatile uint16_t ProbeScan::raw; // = 0
+volatile uint8_t ProbeScan::count; // = 0
+
+/**
+ * Move the probe tip to PROBE_SCAN_HEIGHT over 'start' and sweep it to 'end'
+ * at PROBE_SCAN_FEEDRATE. Each sensor reading is placed by the planner position
+ * and goes to the nearest stop, if within SCAN_WINDOW of it.
+ * Stops with no readings are set to NAN. Return 'true' on error.
+ */
+bool ProbeScan::scan_row(const xy_pos_t &start, const xy_pos_t &end, const uint8_t points, float z[]) {
+  if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("ProbeScan::scan_row(", start.x, ", ", start.y, " -> ", end.x, ", ", end.y, ")");
+
+  if (!WITHIN(points, 2, PROBE_SCAN_MAX_POINTS) || probe.deploy()) return true;
+
+  const xy_pos_t span = end - start;
+  const float len = span.magnitude();
+  if (len < 0.1f) return true;
+
+  // Approach above the first stop, then descend to the scan height
+  const float scan_z = float(PROBE_SCAN_HEIGHT) - probe.offset.z;
+  do_z_clearance(scan_z);
+  do_blocking_move_to_xy(start - probe.offset_xy, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
+  do_blocking_move_to_z(scan_z, z_probe_fast_mm_s);
+
+  // Fit a line through the readings around each stop so the one-sided
+  // windows at the ends of the row don't skew by the slope of the bed.
+  struct { float st, stt, sz, stz; uint16_t n; } fit[PROBE_SCAN_MAX_POINTS] = { { 0 } };
+
+  // Distance along the row for one stop, as a factor of the projection
+  const float unit = (points - 1) / sq(len);
+
+  current_position.set(end.x - probe.offset_xy.x, end.y - probe.offset_xy.y);
+  line_to_current_position(MMM_TO_MMS(PROBE_SCAN_FEEDRATE));
+
+  uint8_t last = count;
+  while (planner.has_blocks_queued()) {
+    if (count != last) {
+      uint16_t adc;
+      do { last = count; adc = raw; } while (last != count);  // Don't tear the 16-bit value
+
+      const xy_pos_t probe_pos = xy_pos_t(planner.get_axis_positions_mm()) + probe.offset_xy,
+                     rel = probe_pos - start;
+      const float t = (rel.x * span.x + rel.y * span.y) * unit;
+      const int8_t k = LROUND(t);
+      const float dt = t - k;
+      if (WITHIN(k, 0, points - 1) && ABS(dt) <= SCAN_WINDOW) {
+        const float zk = raw_to_z(adc);
+        fit[k].st += dt; fit[k].stt += sq(dt);
+        fit[k].sz += zk; fit[k].stz += dt * zk;
+        fit[k].n++;
+      }
+    }
+    idle();
+  }
+
+  LOOP_L_N(i, points) {
+    const uint16_t n = fit[i].n;
+    const float det = n * fit[i].stt - sq(fit[i].st);
+    z[i] = n == 0 ? NAN
+         : (n < 3 || det < 1e-6f) ? fit[i].sz / n
+         : (fit[i].sz * fit[i].stt - fit[i].st * fit[i].stz) / det;
+    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("Stop ", int(i), " samples: ", int(n), " z: ", z[i]);
+  }
+
+  return false;
+}
+
+#endif // PROBE_ANALOG_SCAN
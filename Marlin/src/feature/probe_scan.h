@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_scan.h - Fly over the bed sampling an analog height sensor
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define PROBE_SCAN_MAX_POINTS _MAX(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y)
+
+class ProbeScan {
+public:
+  static volatile uint16_t raw;   // Latest ADC reading of the height sensor
+  static volatile uint8_t count;  // Bumped for every new reading
+
+  // Called from the Temperature ISR with each new reading
+  static inline void sample(const uint16_t adc) { raw = adc; count++; }
+
+  // Bed height under the probe tip for a given reading
+  static inline float raw_to_z(const uint16_t adc) {
+    return float(PROBE_SCAN_HEIGHT) - (int16_t(adc) - int16_t(PROBE_SCAN_ZERO_COUNT)) * float(PROBE_SCAN_MM_PER_COUNT);
+  }
+
+  // Sweep the probe from 'start' to 'end' and get the bed height at 'points' evenly spaced stops
+  static bool scan_row(const xy_pos_t &start, const xy_pos_t &end, const uint8_t points, float z[]);
+};
+
+extern ProbeScan probe_scan;
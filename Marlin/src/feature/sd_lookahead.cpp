@@ -0,0 +1,143 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/sd_lookahead.cpp - Read the file being printed ahead of the print
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if HAS_SD_LOOKAHEAD
+
+#include "sd_lookahead.h"
+#include "../sd/cardreader.h"
+
+SDLookahead sd_lookahead;
+
+bool SDLookahead::active, // = false
+     SDLookahead::at_eof;
+SdFile SDLookahead::file;
+uint32_t SDLookahead::read_sdpos, SDLookahead::line_sdpos;
+
+// Bytes read per call to task(), to share the SD with a running print
+#define LOOKAHEAD_SCAN_BYTES 128
+
+static char line_buf[MAX_CMD_SIZE];
+static uint8_t line_count;
+static bool line_comment;
+
+// The layer index and the time estimate need every line of the file
+bool SDLookahead::every_line() {
+  return TERN0(SD_LAYER_INDEX, layer_index.building()) || TERN0(PRINT_TIME_ESTIMATOR, time_estimator.scanning());
+}
+
+/**
+ * Open the file selected to print, once the features that read it are ready
+ */
+void SDLookahead::open(SdFile * const dir, const char * const fname) {
+  close();
+  if (!every_line() && !TERN0(TOOLCHANGE_PREHEAT, toolchange_preheat.want_lines())) return;
+  if (!file.open(dir, fname, O_READ)) {
+    TERN_(SD_LAYER_INDEX, layer_index.close());
+    TERN_(PRINT_TIME_ESTIMATOR, time_estimator.close());
+    TERN_(TOOLCHANGE_PREHEAT, toolchange_preheat.close());
+    return;
+  }
+  read_sdpos = line_sdpos = 0;
+  line_count = 0;
+  line_comment = at_eof = false;
+  active = true;
+}
+
+void SDLookahead::close() {
+  if (active) file.close();
+  active = false;
+}
+
+bool SDLookahead::seek(const uint32_t sdpos) {
+  if (!file.seekSet(sdpos)) return false;
+  read_sdpos = line_sdpos = sdpos;
+  line_count = 0;
+  line_comment = at_eof = false;
+  return true;
+}
+
+/**
+ * Read a few bytes of the file and hand out the lines that are complete
+ */
+void SDLookahead::task() {
+  if (!active) return;
+
+  if (!every_line()) {
+    #if ENABLED(TOOLCHANGE_PREHEAT)
+      if (!toolchange_preheat.want_lines()) return;
+      const uint32_t sdpos = toolchange_preheat.scan_from(line_sdpos);
+      if (sdpos != line_sdpos && !seek(sdpos)) return;
+    #else
+      close();
+      return;
+    #endif
+  }
+
+  if (at_eof) return;
+
+  uint8_t buf[LOOKAHEAD_SCAN_BYTES];
+  const int16_t count = file.read(buf, sizeof(buf));
+  if (count <= 0) {
+    if (line_count) end_line();
+    at_eof = true;
+    TERN_(SD_LAYER_INDEX, if (layer_index.building()) layer_index.build_finish());
+    TERN_(PRINT_TIME_ESTIMATOR, if (time_estimator.scanning()) time_estimator.scan_finish());
+    return;
+  }
+
+  LOOP_L_N(i, count) {
+    const char c = buf[i];
+    read_sdpos++;
+    if (c == '\n' || c == '\r') {
+      if (line_count) end_line();
+      line_comment = false;
+      line_sdpos = read_sdpos;
+    }
+    else if (c == ';')
+      line_comment = true;
+    else if (!line_comment && line_count < sizeof(line_buf) - 1)
+      line_buf[line_count++] = c;
+  }
+}
+
+// Hand a line to each feature, past any line number
+void SDLookahead::end_line() {
+  line_buf[line_count] = '\0';
+  line_count = 0;
+
+  const char *p = line_buf;
+  while (*p == ' ') ++p;
+  if (*p == 'N') { while (*p && *p != ' ') ++p; while (*p == ' ') ++p; }
+  if (!*p) return;
+
+  TERN_(SD_LAYER_INDEX, if (layer_index.building()) layer_index.build_line(p, line_sdpos));
+  TERN_(PRINT_TIME_ESTIMATOR, if (time_estimator.scanning()) time_estimator.scan_line(p));
+  TERN_(TOOLCHANGE_PREHEAT, toolchange_preheat.scan_line(p, line_sdpos));
+}
+
+#endif // HAS_SD_LOOKAHEAD
@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/sd_lookahead.h - Read the file being printed ahead of the print
+ *
+ * A second handle on the file reads a few bytes per idle() call and hands
+ * each line, without its comment or line number, to the features that look
+ * ahead of the print. The layer index and the time estimate take every line
+ * of the file. After that the tool preheat reads on from where it needs to.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../sd/SdFile.h"
+
+class SDLookahead {
+  public:
+    static void open(SdFile * const dir, const char * const fname);
+    static void close();
+    static void task();
+
+    // Offset of the line after the one being handed out
+    static inline uint32_t next_sdpos() { return read_sdpos; }
+
+  private:
+    static bool active, at_eof;
+    static SdFile file;
+    static uint32_t read_sdpos,   // Offset of the next byte to read
+                    line_sdpos;   // Offset of the line being read
+
+    static bool every_line();
+    static bool seek(const uint32_t sdpos);
+    static void end_line();
+};
+
+extern SDLookahead sd_lookahead;
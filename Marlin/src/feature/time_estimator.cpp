@@ -0,0 +1,341 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/time_estimator.cpp - Print time estimate from a shadow planner
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+
+#include "time_estimator.h"
+#include "sd_lookahead.h"
+#include "../module/planner.h"
+#include "../sd/cardreader.h"
+
+PrintTimeEstimator time_estimator;
+
+PrintTimeEstimator::EstimateState PrintTimeEstimator::state; // = CLOSED
+uint32_t PrintTimeEstimator::gcode_size, PrintTimeEstimator::scanned_sdpos;
+time_checkpoint_t PrintTimeEstimator::checkpoint[TIME_CHECKPOINTS];
+uint8_t PrintTimeEstimator::checkpoint_count;
+uint32_t PrintTimeEstimator::checkpoint_spacing;
+shadow_move_t PrintTimeEstimator::move[SHADOW_MOVES];
+uint8_t PrintTimeEstimator::move_count;
+
+// Initial file distance between checkpoints
+#define CHECKPOINT_SPACING 1024
+
+//
+// Scanner state, tracking just enough G-code state to model moves
+//
+static xyze_float_t scan_pos;
+static feedRate_t scan_feedrate_mm_s;
+static bool relative_xyz, relative_e;
+
+// Accelerations set by the file with M204
+static float print_accel, travel_accel, retract_accel;
+
+// Direction and speed of the last XYZ move, for the junction speed
+static xyz_float_t prev_unit;
+static float prev_nominal_speed_sqr;
+static bool has_prev;
+
+// Modeled time, in whole seconds plus a fraction so small moves aren't lost
+static uint32_t time_s;
+static float time_carry;
+
+void PrintTimeEstimator::open(const uint32_t size) {
+  close();
+  if (TERN0(GCODE_HEATSHRINK, card.flag.inflating)) return;
+
+  gcode_size = size;
+  scanned_sdpos = 0;
+  checkpoint_count = 0;
+  checkpoint_spacing = CHECKPOINT_SPACING;
+  move_count = 0;
+
+  relative_xyz = relative_e = has_prev = false;
+  scan_pos.reset();
+  scan_feedrate_mm_s = feedrate_mm_s;
+  print_accel = planner.settings.acceleration;
+  travel_accel = planner.settings.travel_acceleration;
+  retract_accel = planner.settings.retract_acceleration;
+  time_s = 0;
+  time_carry = 0;
+  state = SCANNING;
+}
+
+void PrintTimeEstimator::close() { state = CLOSED; }
+
+// The whole file has been read, so bring the last moves to a stop
+void PrintTimeEstimator::scan_finish() {
+  flush_moves();
+  state = FINISHED;
+}
+
+void PrintTimeEstimator::add_time(const float s) {
+  time_carry += s;
+  if (time_carry >= 1) {
+    const uint32_t whole = time_carry;
+    time_s += whole;
+    time_carry -= whole;
+  }
+}
+
+void PrintTimeEstimator::add_checkpoint(const uint32_t sdpos) {
+  const uint32_t last = checkpoint_count ? checkpoint[checkpoint_count - 1].sdpos : 0;
+  if (sdpos - last < checkpoint_spacing) return;
+
+  // When full, drop every other checkpoint to make room
+  const uint32_t t = modeled_time();
+  if (checkpoint_count == TIME_CHECKPOINTS) {
+    checkpoint_count /= 2;
+    LOOP_L_N(i, checkpoint_count) checkpoint[i] = checkpoint[i * 2 + 1];
+    checkpoint_spacing *= 2;
+  }
+  checkpoint[checkpoint_count++] = { sdpos, t };
+}
+
+/**
+ * Add a move to the shadow planner, with its speed and acceleration
+ * limited by each axis and its entry speed limited by the junction
+ */
+void PrintTimeEstimator::plan_move(const xyze_float_t &dist, const feedRate_t fr_mm_s) {
+  const float xyz_mm = SQRT(sq(dist.x) + sq(dist.y) + sq(dist.z));
+  const bool e_only = xyz_mm < 0.0001f;
+  const float millimeters = e_only ? ABS(dist.e) : xyz_mm;
+  if (millimeters < 0.0001f) return;
+
+  const float inverse_mm = 1.0f / millimeters;
+  float speed = fr_mm_s, accel = e_only ? retract_accel : dist.e > 0 ? print_accel : travel_accel;
+  LOOP_XYZE(i) if (dist[i]) {
+    const float ratio = ABS(dist[i]) * inverse_mm;
+    NOMORE(speed, planner.settings.max_feedrate_mm_s[i] / ratio);
+    NOMORE(accel, planner.settings.max_acceleration_mm_per_s2[i] / ratio);
+  }
+  NOLESS(speed, 0.1f);
+  NOLESS(accel, 1.0f);
+
+  const float nominal_speed_sqr = sq(speed);
+  float max_entry_speed_sqr = 0;
+
+  if (!e_only) {
+    const xyz_float_t unit = dist * inverse_mm;
+    if (has_prev) {
+      #if HAS_JUNCTION_DEVIATION
+        const float junction_cos_theta = -(unit.x * prev_unit.x + unit.y * prev_unit.y + unit.z * prev_unit.z);
+        if (junction_cos_theta < -0.999999f)      // Straight ahead
+          max_entry_speed_sqr = nominal_speed_sqr;
+        else if (junction_cos_theta < 0.999999f) {
+          const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta));
+          max_entry_speed_sqr = accel * planner.junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+        }
+      #else
+        float vmax = speed;
+        LOOP_XYZ(i) {
+          const float jump = ABS(unit[i] - prev_unit[i]);
+          if (jump > 0.0001f) NOMORE(vmax, planner.max_jerk[i] / jump);
+        }
+        max_entry_speed_sqr = sq(vmax);
+      #endif
+      NOMORE(max_entry_speed_sqr, _MIN(nominal_speed_sqr, prev_nominal_speed_sqr));
+    }
+    prev_unit = unit;
+    prev_nominal_speed_sqr = nominal_speed_sqr;
+  }
+  has_prev = !e_only;
+
+  if (move_count == SHADOW_MOVES) retire_move();
+  move[move_count++] = { millimeters, accel, nominal_speed_sqr, max_entry_speed_sqr, 0 };
+}
+
+// Time for a trapezoid, or a triangle if the move is too short to reach its nominal speed
+static float move_time(const shadow_move_t &m, const float exit_speed_sqr) {
+  const float accel_x2 = 2 * m.acceleration,
+              accel_mm = (m.nominal_speed_sqr - m.entry_speed_sqr) / accel_x2,
+              decel_mm = (m.nominal_speed_sqr - exit_speed_sqr) / accel_x2,
+              v_entry = SQRT(m.entry_speed_sqr), v_exit = SQRT(exit_speed_sqr);
+
+  if (accel_mm + decel_mm < m.millimeters) {
+    const float v_nominal = SQRT(m.nominal_speed_sqr);
+    return (2 * v_nominal - v_entry - v_exit) / m.acceleration + (m.millimeters - accel_mm - decel_mm) / v_nominal;
+  }
+
+  const float v_peak = SQRT(0.5f * (accel_x2 * m.millimeters + m.entry_speed_sqr + exit_speed_sqr));
+  return (2 * v_peak - v_entry - v_exit) / m.acceleration;
+}
+
+/**
+ * Plan the entry speeds of the held moves, like the planner does, assuming
+ * the newest move has to stop. The oldest move's entry speed is already settled.
+ */
+void PrintTimeEstimator::plan_speeds() {
+  if (!move_count) return;
+
+  // Backward pass, so each move can slow down for the ones after it
+  float next_entry_speed_sqr = 0;
+  for (uint8_t i = move_count - 1; i > 0; --i) {
+    shadow_move_t &m = move[i];
+    m.entry_speed_sqr = _MIN(m.max_entry_speed_sqr, next_entry_speed_sqr + 2 * m.acceleration * m.millimeters);
+    next_entry_speed_sqr = m.entry_speed_sqr;
+  }
+
+  // Forward pass, so each move can speed up from the one before it
+  for (uint8_t i = 1; i < move_count; ++i) {
+    const shadow_move_t &prev = move[i - 1];
+    NOMORE(move[i].entry_speed_sqr, prev.entry_speed_sqr + 2 * prev.acceleration * prev.millimeters);
+  }
+}
+
+// Finish the oldest move, with the lookahead of the held moves
+void PrintTimeEstimator::retire_move() {
+  plan_speeds();
+  add_time(move_time(move[0], move_count > 1 ? move[1].entry_speed_sqr : 0));
+  move_count--;
+  LOOP_L_N(i, move_count) move[i] = move[i + 1];
+}
+
+// Modeled time up to the last line scanned, with the held moves brought to a stop
+uint32_t PrintTimeEstimator::modeled_time() {
+  plan_speeds();
+  float held_s = time_carry;
+  LOOP_L_N(i, move_count) held_s += move_time(move[i], i + 1 < move_count ? move[i + 1].entry_speed_sqr : 0);
+  const uint32_t t = time_s + uint32_t(held_s);
+  // Later lines can only add time, even if stopping early was modeled a bit slower
+  return checkpoint_count ? _MAX(t, checkpoint[checkpoint_count - 1].time_s) : t;
+}
+
+// Bring everything to a stop, as for a dwell
+void PrintTimeEstimator::flush_moves() {
+  while (move_count) retire_move();
+  has_prev = false;
+}
+
+// Get a word's value, if it's on the line
+static bool scan_value(const char *p, const char code, float &value) {
+  for (; *p; ++p) if (*p == code) { value = strtof(p + 1, nullptr); return true; }
+  return false;
+}
+
+/**
+ * Model a line from the SD look-ahead, then take a checkpoint after it
+ */
+void PrintTimeEstimator::scan_line(const char * const line) {
+  model_line(line);
+  scanned_sdpos = sd_lookahead.next_sdpos();
+  add_checkpoint(scanned_sdpos);
+}
+
+void PrintTimeEstimator::model_line(const char * const line) {
+  const char *p = line;
+  const char letter = *p;
+  if (letter != 'G' && letter != 'M') return;
+  const int code = atoi(p + 1);
+  do ++p; while (NUMERIC(*p));   // Past the command, so 'G1' isn't a word
+
+  float v;
+  if (letter == 'M') switch (code) {
+    case 82: relative_e = false; break;
+    case 83: relative_e = true; break;
+    case 204:
+      if (scan_value(p, 'S', v)) print_accel = travel_accel = v;
+      if (scan_value(p, 'P', v)) print_accel = v;
+      if (scan_value(p, 'T', v)) travel_accel = v;
+      if (scan_value(p, 'R', v)) retract_accel = v;
+      break;
+  }
+  else switch (code) {
+    case 0: case 1: case 2: case 3: {
+      if (scan_value(p, 'F', v) && v > 0) scan_feedrate_mm_s = MMM_TO_MMS(v);
+      xyze_float_t dest = scan_pos;
+      LOOP_XYZ(a) if (scan_value(p, axis_codes[a], v)) dest[a] = relative_xyz ? dest[a] + v : v;
+      if (scan_value(p, 'E', v)) dest.e = relative_e ? dest.e + v : v;
+      xyze_float_t dist = dest - scan_pos;
+
+      // An arc is modeled as one move along the chord, stretched to the arc length
+      float i = 0, j = 0;
+      if (code >= 2) { scan_value(p, 'I', i); scan_value(p, 'J', j); }
+      if (i || j) {
+        const float radius = HYPOT(i, j);
+        float angle = ATAN2(-i * (dist.y - j) + j * (dist.x - i), -i * (dist.x - i) - j * (dist.y - j));
+        if (angle < 0) angle += RADIANS(360);
+        if (code == 2) angle = RADIANS(360) - angle;
+        if (angle < 0.0001f) angle = RADIANS(360);
+        const float chord = HYPOT(dist.x, dist.y), arc = radius * angle;
+        if (chord > 0.0001f) {
+          dist.x *= arc / chord;
+          dist.y *= arc / chord;
+        }
+        else {
+          dist.x = arc;   // A full circle
+          has_prev = false;
+        }
+      }
+
+      plan_move(dist, scan_feedrate_mm_s);
+      scan_pos = dest;
+    } break;
+
+    case 4:
+      flush_moves();
+      if (scan_value(p, 'P', v)) add_time(v * 0.001f);
+      if (scan_value(p, 'S', v)) add_time(v);
+      break;
+
+    case 28: flush_moves(); scan_pos.reset(); break;
+    case 90: relative_xyz = relative_e = false; break;
+    case 91: relative_xyz = relative_e = true; break;
+    case 92:
+      LOOP_XYZ(a) if (scan_value(p, axis_codes[a], v)) scan_pos[a] = v;
+      if (scan_value(p, 'E', v)) scan_pos.e = v;
+      break;
+  }
+}
+
+uint32_t PrintTimeEstimator::time_at(const uint32_t sdpos) {
+  if (!active()) return 0;
+
+  // The end of the modeled part of the file
+  time_checkpoint_t lo = { 0, 0 }, hi = { final() ? gcode_size : scanned_sdpos, modeled_time() };
+  if (sdpos >= hi.sdpos) {
+    if (final() || !hi.sdpos) return hi.time_s;
+    return uint64_t(hi.time_s) * sdpos / hi.sdpos;    // Carry on at the average rate
+  }
+
+  LOOP_L_N(i, checkpoint_count) {
+    if (checkpoint[i].sdpos > sdpos) { hi = checkpoint[i]; break; }
+    lo = checkpoint[i];
+  }
+  return lo.time_s + uint64_t(hi.time_s - lo.time_s) * (sdpos - lo.sdpos) / (hi.sdpos - lo.sdpos);
+}
+
+uint32_t PrintTimeEstimator::total() { return time_at(gcode_size); }
+
+uint32_t PrintTimeEstimator::remaining() {
+  const uint32_t done = time_at(card.getIndex()), all = total();
+  const uint32_t left = all > done ? all - done : 0;
+  return feedrate_percentage > 0 ? left * 100UL / feedrate_percentage : left;
+}
+
+#endif // PRINT_TIME_ESTIMATOR
@@ -0,0 +1,100 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/time_estimator.h - Print time estimate from a shadow planner
+ *
+ * The lines of the SD look-ahead, which runs ahead of the print, go through
+ * a small model of the planner with the machine's
+ * feedrate, acceleration and junction limits. Sparse checkpoints of file
+ * position and modeled time give the time for any part of the print.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+// Moves held for lookahead in the shadow planner
+#define SHADOW_MOVES 8
+
+// File position and modeled time checkpoints. The spacing doubles as they fill up.
+#define TIME_CHECKPOINTS 32
+
+typedef struct {
+  float millimeters,      // Length of the move
+        acceleration,     // (mm/s^2) Limited by each axis
+        nominal_speed_sqr,
+        max_entry_speed_sqr,
+        entry_speed_sqr;
+} shadow_move_t;
+
+typedef struct {
+  uint32_t sdpos, time_s;
+} time_checkpoint_t;
+
+class PrintTimeEstimator {
+  public:
+    static void open(const uint32_t gcode_size);
+    static void close();
+
+    static inline bool active() { return state != CLOSED; }
+    static inline bool scanning() { return state == SCANNING; }
+
+    // Lines from the SD look-ahead, while scanning
+    static void scan_line(const char * const line);
+    static void scan_finish();
+
+    // The whole file has been modeled, so the total is no longer extrapolated
+    static inline bool final() { return state == FINISHED; }
+
+    // Modeled time from the start of the file to a file position
+    static uint32_t time_at(const uint32_t sdpos);
+
+    // Estimated total and remaining time, with the current feedrate override
+    static uint32_t total();
+    static uint32_t remaining();
+
+  private:
+    enum EstimateState : uint8_t { CLOSED, SCANNING, FINISHED };
+    static EstimateState state;
+    static uint32_t gcode_size,
+                    scanned_sdpos;    // Offset of the line after the last one modeled
+
+    static time_checkpoint_t checkpoint[TIME_CHECKPOINTS];
+    static uint8_t checkpoint_count;
+    static uint32_t checkpoint_spacing;
+
+    static shadow_move_t move[SHADOW_MOVES];
+    static uint8_t move_count;
+
+    static void add_time(const float s);
+    static void add_checkpoint(const uint32_t sdpos);
+
+    static void plan_move(const xyze_float_t &dist, const feedRate_t fr_mm_s);
+    static void plan_speeds();
+    static void retire_move();
+    static void flush_moves();
+    static uint32_t modeled_time();
+
+    static void model_line(const char * const line);
+};
+
+extern PrintTimeEstimator time_estimator;
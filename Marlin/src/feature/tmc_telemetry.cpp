@@ -0,0 +1,198 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/tmc_telemetry.cpp - Per-move motor load telemetry for TMC drivers
+ *
+ * Each sample reads a single driver of an axis that is moving in the current
+ * block. That is one register transfer, except for the TMC2209, which also
+ * reads its current scale on every 8th sample of an axis.
+ * Samples are aggregated over whole moves, and the moves finished within
+ * TMC_LOAD_REPORT_MS are reported together on one line.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TMC_LOAD_TELEMETRY)
+
+#include "tmc_telemetry.h"
+#include "tmc_util.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#include "../module/stepper/indirection.h"
+
+TMCLoadTelemetry tmc_telemetry;
+
+AutoReporter<TMCLoadTelemetry::AutoReportLoad, 1> TMCLoadTelemetry::auto_reporter;
+uint16_t TMCLoadTelemetry::last_move_id,
+         TMCLoadTelemetry::first_move_id,
+         TMCLoadTelemetry::report_move_id;
+millis_t TMCLoadTelemetry::next_report_ms;
+uint8_t TMCLoadTelemetry::next_axis,
+        TMCLoadTelemetry::last_cs[XYZE],
+        TMCLoadTelemetry::cs_age[XYZE];
+TMCLoadTelemetry::load_stats_t TMCLoadTelemetry::stats[XYZE];
+
+//
+// Read the StallGuard result and actual CoolStep current scale.
+// SPI drivers deliver both in a single DRV_STATUS transfer. UART
+// drivers that need a second transfer only read the current scale
+// when read_cs is set, and otherwise leave cs as it was.
+//
+#if HAS_TMCX1X0
+  static void read_load(TMC2130Stepper &st, uint16_t &sg, uint8_t &cs, const bool) {
+    const uint32_t drv_status = st.DRV_STATUS();
+    sg = drv_status & 0x3FF;
+    cs = (drv_status >> 16) & 0x1F;
+  }
+#endif
+
+#if HAS_TMC220x
+  // No StallGuard on the TMC2208
+  static void read_load(TMC2208Stepper &st, uint16_t &sg, uint8_t &cs, const bool) {
+    sg = 0;
+    cs = st.cs_actual();
+  }
+
+  static void read_load(TMC2209Stepper &st, uint16_t &sg, uint8_t &cs, const bool read_cs) {
+    sg = st.SG_RESULT();
+    if (read_cs) cs = st.cs_actual();
+  }
+#endif
+
+#if HAS_DRIVER(TMC2660)
+  // The TMC2660 does not report the current scale
+  static void read_load(TMC2660Stepper &st, uint16_t &sg, uint8_t &cs, const bool) {
+    sg = st.sg_result();
+    cs = 0;
+  }
+#endif
+
+bool TMCLoadTelemetry::sample_axis(const AxisEnum axis) {
+  uint16_t sg;
+  uint8_t &cs = last_cs[axis];
+  const bool read_cs = !cs_age[axis];
+
+  #define _READ_CASE(N) case N: read_load(stepperE##N, sg, cs, read_cs); break
+  switch (axis) {
+    #if AXIS_IS_TMC(X)
+      case X_AXIS: read_load(stepperX, sg, cs, read_cs); break;
+    #endif
+    #if AXIS_IS_TMC(Y)
+      case Y_AXIS: read_load(stepperY, sg, cs, read_cs); break;
+    #endif
+    #if AXIS_IS_TMC(Z)
+      case Z_AXIS: read_load(stepperZ, sg, cs, read_cs); break;
+    #endif
+    case E_AXIS:
+      switch (stepper.last_moved_extruder) {
+        #if AXIS_IS_TMC(E0)
+          _READ_CASE(0);
+        #endif
+        #if AXIS_IS_TMC(E1)
+          _READ_CASE(1);
+        #endif
+        #if AXIS_IS_TMC(E2)
+          _READ_CASE(2);
+        #endif
+        #if AXIS_IS_TMC(E3)
+          _READ_CASE(3);
+        #endif
+        #if AXIS_IS_TMC(E4)
+          _READ_CASE(4);
+        #endif
+        #if AXIS_IS_TMC(E5)
+          _READ_CASE(5);
+        #endif
+        #if AXIS_IS_TMC(E6)
+          _READ_CASE(6);
+        #endif
+        #if AXIS_IS_TMC(E7)
+          _READ_CASE(7);
+        #endif
+        default: return false;
+      }
+      break;
+    default: return false;
+  }
+  #undef _READ_CASE
+
+  cs_age[axis] = (cs_age[axis] + 1) & 7;
+  stats[axis].add(sg, cs);
+  return true;
+}
+
+/**
+ * Report the aggregated load of the finished moves:
+ *   TL:<first move>[-<last move>] X:<sg min>,<sg avg>,<sg max>,<cs avg> ...
+ * Axes that were not sampled during the moves are left out.
+ */
+void TMCLoadTelemetry::report() {
+  bool sampled = false;
+  LOOP_XYZE(i) if (stats[i].count) { sampled = true; break; }
+  if (!sampled) return;
+
+  SERIAL_ECHOPAIR("TL:", first_move_id);
+  if (report_move_id != first_move_id) SERIAL_ECHOPAIR("-", report_move_id);
+  LOOP_XYZE(i) {
+    load_stats_t &s = stats[i];
+    if (!s.count) continue;
+    SERIAL_CHAR(' ', axis_codes[i], ':');
+    SERIAL_ECHO(s.sg_min);
+    SERIAL_CHAR(',');
+    SERIAL_ECHO(s.sg_sum / s.count);
+    SERIAL_CHAR(',');
+    SERIAL_ECHO(s.sg_max);
+    SERIAL_CHAR(',');
+    SERIAL_ECHO(s.cs_sum / s.count);
+    s = { 0 };
+  }
+  SERIAL_EOL();
+}
+
+void TMCLoadTelemetry::sample() {
+  // The block at the tail is the one the stepper is working on
+  const uint16_t move_id = planner.has_blocks_queued() ? planner.block_buffer[planner.block_buffer_tail].telemetry_id : 0;
+  if (move_id != report_move_id) {
+    // A move is done. Report the moves so far once enough time has passed,
+    // so the stream stays well within the serial bandwidth.
+    const millis_t ms = millis();
+    if (!move_id || ELAPSED(ms, next_report_ms)) {
+      report();
+      next_report_ms = ms + TMC_LOAD_REPORT_MS;
+      first_move_id = move_id;
+    }
+    else if (!first_move_id)
+      first_move_id = move_id;
+    report_move_id = move_id;
+  }
+  if (!move_id) return;
+
+  // Take turns among the moving axes, skipping those without a TMC driver
+  LOOP_XYZE(i) {
+    const AxisEnum axis = AxisEnum(next_axis);
+    if (++next_axis >= XYZE) next_axis = 0;
+    if (stepper.axis_is_moving(axis) && sample_axis(axis)) break;
+  }
+}
+
+#endif // TMC_LOAD_TELEMETRY
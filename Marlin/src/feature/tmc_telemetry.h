@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/tmc_telemetry.h - Per-move motor load telemetry for TMC drivers
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+#ifndef TMC_LOAD_REPORT_MS
+  #define TMC_LOAD_REPORT_MS 250
+#endif
+
+class TMCLoadTelemetry {
+  public:
+    // Take one sample per interval of 1ms units, set by M123 S<ms>
+    struct AutoReportLoad { static void report() { sample(); } };
+    static AutoReporter<AutoReportLoad, 1> auto_reporter;
+
+    // A non-zero tag for each planned move, stored in the block
+    static inline uint16_t next_move_id() {
+      if (!++last_move_id) ++last_move_id;
+      return last_move_id;
+    }
+
+  private:
+    typedef struct {
+      uint16_t count, sg_min, sg_max;
+      uint32_t sg_sum, cs_sum;
+      void add(const uint16_t sg, const uint8_t cs) {
+        if (count == 0xFFFF) return;
+        if (!count++) sg_min = sg_max = sg;
+        else { NOMORE(sg_min, sg); NOLESS(sg_max, sg); }
+        sg_sum += sg;
+        cs_sum += cs;
+      }
+    } load_stats_t;
+
+    static uint16_t last_move_id, first_move_id, report_move_id;
+    static millis_t next_report_ms;
+    static uint8_t next_axis, last_cs[XYZE], cs_age[XYZE];
+    static load_stats_t stats[XYZE];
+
+    static bool sample_axis(const AxisEnum axis);
+    static void sample();
+    static void report();
+};
+
+extern TMCLoadTelemetry tmc_telemetry;
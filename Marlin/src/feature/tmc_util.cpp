@@ -326,81 +326,97 @@
     return should_step_down;
   }
 
-  void monitor_tmc_drivers() {
-    const millis_t ms = millis();
-
-    // Poll TMC drivers at the configured interval
-    static millis_t next_poll = 0;
-    const bool need_update_error_counters = ELAPSED(ms, next_poll);
-    if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
-
-    // Also poll at intervals for debugging
-    #if ENABLED(TMC_DEBUG)
-      static millis_t next_debug_reporting = 0;
-      const bool need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
-      if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
-    #else
-      constexpr bool need_debug_reporting = false;
-    #endif
+  // Drivers in the order they are polled
+  enum TMCMonitorIndex : uint8_t {
+    MON_X, MON_X2, MON_Y, MON_Y2, MON_Z, MON_Z2, MON_Z3, MON_Z4,
+    MON_E0, MON_E1, MON_E2, MON_E3, MON_E4, MON_E5, MON_E6, MON_E7,
+    MON_COUNT
+  };
 
-    if (need_update_error_counters || need_debug_reporting) {
+  // Read and evaluate one driver, setting 'step_down' if its current should be reduced.
+  // Return 'false' if there's no TMC driver at this index.
+  static bool monitor_tmc_driver(const TMCMonitorIndex index, const bool need_update_error_counters, const bool need_debug_reporting, bool &step_down) {
+    #define _MON_CASE(A) case MON_##A: step_down = monitor_tmc_driver(stepper##A, need_update_error_counters, need_debug_reporting); return true
+    switch (index) {
+      #if AXIS_IS_TMC(X)
+        _MON_CASE(X);
+      #endif
+      #if AXIS_IS_TMC(X2)
+        _MON_CASE(X2);
+      #endif
+      #if AXIS_IS_TMC(Y)
+        _MON_CASE(Y);
+      #endif
+      #if AXIS_IS_TMC(Y2)
+        _MON_CASE(Y2);
+      #endif
+      #if AXIS_IS_TMC(Z)
+        _MON_CASE(Z);
+      #endif
+      #if AXIS_IS_TMC(Z2)
+        _MON_CASE(Z2);
+      #endif
+      #if AXIS_IS_TMC(Z3)
+        _MON_CASE(Z3);
+      #endif
+      #if AXIS_IS_TMC(Z4)
+        _MON_CASE(Z4);
+      #endif
+      #if AXIS_IS_TMC(E0)
+        _MON_CASE(E0);
+      #endif
+      #if AXIS_IS_TMC(E1)
+        _MON_CASE(E1);
+      #endif
+      #if AXIS_IS_TMC(E2)
+        _MON_CASE(E2);
+      #endif
+      #if AXIS_IS_TMC(E3)
+        _MON_CASE(E3);
+      #endif
+      #if AXIS_IS_TMC(E4)
+        _MON_CASE(E4);
+      #endif
+      #if AXIS_IS_TMC(E5)
+        _MON_CASE(E5);
+      #endif
+      #if AXIS_IS_TMC(E6)
+        _MON_CASE(E6);
+      #endif
+      #if AXIS_IS_TMC(E7)
+        _MON_CASE(E7);
+      #endif
+      default: return false;
+    }
+    #undef _MON_CASE
+  }
 
+  // Step down the current of all the drivers of an axis together
+  static void step_current_down_axis(const AxisEnum axis) {
+    switch (axis) {
+      default: break;
       #if AXIS_IS_TMC(X) || AXIS_IS_TMC(X2)
-      {
-        bool result = false;
-        #if AXIS_IS_TMC(X)
-          if (monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting)) result = true;
-        #endif
-        #if AXIS_IS_TMC(X2)
-          if (monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting)) result = true;
-        #endif
-        if (result) {
+        case X_AXIS:
           #if AXIS_IS_TMC(X)
             step_current_down(stepperX);
           #endif
           #if AXIS_IS_TMC(X2)
             step_current_down(stepperX2);
           #endif
-        }
-      }
+          break;
       #endif
-
       #if AXIS_IS_TMC(Y) || AXIS_IS_TMC(Y2)
-      {
-        bool result = false;
-        #if AXIS_IS_TMC(Y)
-          if (monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting)) result = true;
-        #endif
-        #if AXIS_IS_TMC(Y2)
-          if (monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting)) result = true;
-        #endif
-        if (result) {
+        case Y_AXIS:
           #if AXIS_IS_TMC(Y)
             step_current_down(stepperY);
           #endif
           #if AXIS_IS_TMC(Y2)
             step_current_down(stepperY2);
           #endif
-        }
-      }
+          break;
       #endif
-
       #if AXIS_IS_TMC(Z) || AXIS_IS_TMC(Z2) || AXIS_IS_TMC(Z3) || AXIS_IS_TMC(Z4)
-      {
-        bool result = false;
-        #if AXIS_IS_TMC(Z)
-          if (monitor_tmc_driver(stepperZ, need_update_error_counters, need_debug_reporting)) result = true;
-        #endif
-        #if AXIS_IS_TMC(Z2)
-          if (monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting)) result = true;
-        #endif
-        #if AXIS_IS_TMC(Z3)
-          if (monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting)) result = true;
-        #endif
-        #if AXIS_IS_TMC(Z4)
-          if (monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting)) result = true;
-        #endif
-        if (result) {
+        case Z_AXIS:
           #if AXIS_IS_TMC(Z)
             step_current_down(stepperZ);
           #endif
@@ -413,35 +429,58 @@
           #if AXIS_IS_TMC(Z4)
             step_current_down(stepperZ4);
           #endif
-        }
-      }
+          break;
       #endif
+    }
+  }
 
-      #if AXIS_IS_TMC(E0)
-        (void)monitor_tmc_driver(stepperE0, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E1)
-        (void)monitor_tmc_driver(stepperE1, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E2)
-        (void)monitor_tmc_driver(stepperE2, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E3)
-        (void)monitor_tmc_driver(stepperE3, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E4)
-        (void)monitor_tmc_driver(stepperE4, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E5)
-        (void)monitor_tmc_driver(stepperE5, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E6)
-        (void)monitor_tmc_driver(stepperE6, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E7)
-        (void)monitor_tmc_driver(stepperE7, need_update_error_counters, need_debug_reporting);
+  /**
+   * Each poll interval starts a pass over all drivers. Every call reads only the
+   * next driver, so a pass over many UART drivers is spread across several idle()
+   * calls instead of stalling one of them. A debug report reads all remaining
+   * drivers at once to keep its line together.
+   */
+  void monitor_tmc_drivers() {
+    static uint8_t poll_index = MON_COUNT;  // MON_COUNT when no pass is under way
+    static bool need_update_error_counters, need_debug_reporting;
+    static uint8_t step_down_axes;          // Axes to step down at the end of the pass
+
+    if (poll_index >= MON_COUNT) {
+      const millis_t ms = millis();
+
+      // Poll TMC drivers at the configured interval
+      static millis_t next_poll = 0;
+      need_update_error_counters = ELAPSED(ms, next_poll);
+      if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
+
+      // Also poll at intervals for debugging
+      #if ENABLED(TMC_DEBUG)
+        static millis_t next_debug_reporting = 0;
+        need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
+        if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
+      #else
+        need_debug_reporting = false;
       #endif
 
+      if (!need_update_error_counters && !need_debug_reporting) return;
+
+      poll_index = 0;
+      step_down_axes = 0;
+    }
+
+    // Skip ahead to the next driver and read it
+    while (poll_index < MON_COUNT) {
+      const TMCMonitorIndex index = TMCMonitorIndex(poll_index++);
+      bool step_down = false;
+      if (!monitor_tmc_driver(index, need_update_error_counters, need_debug_reporting, step_down)) continue;
+      if (step_down && index < MON_E0)
+        SBI(step_down_axes, index < MON_Y ? X_AXIS : index < MON_Z ? Y_AXIS : Z_AXIS);
+      if (!need_debug_reporting) break;
+    }
+
+    // Finish the pass once the last driver has been read
+    if (poll_index >= MON_COUNT) {
+      LOOP_XYZ(a) if (TEST(step_down_axes, a)) step_current_down_axis(AxisEnum(a));
       if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
     }
   }
@@ -0,0 +1,128 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/toolchange_preheat.cpp - Heat the next tool ahead of its tool-change
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TOOLCHANGE_PREHEAT)
+
+#include "toolchange_preheat.h"
+#include "sd_lookahead.h"
+#include "time_estimator.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+#include "../module/temperature.h"
+#include "../sd/cardreader.h"
+
+ToolchangePreheat toolchange_preheat;
+
+bool ToolchangePreheat::active; // = false
+int16_t ToolchangePreheat::tool_temp[HOTENDS]; // = { 0 }
+tool_change_t ToolchangePreheat::change[PREHEAT_CHANGES];
+uint8_t ToolchangePreheat::change_count;
+bool ToolchangePreheat::preheated;
+bool ToolchangePreheat::missed;
+uint32_t ToolchangePreheat::missed_sdpos;
+
+void ToolchangePreheat::open() {
+  close();
+  if (TERN0(GCODE_HEATSHRINK, card.flag.inflating)) return;
+  change_count = 0;
+  preheated = missed = false;
+  ZERO(tool_temp);  // Temperatures come from this file, not the last one
+  active = true;
+}
+
+void ToolchangePreheat::task() {
+  if (!active) return;
+
+  // Heat a tool to the temperature it last had while it was the active tool
+  const int16_t target = thermalManager.degTargetHotend(active_extruder);
+  if (target) tool_temp[active_extruder] = target;
+
+  // Where the print is. The SD read position runs ahead by the queued commands.
+  const uint32_t print_sdpos = queue.command_sdpos();
+
+  // Once the tool-change has been run go on to the next one
+  if (change_count && print_sdpos > change[0].sdpos) {
+    change_count--;
+    LOOP_L_N(i, change_count) change[i] = change[i + 1];
+    preheated = false;
+    return;
+  }
+
+  if (!change_count || preheated || change[0].tool == active_extruder || !time_estimator.active()) return;
+
+  const int8_t tool = change[0].tool;
+  const int16_t temp = tool_temp[tool];
+  if (!temp || thermalManager.degTargetHotend(tool) >= temp) return;
+
+  // Start heating when the tool-change is about as far away as the time to heat
+  const uint32_t now_s = time_estimator.time_at(print_sdpos), change_s = time_estimator.time_at(change[0].sdpos);
+  const uint32_t lead_s = change_s > now_s ? (change_s - now_s) * 100UL / _MAX(feedrate_percentage, 1) : 0;
+  const float heat_s = _MAX(0, temp - thermalManager.degHotend(tool)) * RECIPROCAL(TOOLCHANGE_PREHEAT_RATE) + (TOOLCHANGE_PREHEAT_MARGIN);
+  if (lead_s <= heat_s) {
+    thermalManager.setTargetHotend(temp, tool);
+    preheated = true;
+  }
+}
+
+/**
+ * Look for tool-changes, and for the temperatures of tools not used yet
+ */
+void ToolchangePreheat::scan_line(const char * const line, const uint32_t sdpos) {
+  if (!active || missed) return;
+
+  const char * const p = line;
+  if (*p == 'T' && NUMERIC(p[1])) {
+    const int tool = atoi(p + 1);
+    if (!WITHIN(tool, 0, HOTENDS - 1) || sdpos < queue.command_sdpos()) return;
+    if (change_count == PREHEAT_CHANGES) {
+      // Come back for this one when there's room
+      missed = true;
+      missed_sdpos = sdpos;
+      return;
+    }
+    change[change_count++] = { int8_t(tool), sdpos };
+  }
+  else if (*p == 'M' && (atoi(p + 1) == 104 || atoi(p + 1) == 109)) {
+    // A temperature set for a tool that hasn't been used yet
+    const char * const t = strchr(p, 'T'), * const s = strchr(p, 'S');
+    if (t && s) {
+      const int tool = atoi(t + 1), temp = atoi(s + 1);
+      if (WITHIN(tool, 0, HOTENDS - 1) && !tool_temp[tool] && temp > 0) tool_temp[tool] = temp;
+    }
+  }
+}
+
+uint32_t ToolchangePreheat::scan_from(const uint32_t sdpos) {
+  // Go back for the lines dropped while the changes were full
+  const uint32_t from = missed ? missed_sdpos : sdpos;
+  missed = false;
+  // Nothing behind the print matters
+  return _MAX(from, queue.command_sdpos());
+}
+
+#endif // TOOLCHANGE_PREHEAT
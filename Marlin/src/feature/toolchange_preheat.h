@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/toolchange_preheat.h - Heat the next tool ahead of its tool-change
+ *
+ * The SD look-ahead finds the next T commands ahead of the print. The print
+ * time estimate says how long until each one is reached, and the tool starts
+ * heating once that's about as long as it takes to heat.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+// Upcoming tool-changes held while the print catches up
+#define PREHEAT_CHANGES 4
+
+typedef struct {
+  int8_t tool;
+  uint32_t sdpos;
+} tool_change_t;
+
+class ToolchangePreheat {
+  public:
+    static void open();
+    static inline void close() { active = false; }
+    static void task();
+
+    // Lines from the SD look-ahead
+    static void scan_line(const char * const line, const uint32_t sdpos);
+    static inline bool want_lines() { return active && change_count < PREHEAT_CHANGES; }
+
+    // Where the SD look-ahead reads on from, once only the preheat is using it
+    static uint32_t scan_from(const uint32_t sdpos);
+
+  private:
+    static bool active;
+    static int16_t tool_temp[HOTENDS];   // Temperature to heat each tool to
+
+    // The next tool-changes in the file, in order
+    static tool_change_t change[PREHEAT_CHANGES];
+    static uint8_t change_count;
+    static bool preheated;               // The first one is heating
+
+    // Lines were dropped while the changes were full, from missed_sdpos on
+    static bool missed;
+    static uint32_t missed_sdpos;
+};
+
+extern ToolchangePreheat toolchange_preheat;
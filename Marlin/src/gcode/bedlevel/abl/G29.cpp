@@ -53,6 +53,10 @@
   #include "../../../libs/vector_3.h"
 #endif
 
+#if ENABLED(PROBE_ANALOG_SCAN)
+  #include "../../../feature/probe_scan.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
 
@@ -608,6 +612,11 @@ G29_TYPE GcodeSuite::G29() {
 
       xy_int8_t meshCount;
 
+      #if ENABLED(PROBE_ANALOG_SCAN)
+        float row_z[PROBE_SCAN_MAX_POINTS];
+        UNUSED(raise_after);
+      #endif
+
       // Outer loop is X with PROBE_Y_FIRST enabled
       // Outer loop is Y with PROBE_Y_FIRST disabled
       for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
@@ -644,7 +653,40 @@ G29_TYPE GcodeSuite::G29() {
           if (verbose_level) SERIAL_ECHOLNPAIR("Probing mesh point ", pt_index, "/", abl_points, ".");
           TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), int(pt_index), int(abl_points)));
 
-          measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, raise_after, verbose_level);
+          #if ENABLED(PROBE_ANALOG_SCAN)
+
+            // Sweep the whole row from its first point
+            if (!faux && PR_INNER_VAR == inStart) {
+              const xy_int8_t thisCount = meshCount;
+              PR_INNER_VAR = inStop - inInc;
+              const xy_pos_t rowEnd = probe_position_lf + gridSpacing * meshCount.asFloat();
+              meshCount = thisCount;
+              if (probe_scan.scan_row(probePos, rowEnd, PR_INNER_END, row_z)) row_z[0] = NAN;
+            }
+
+            measured_z = faux ? 0.001f * random(-100, 101) : row_z[(PR_INNER_VAR - inStart) * inInc];
+
+          #else
+
+            // The zig-zag always steps to a neighboring point, so a small raise will do
+            ProbePtRaise pt_raise = raise_after;
+            #if HAS_ADJACENT_PROBE_CLEARANCE
+              if (raise_after == PROBE_PT_RAISE) {
+                pt_raise = PROBE_PT_NEAR_RAISE;
+                #if IS_KINEMATIC
+                  // Points beyond the round bed are skipped, so peek at the next one
+                  const xy_int8_t thisCount = meshCount;
+                  PR_INNER_VAR += inInc;
+                  if (PR_INNER_VAR == inStop) { PR_INNER_VAR -= inInc; PR_OUTER_VAR++; }
+                  if (!probe.can_reach(probe_position_lf + gridSpacing * meshCount.asFloat())) pt_raise = PROBE_PT_RAISE;
+                  meshCount = thisCount;
+                #endif
+              }
+            #endif
+
+            measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, pt_raise, verbose_level);
+
+          #endif
 
           if (isnan(measured_z)) {
             set_bed_leveling_enabled(abl_should_enable);
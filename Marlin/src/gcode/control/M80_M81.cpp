@@ -92,6 +92,7 @@ void GcodeSuite::M81() {
   planner.finish_and_disable();
 
   print_job_timer.stop();
+  TERN_(PRINTCOUNTER_RING, print_job_timer.flushStats());
 
   #if HAS_FAN
     thermalManager.zero_fan_speeds();
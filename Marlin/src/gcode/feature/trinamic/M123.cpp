@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(TMC_LOAD_TELEMETRY)
+
+#include "../../gcode.h"
+#include "../../../feature/tmc_telemetry.h"
+
+/**
+ * M123: Set the TMC load telemetry sample interval. M123 S<milliseconds> (1-255)
+ *       M123 S0 stops the telemetry stream.
+ */
+void GcodeSuite::M123() {
+
+  if (parser.seenval('S'))
+    tmc_telemetry.auto_reporter.set_interval(parser.value_byte(), 255);
+
+}
+
+#endif // TMC_LOAD_TELEMETRY
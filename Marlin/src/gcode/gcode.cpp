@@ -471,6 +471,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
 
       case 31: M31(); break;                                      // M31: Report time since the start of SD print or last M109
 
+      #if ENABLED(GCODE_HEATSHRINK)
+        case 37: M37(); break;                                    // M37: Receive a compressed G-code block
+      #endif
+
       #if ENABLED(DIRECT_PIN_CONTROL)
         case 42: M42(); break;                                    // M42: Change pin state
       #endif
@@ -495,10 +499,22 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 78: M78(); break;                                    // M78: Show print statistics
       #endif
 
+      #if ENABLED(PRINT_TIME_ESTIMATOR)
+        case 79: M79(); break;                                    // M79: Report print time estimate
+      #endif
+
       #if ENABLED(M100_FREE_MEMORY_WATCHER)
         case 100: M100(); break;                                  // M100: Free Memory Report
       #endif
 
+      #if ENABLED(BOOT_PROFILER)
+        case 101: M101(); break;                                  // M101: Boot Profile Report
+      #endif
+
+      #if ENABLED(IDLE_TASK_SCHEDULER)
+        case 102: M102(); break;                                  // M102: Idle Task Report
+      #endif
+
       #if EXTRUDERS
         case 104: M104(); break;                                  // M104: Set hot end temperature
         case 109: M109(); break;                                  // M109: Wait for hotend temperature to reach target
@@ -875,6 +891,9 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
 
       #if HAS_TRINAMIC_CONFIG
         case 122: M122(); break;                                  // M122: Report driver configuration and status
+        #if ENABLED(TMC_LOAD_TELEMETRY)
+          case 123: M123(); break;                                // M123: Set load telemetry sample interval
+        #endif
         case 906: M906(); break;                                  // M906: Set motor current in milliamps using axis codes X, Y, Z, E
         #if HAS_STEALTHCHOP
           case 569: M569(); break;                                // M569: Enable stealthChop on an axis.
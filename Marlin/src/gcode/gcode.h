@@ -96,7 +96,7 @@
  * M23  - Select SD file: "M23 /path/file.gco". (Requires SDSUPPORT)
  * M24  - Start/resume SD print. (Requires SDSUPPORT)
  * M25  - Pause SD print. (Requires SDSUPPORT)
- * M26  - Set SD position in bytes: "M26 S12345". (Requires SDSUPPORT)
+ * M26  - Set SD position in bytes: "M26 S12345", or to a layer: "M26 L12". (Requires SDSUPPORT, SD_LAYER_INDEX for layers)
  * M27  - Report SD print status. (Requires SDSUPPORT)
  *        OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *        OR, with 'C' get the current filename.
@@ -109,6 +109,7 @@
  *        The '#' is necessary when calling from within sd files, as it stops buffer prereading
  * M33  - Get the longname version of a path. (Requires LONG_FILENAME_HOST_SUPPORT)
  * M34  - Set SD Card sorting options. (Requires SDCARD_SORT_ALPHA)
+ * M37  - Receive a heatshrink-compressed block: M37 S<bytes>. Report decoder settings without S. (Requires GCODE_HEATSHRINK)
  * M42  - Change pin status via gcode: M42 P<pin> S<value>. LED pin assumed if P is omitted. (Requires DIRECT_PIN_CONTROL)
  * M43  - Display pin status, watch pins for changes, watch endstops & toggle LED, Z servo probe test, toggle pins
  * M48  - Measure Z Probe repeatability: M48 P<points> X<pos> Y<pos> V<level> E<engage> L<legs> S<chizoid>. (Requires Z_MIN_PROBE_REPEATABILITY_TEST)
@@ -117,6 +118,7 @@
  * M76  - Pause the print job timer.
  * M77  - Stop the print job timer.
  * M78  - Show statistical information about the print jobs. (Requires PRINTCOUNTER)
+ * M79  - Report the estimated remaining and total print time. (Requires PRINT_TIME_ESTIMATOR)
  * M80  - Turn on Power Supply. (Requires PSU_CONTROL)
  * M81  - Turn off Power Supply. (Requires PSU_CONTROL)
  * M82  - Set E codes absolute (default).
@@ -126,6 +128,8 @@
  * M85  - Set inactivity shutdown timer with parameter S<seconds>. To disable set zero (default)
  * M92  - Set planner.settings.axis_steps_per_mm for one or more axes.
  * M100 - Watch Free Memory (for debugging) (Requires M100_FREE_MEMORY_WATCHER)
+ * M101 - Report the time taken by each step of startup. (Requires BOOT_PROFILER)
+ * M102 - Report the time taken by each idle() task. "M102 R" to reset. (Requires IDLE_TASK_SCHEDULER)
  * M104 - Set extruder target temp.
  * M105 - Report current temperatures.
  * M106 - Set print fan speed.
@@ -146,6 +150,7 @@
  * M120 - Enable endstops detection.
  * M121 - Disable endstops detection.
  * M122 - Debug stepper (Requires at least one _DRIVER_TYPE defined as TMC2130/2160/5130/5160/2208/2209/2660 or L6470)
+ * M123 - Set the TMC load telemetry sample interval. (Requires TMC_LOAD_TELEMETRY)
  * M125 - Save current position and move to filament change position. (Requires PARK_HEAD_ON_PAUSE)
  * M126 - Solenoid Air Valve Open. (Requires BARICUDA)
  * M127 - Solenoid Air Valve Closed. (Requires BARICUDA)
@@ -554,6 +559,8 @@ private:
     #endif
   #endif
 
+  TERN_(GCODE_HEATSHRINK, static void M37());
+
   TERN_(DIRECT_PIN_CONTROL, static void M42());
   TERN_(PINS_DEBUGGING, static void M43());
 
@@ -567,6 +574,8 @@ private:
 
   TERN_(PRINTCOUNTER, static void M78());
 
+  TERN_(PRINT_TIME_ESTIMATOR, static void M79());
+
   TERN_(PSU_CONTROL, static void M80());
 
   static void M81();
@@ -577,6 +586,9 @@ private:
 
   TERN_(M100_FREE_MEMORY_WATCHER, static void M100());
 
+  TERN_(BOOT_PROFILER, static void M101());
+  TERN_(IDLE_TASK_SCHEDULER, static void M102());
+
   #if EXTRUDERS
     static void M104();
     static void M109();
@@ -847,6 +859,7 @@ private:
 
   #if HAS_TRINAMIC_CONFIG
     static void M122();
+    TERN_(TMC_LOAD_TELEMETRY, static void M123());
     static void M906();
     TERN_(HAS_STEALTHCHOP, static void M569());
     #if ENABLED(MONITOR_DRIVER_STATUS)
@@ -144,6 +144,9 @@ void GcodeSuite::M115() {
     // MEATPACK Compresson
     cap_line(PSTR("MEATPACK"), ENABLED(MEATPACK));
 
+    // Heatshrink Compression (M37)
+    cap_line(PSTR("HEATSHRINK"), ENABLED(GCODE_HEATSHRINK));
+
     // Machine Geometry
     #if ENABLED(M115_GEOMETRY_REPORT)
       const xyz_pos_t dmin = { X_MIN_POS, Y_MIN_POS, Z_MIN_POS },
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_HEATSHRINK)
+
+#include "../gcode.h"
+#include "../../libs/heatshrink/heatshrink_config.h"
+
+/**
+ * M37: Heatshrink-compressed G-code
+ *
+ *  S<bytes> - The next <bytes> bytes on this serial port are an independently
+ *             compressed heatshrink stream. The queue takes the block as soon
+ *             as it reads this line, so by now there's nothing left to do.
+ *
+ * Without S, report the window and lookahead bits the decoder expects.
+ */
+void GcodeSuite::M37() {
+  if (parser.seen('S')) return;
+  SERIAL_ECHOLNPAIR("HEATSHRINK:", HEATSHRINK_STATIC_WINDOW_BITS, ",", HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+}
+
+#endif // GCODE_HEATSHRINK
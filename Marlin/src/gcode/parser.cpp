@@ -109,6 +109,7 @@ void GCodeParser::reset() {
 // Populate all fields by parsing a single line of GCode
 // 58 bytes of SRAM are used to speed up seen/value
 void GCodeParser::parse(char *p) {
+  HAL_PROFILE(GCODE_PARSE);
 
   reset(); // No codes to report
 
@@ -57,6 +57,14 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(GCODE_HEATSHRINK)
+  #include "../feature/heatshrink_gcode.h"
+#endif
+
+#if ENABLED(CANCEL_OBJECTS_FAST_SKIP)
+  #include "../feature/cancel_object.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -67,6 +75,15 @@ GCodeQueue::RingBuffer GCodeQueue::ring_buffer = { 0 };
   static millis_t last_command_time = 0;
 #endif
 
+#if ENABLED(GCODE_HEATSHRINK)
+  // A compressed block announced with M37 S<bytes>
+  static GcodeInflater serial_inflater;
+  enum InflateState : uint8_t { INFLATE_OFF, INFLATE_ON, INFLATE_SKIP };
+  static InflateState inflate_state; // = INFLATE_OFF
+  static uint8_t inflate_port;
+  static uint32_t inflate_count;  // Compressed bytes still to come
+#endif
+
 /**
  * Serial command injection
  */
@@ -82,6 +99,10 @@ PGM_P GCodeQueue::injected_commands_P; // = nullptr
  */
 char GCodeQueue::injected_commands[64]; // = { 0 }
 
+#if HAS_COMMAND_SDPOS
+  uint32_t GCodeQueue::sd_line_sdpos; // = 0
+#endif
+
 
 void GCodeQueue::RingBuffer::commit_command(bool skip_ok
   #if HAS_MULTI_SERIAL
@@ -90,6 +111,7 @@ void GCodeQueue::RingBuffer::commit_command(bool skip_ok
 ) {
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
+  TERN_(HAS_COMMAND_SDPOS, commands[index_w].sdpos = sd_line_sdpos);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   advance_pos(index_w, 1);
 }
@@ -273,21 +295,76 @@ void GCodeQueue::flush_and_request_resend() {
   SERIAL_ECHOLN(serial_state[serial_ind].last_N + 1);
 }
 
+inline int read_serial(const uint8_t index) {
+  #if ENABLED(GCODE_HEATSHRINK)
+    if (index == inflate_port) switch (inflate_state) {
+      case INFLATE_ON: return serial_inflater.read();
+      case INFLATE_SKIP: {                      // Count off the block bytes
+        const int c = SERIAL_IMPL.read(index);
+        if (c >= 0 && !--inflate_count) inflate_state = INFLATE_OFF;
+        return c;
+      }
+      default: break;
+    }
+  #endif
+  return SERIAL_IMPL.read(index);
+}
+
+#if ENABLED(GCODE_HEATSHRINK)
+
+  /**
+   * Feed the compressed block to the decoder until a decoded byte is ready.
+   * The block doesn't have to end on a line boundary.
+   */
+  inline bool inflate_available(const uint8_t index) {
+    // Drop a block that can't be used
+    while (inflate_state == INFLATE_SKIP && SERIAL_IMPL.available(index) > 0) read_serial(index);
+    if (inflate_state != INFLATE_ON) return false;
+    while (!serial_inflater.has_output()) {
+      if (!inflate_count) { inflate_state = INFLATE_OFF; return false; }
+      if (SERIAL_IMPL.available(index) <= 0) return false;
+      uint8_t c = (uint8_t)SERIAL_IMPL.read(index);
+      inflate_count--;
+      serial_inflater.sink(&c, 1);
+    }
+    return true;
+  }
+
+  /**
+   * The block announced by "M37 S<bytes>" comes right after the line,
+   * so it has to be taken here, long before M37 reaches the queue head.
+   * If the line is then rejected, gcode_line_error() skips the block.
+   */
+  inline void early_parse_M37(const char *command, const uint8_t index) {
+    if (*command == 'N') {                      // Skip over the line number
+      while (*command && *command != ' ') command++;
+      while (*command == ' ') command++;
+    }
+    if (command[0] != 'M' || command[1] != '3' || command[2] != '7' || NUMERIC(command[3])) return;
+    const char * const spos = strchr(command + 3, 'S');
+    if (!spos) return;
+    inflate_count = strtoul(spos + 1, nullptr, 10);
+    inflate_port = index;
+    inflate_state = INFLATE_ON;
+    serial_inflater.reset();
+  }
+
+#endif
+
 // Multiserial already handle the dispatch to/from multiple port by itself
 inline bool serial_data_available(uint8_t index = SERIAL_ALL) {
   if (index == SERIAL_ALL) {
-    for (index = 0; index < NUM_SERIAL; index++) {
-      const int a = SERIAL_IMPL.available(index);
-      #if BOTH(RX_BUFFER_MONITOR, RX_BUFFER_SIZE)
-        if (a > RX_BUFFER_SIZE - 2) {
-          PORT_REDIRECT(SERIAL_PORTMASK(index));
-          SERIAL_ERROR_MSG("RX BUF overflow, increase RX_BUFFER_SIZE: ", a);
-        }
-      #endif
-      if (a > 0) return true;
-    }
+    for (index = 0; index < NUM_SERIAL; index++)
+      if (serial_data_available(index)) return true;
     return false;
   }
+  #if ENABLED(GCODE_HEATSHRINK)
+    // Raw bytes on the port belong to the block until it ends
+    if (index == inflate_port) {
+      const bool ready = inflate_available(index);
+      if (inflate_state != INFLATE_OFF) return ready;
+    }
+  #endif
   const int a = SERIAL_IMPL.available(index);
   #if BOTH(RX_BUFFER_MONITOR, RX_BUFFER_SIZE)
     if (a > RX_BUFFER_SIZE - 2) {
@@ -299,12 +376,15 @@ inline bool serial_data_available(uint8_t index = SERIAL_ALL) {
   return a > 0;
 }
 
-inline int read_serial(const uint8_t index) { return SERIAL_IMPL.read(index); }
-
 void GCodeQueue::gcode_line_error(PGM_P const err, const serial_index_t serial_ind) {
   PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
   SERIAL_ERROR_START();
   SERIAL_ECHOLNPAIR_P(err, serial_state[serial_ind].last_N);
+  #if ENABLED(GCODE_HEATSHRINK)
+    // The host resends from the failed line, so drop the rest of the block
+    if (serial_ind == inflate_port && inflate_state == INFLATE_ON)
+      inflate_state = inflate_count ? INFLATE_SKIP : INFLATE_OFF;
+  #endif
   while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
   flush_and_request_resend();
   serial_state[serial_ind].count = 0;
@@ -456,6 +536,12 @@ void GCodeQueue::get_serial_commands() {
         while (*command == ' ') command++;                   // Skip leading spaces
         char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
 
+        #if ENABLED(GCODE_HEATSHRINK)
+          // Take the block even if the line is rejected, so it can be skipped.
+          // Lines decoded from a block can't announce another one.
+          if (inflate_state != INFLATE_ON || p != inflate_port) early_parse_M37(command, p);
+        #endif
+
         if (npos) {
 
           const bool M110 = !!strstr_P(command, PSTR("M110"));
@@ -563,7 +649,9 @@ void GCodeQueue::get_serial_commands() {
     if (!IS_SD_PRINTING()) return;
 
     int sd_count = 0;
-    while (!ring_buffer.full() && !card.eof()) {
+    // Leave room for the lines that follow up on dropped moves
+    while (!ring_buffer.full(1 + TERN0(CANCEL_OBJECTS_FAST_SKIP, cancelable.sd_flush_lines())) && !card.eof()) {
+      TERN_(HAS_COMMAND_SDPOS, if (!sd_count) sd_line_sdpos = card.getIndex()); // Where the next command starts
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -576,10 +664,30 @@ void GCodeQueue::get_serial_commands() {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
+
+        // A slicer's object label comment becomes M486 S
+        TERN_(CANCEL_OBJECTS_FAST_SKIP, if (!sd_count && cancelable.sd_label_comment(command.buffer)) sd_count = strlen(command.buffer));
+
+        // Moves of a canceled object are dropped here, without queueing or parsing
+        if (!process_line_done(sd_input_state, command.buffer, sd_count)
+          && !TERN0(CANCEL_OBJECTS_FAST_SKIP, cancelable.sd_skip_line(command.buffer))
+        ) {
+
+          #if ENABLED(CANCEL_OBJECTS_FAST_SKIP)
+            // Pass on the E and F of dropped moves ahead of the line
+            if (cancelable.sd_flush_lines()) {
+              char line[MAX_CMD_SIZE];
+              strcpy(line, command.buffer);
+              do {
+                cancelable.sd_get_flush_line(ring_buffer.commands[ring_buffer.index_w].buffer);
+                ring_buffer.commit_command(true);
+              } while (cancelable.sd_flush_lines());
+              strcpy(ring_buffer.commands[ring_buffer.index_w].buffer, line);
+            }
+          #endif
 
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
-          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
+          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(ring_buffer.commands[ring_buffer.index_w].buffer));
 
           // Put the new command into the buffer (no "ok" sent)
           ring_buffer.commit_command(true);
@@ -590,8 +698,10 @@ void GCodeQueue::get_serial_commands() {
 
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
       }
-      else
+      else {
+        TERN_(CANCEL_OBJECTS_FAST_SKIP, if (!sd_count && sd_input_state == PS_EOL) cancelable.sd_comment_char(sd_char));
         process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
+      }
     }
   }
 
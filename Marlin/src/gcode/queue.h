@@ -60,6 +60,7 @@ public:
     char buffer[MAX_CMD_SIZE];                    //!< The command buffer
     bool skip_ok;                                 //!< Skip sending ok when command is processed?
     TERN_(HAS_MULTI_SERIAL, serial_index_t port); //!< Serial port the command was received on
+    TERN_(HAS_COMMAND_SDPOS, uint32_t sdpos);     //!< SD position of the line, or of the last SD line
   };
 
   /**
@@ -157,6 +158,21 @@ public:
    */
   static bool has_commands_queued() { return ring_buffer.length || injected_commands_P || injected_commands[0]; }
 
+  #if HAS_COMMAND_SDPOS
+    /**
+     * SD position of the line last read into the queue
+     */
+    static uint32_t sd_line_sdpos;
+
+    /**
+     * SD position of the command being run, or of the next one to run.
+     * This lags the SD read position by the commands still in the queue.
+     */
+    static inline uint32_t command_sdpos() {
+      return ring_buffer.empty() ? sd_line_sdpos : ring_buffer.peek_next_command().sdpos;
+    }
+  #endif
+
   /**
    * Get the next command in the queue, optionally log it to SD, then dispatch it
    */
@@ -29,10 +29,26 @@
 
 /**
  * M26: Set SD Card file index
+ *
+ *  S<bytes> - File position, as reported by M27
+ *  L<layer> - Start of a layer, from the file's layer index (Requires SD_LAYER_INDEX)
  */
 void GcodeSuite::M26() {
-  if (card.isMounted() && parser.seenval('S'))
-    card.setIndex(parser.value_long());
+  if (!card.isMounted()) return;
+
+  #if ENABLED(SD_LAYER_INDEX)
+    if (parser.seenval('L')) {
+      uint32_t sdpos;
+      if (layer_index.layer_sdpos(parser.value_ulong(), sdpos))
+        card.setIndex(sdpos);
+      else
+        SERIAL_ERROR_MSG("No index for layer ", parser.value_ulong());
+      return;
+    }
+  #endif
+
+  if (parser.seenval('S'))
+    card.setFileIndex(parser.value_long());
 }
 
 #endif // SDSUPPORT
@@ -31,6 +31,7 @@
  * M27: Get SD Card status
  *      OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *      OR, with 'C' get the current filename.
+ *      OR, with 'L' get the current layer and estimated print time. (Requires SD_LAYER_INDEX)
  */
 void GcodeSuite::M27() {
   if (parser.seen('C')) {
@@ -39,6 +40,19 @@ void GcodeSuite::M27() {
     return;
   }
 
+  #if ENABLED(SD_LAYER_INDEX)
+    if (parser.seen('L')) {
+      if (layer_index.loaded()) {
+        const uint32_t sdpos = card.getIndex();
+        SERIAL_ECHOLNPAIR("SD layer ", layer_index.layer_at(sdpos), "/", layer_index.layer_count(),
+                          " time ", layer_index.time_at(sdpos), "/", layer_index.total_time());
+      }
+      else
+        SERIAL_ECHOLNPGM("No layer index");
+      return;
+    }
+  #endif
+
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     if (parser.seenval('S')) {
       card.auto_reporter.set_interval(parser.value_byte());
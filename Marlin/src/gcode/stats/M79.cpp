@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+
+#include "../gcode.h"
+#include "../../feature/time_estimator.h"
+
+/**
+ * M79: Report the estimated remaining and total time of the SD print, in seconds.
+ *      The total is extrapolated from the part of the file modeled so far until "(final)" is shown.
+ */
+void GcodeSuite::M79() {
+  if (time_estimator.active()) {
+    SERIAL_ECHOPAIR("Print time remaining:", time_estimator.remaining(), " total:", time_estimator.total());
+    if (time_estimator.final()) SERIAL_ECHOPGM(" (final)");
+    SERIAL_EOL();
+  }
+  else
+    SERIAL_ECHOLNPGM("No print time estimate");
+}
+
+#endif // PRINT_TIME_ESTIMATOR
@@ -538,3 +538,17 @@
 #else
   #define HAS_USER_ITEM(N) 0
 #endif
+
+#if ENABLED(CANCEL_OBJECTS) && !defined(CANCEL_OBJECTS_COUNT)
+  #define CANCEL_OBJECTS_COUNT 32
+#endif
+
+// Flag whether queued commands keep the SD position of their line
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #define HAS_COMMAND_SDPOS 1
+#endif
+
+// Flag whether a second handle reads the SD print file ahead of the print
+#if ANY(SD_LAYER_INDEX, PRINT_TIME_ESTIMATOR, TOOLCHANGE_PREHEAT)
+  #define HAS_SD_LOOKAHEAD 1
+#endif
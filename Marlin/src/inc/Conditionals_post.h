@@ -2077,7 +2077,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if EITHER(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, TMC_LOAD_TELEMETRY)
   #define HAS_AUTO_REPORTING 1
 #endif
 
@@ -2735,6 +2735,11 @@
   #ifndef Z_CLEARANCE_MULTI_PROBE
     #define Z_CLEARANCE_MULTI_PROBE Z_CLEARANCE_BETWEEN_PROBES
   #endif
+  #ifdef Z_CLEARANCE_ADJACENT_PROBES
+    #define HAS_ADJACENT_PROBE_CLEARANCE 1
+  #else
+    #define Z_CLEARANCE_ADJACENT_PROBES Z_CLEARANCE_BETWEEN_PROBES
+  #endif
   #if ENABLED(BLTOUCH) && !defined(BLTOUCH_DELAY)
     #define BLTOUCH_DELAY 500
   #endif
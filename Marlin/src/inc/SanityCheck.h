@@ -725,6 +725,13 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "SD_REPRINT_LAST_SELECTED_FILE currently requires a Marlin-native LCD menu."
 #endif
 
+/**
+ * FTDI EVE Touch UI asynchronous SPI
+ */
+#if ENABLED(TOUCH_UI_SPI_ASYNC) && (!defined(__STM32F1__) || ENABLED(CLCD_USE_SOFT_SPI))
+  #error "TOUCH_UI_SPI_ASYNC requires STM32F1 with hardware SPI."
+#endif
+
 /**
  * Custom Boot and Status screens
  */
@@ -1399,6 +1406,10 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Probes need Z_CLEARANCE_DEPLOY_PROBE >= 0."
   #elif Z_CLEARANCE_BETWEEN_PROBES < 0
     #error "Probes need Z_CLEARANCE_BETWEEN_PROBES >= 0."
+  #elif Z_CLEARANCE_ADJACENT_PROBES < 0
+    #error "Probes need Z_CLEARANCE_ADJACENT_PROBES >= 0."
+  #elif Z_CLEARANCE_ADJACENT_PROBES > Z_CLEARANCE_BETWEEN_PROBES
+    #error "Z_CLEARANCE_ADJACENT_PROBES must not exceed Z_CLEARANCE_BETWEEN_PROBES."
   #elif Z_AFTER_PROBING < 0
     #error "Probes need Z_AFTER_PROBING >= 0."
   #endif
@@ -1429,6 +1440,24 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #endif
   #endif
 
+  #if ENABLED(PROBE_STEP_LATCH)
+    #if ENABLED(SENSORLESS_PROBING)
+      #error "PROBE_STEP_LATCH requires a probe pin. It is incompatible with SENSORLESS_PROBING."
+    #elif ANY(CORE_IS_XZ, CORE_IS_YZ)
+      #error "PROBE_STEP_LATCH is not compatible with CORE_IS_XZ or CORE_IS_YZ."
+    #endif
+  #endif
+
+  #if ENABLED(PROBE_ANALOG_SCAN)
+    #if !PIN_EXISTS(PROBE_ANALOG)
+      #error "PROBE_ANALOG_SCAN requires a PROBE_ANALOG_PIN to be defined."
+    #elif IS_KINEMATIC
+      #error "PROBE_ANALOG_SCAN is not compatible with DELTA or SCARA."
+    #elif !ABL_GRID && DISABLED(AUTO_BED_LEVELING_UBL)
+      #error "PROBE_ANALOG_SCAN requires AUTO_BED_LEVELING_(LINEAR|BILINEAR|UBL)."
+    #endif
+  #endif
+
 #else
 
   /**
@@ -1438,6 +1467,14 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Auto Bed Leveling requires one of these: PROBE_MANUALLY, SENSORLESS_PROBING, BLTOUCH, FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, TOUCH_MI_PROBE, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or a Z Servo."
   #endif
 
+  #if ENABLED(PROBE_ANALOG_SCAN)
+    #error "PROBE_ANALOG_SCAN requires a probe: FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
+  #endif
+
+  #if ENABLED(PROBE_STEP_LATCH)
+    #error "PROBE_STEP_LATCH requires a probe: FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
+  #endif
+
   #if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
     #error "Z_MIN_PROBE_REPEATABILITY_TEST requires a probe: FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
   #endif
@@ -1920,6 +1957,19 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
   #error "MAX31865_SENSOR_OHMS_1 and MAX31865_CALIBRATION_OHMS_1 must be set if TEMP_SENSOR_1 is MAX31865."
 #endif
 
+/**
+ * ADC DMA Scan
+ */
+#if ENABLED(ADC_DMA_SCAN)
+  #if DISABLED(HAL_ADC_SCAN)
+    #error "ADC_DMA_SCAN is only supported on STM32F1, STM32F4, STM32F7, and LPC176x."
+  #elif !WITHIN(ADC_SCAN_LOOPS, 1, 100)
+    #error "ADC_SCAN_LOOPS must be from 1 to 100."
+  #elif defined(ADC_SCAN_OVERSAMPLE) && !WITHIN(ADC_SCAN_OVERSAMPLE, 1, 64)
+    #error "ADC_SCAN_OVERSAMPLE must be from 1 to 64."
+  #endif
+#endif
+
 /**
  * Test Heater, Temp Sensor, and Extruder Pins
  */
@@ -3127,8 +3177,28 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
     #error "Both SERVICE_NAME_2 and SERVICE_INTERVAL_2 are required."
   #elif defined(SERVICE_INTERVAL_3) != defined(SERVICE_NAME_3)
     #error "Both SERVICE_NAME_3 and SERVICE_INTERVAL_3 are required."
+  #elif ENABLED(PRINTCOUNTER_RING) && !WITHIN(PRINTCOUNTER_RING_SLOTS, 2, 16)
+    #error "PRINTCOUNTER_RING_SLOTS must be between 2 and 16."
   #endif
 #endif
+#if ENABLED(PRINTCOUNTER_HISTOGRAMS) && DISABLED(PRINTCOUNTER_RING)
+  #error "PRINTCOUNTER_HISTOGRAMS requires PRINTCOUNTER_RING."
+#endif
+
+/**
+ * Boot Profiler
+ */
+#if ENABLED(BOOT_PROFILER) && !WITHIN(BOOT_PROFILER_STEPS, 8, 255)
+  #error "BOOT_PROFILER_STEPS must be between 8 and 255."
+#endif
+
+/**
+ * Idle Task Scheduler
+ */
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  static_assert(IDLE_PASS_BUDGET_US > 0, "IDLE_PASS_BUDGET_US must be greater than 0.");
+  static_assert(IDLE_TASK_MAX_DELAY > 0, "IDLE_TASK_MAX_DELAY must be greater than 0.");
+#endif
 
 /**
  * Require soft endstops for certain setups
@@ -3285,6 +3355,17 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "MONITOR_DRIVER_STATUS and SDSUPPORT cannot be used together on boards with shared SPI."
 #endif
 
+/**
+ * TMC load telemetry requirements
+ */
+#if ENABLED(TMC_LOAD_TELEMETRY)
+  #if !HAS_TRINAMIC_CONFIG
+    #error "TMC_LOAD_TELEMETRY requires at least one TMC stepper driver."
+  #elif HAS_TMC_SPI && BOTH(SDSUPPORT, USES_SHARED_SPI)
+    #error "TMC_LOAD_TELEMETRY and SDSUPPORT cannot be used together on boards with shared SPI."
+  #endif
+#endif
+
 // G60/G61 Position Save
 #if SAVED_POSITIONS > 256
   #error "SAVED_POSITIONS must be an integer from 0 to 256."
@@ -3341,6 +3422,58 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "Either enable MEATPACK or enable BINARY_FILE_TRANSFER."
 #endif
 
+/**
+ * Sanity Check for CANCEL_OBJECTS
+ */
+#if ENABLED(CANCEL_OBJECTS)
+  #if !WITHIN(CANCEL_OBJECTS_COUNT, 1, 127)
+    #error "CANCEL_OBJECTS_COUNT must be from 1 to 127."
+  #elif ENABLED(CANCEL_OBJECTS_FAST_SKIP) && DISABLED(SDSUPPORT)
+    #error "CANCEL_OBJECTS_FAST_SKIP requires SDSUPPORT."
+  #elif ENABLED(CANCEL_OBJECTS_FAST_SKIP) && BUFSIZE < 4
+    #error "CANCEL_OBJECTS_FAST_SKIP requires BUFSIZE of 4 or more."
+  #endif
+#elif ENABLED(CANCEL_OBJECTS_FAST_SKIP)
+  #error "CANCEL_OBJECTS_FAST_SKIP requires CANCEL_OBJECTS."
+#endif
+
+/**
+ * Sanity Check for SD_LAYER_INDEX
+ */
+#if ENABLED(SD_LAYER_INDEX)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_LAYER_INDEX requires SDSUPPORT."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_LAYER_INDEX can't write its index with SDCARD_READONLY."
+  #endif
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATOR) && DISABLED(SDSUPPORT)
+  #error "PRINT_TIME_ESTIMATOR requires SDSUPPORT."
+#endif
+
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #if DISABLED(PRINT_TIME_ESTIMATOR)
+    #error "TOOLCHANGE_PREHEAT requires PRINT_TIME_ESTIMATOR."
+  #elif !HAS_MULTI_HOTEND
+    #error "TOOLCHANGE_PREHEAT requires more than one hotend."
+  #endif
+  static_assert(TOOLCHANGE_PREHEAT_RATE > 0, "TOOLCHANGE_PREHEAT_RATE must be greater than 0.");
+#endif
+
+/**
+ * Sanity Check for GCODE_HEATSHRINK
+ */
+#if ENABLED(GCODE_HEATSHRINK)
+  #if ENABLED(MEATPACK)
+    #error "Either enable MEATPACK or enable GCODE_HEATSHRINK."
+  #elif !WITHIN(HEATSHRINK_WINDOW_BITS, 4, 15)
+    #error "HEATSHRINK_WINDOW_BITS must be between 4 and 15."
+  #elif !WITHIN(HEATSHRINK_LOOKAHEAD_BITS, 3, HEATSHRINK_WINDOW_BITS - 1)
+    #error "HEATSHRINK_LOOKAHEAD_BITS must be between 3 and HEATSHRINK_WINDOW_BITS - 1."
+  #endif
+#endif
+
 /**
  * Sanity check for valid stepper driver types
  */
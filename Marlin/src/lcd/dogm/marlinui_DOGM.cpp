@@ -235,6 +235,9 @@ bool MarlinUI::detected() { return true; }
     constexpr uint8_t pages = two_part ? 2 : 1;
     for (uint8_t q = pages; q--;) {
       draw_marlin_bootscreen(q == 0);
+      #if ENABLED(DEFERRED_STARTUP)
+        if (!q) { bootscreen_hold((BOOTSCREEN_TIMEOUT) / pages); break; } // Startup goes on under the last page
+      #endif
       safe_delay((BOOTSCREEN_TIMEOUT) / pages);
     }
   }
@@ -24,6 +24,7 @@
 #if HAS_MARLINUI_U8GLIB
 
 #include "HAL_LCD_com_defines.h"
+#include "u8g_page_diff.h"
 #include <U8glib.h>
 
 #define WIDTH 128
@@ -90,6 +91,7 @@ static const uint8_t u8g_dev_ssd13xx_sleep_off[] PROGMEM = {
 uint8_t u8g_dev_ssd1309_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch(msg) {
     case U8G_DEV_MSG_INIT:
+      TERN_(DOGM_PARTIAL_REFRESH, u8g_page_diff_reset());
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1309_128x64_init_seq);
       break;
@@ -97,6 +99,7 @@ uint8_t u8g_dev_ssd1309_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void
       break;
     case U8G_DEV_MSG_PAGE_NEXT: {
       u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+      if (TERN0(DOGM_PARTIAL_REFRESH, !u8g_page_changed(pb))) break;
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1309_128x64_data_start);
       u8g_WriteByte(u8g, dev, 0x0B0 | pb->p.page);  // Select current page (SSD1306)
       u8g_SetAddress(u8g, dev, 1);                  // Data mode
@@ -58,6 +58,7 @@
 #if HAS_MARLINUI_U8GLIB && DISABLED(TFT_CLASSIC_UI)
 
 #include "HAL_LCD_com_defines.h"
+#include "u8g_page_diff.h"
 
 #define PAGE_HEIGHT        8
 
@@ -104,6 +105,7 @@ void clear_graphics_DRAM(u8g_t *u8g, u8g_dev_t *dev) {
 uint8_t u8g_dev_st7920_128x64_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
+      TERN_(DOGM_PARTIAL_REFRESH, u8g_page_diff_reset());
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7920_128x64_HAL_init_seq);
       clear_graphics_DRAM(u8g, dev);
@@ -114,6 +116,7 @@ uint8_t u8g_dev_st7920_128x64_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
       uint8_t y, i;
       uint8_t *ptr;
       u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+      if (TERN0(DOGM_PARTIAL_REFRESH, !u8g_page_changed(pb))) break;
 
       u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
       u8g_SetChipSelect(u8g, dev, 1);
@@ -147,6 +150,7 @@ uint8_t u8g_dev_st7920_128x64_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
 uint8_t u8g_dev_st7920_128x64_HAL_4x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
+      TERN_(DOGM_PARTIAL_REFRESH, u8g_page_diff_reset());
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7920_128x64_HAL_init_seq);
       clear_graphics_DRAM(u8g, dev);
@@ -159,6 +163,7 @@ uint8_t u8g_dev_st7920_128x64_HAL_4x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
       uint8_t y, i;
       uint8_t *ptr;
       u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+      if (TERN0(DOGM_PARTIAL_REFRESH, !u8g_page_changed(pb))) break;
 
       u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
       u8g_SetChipSelect(u8g, dev, 1);
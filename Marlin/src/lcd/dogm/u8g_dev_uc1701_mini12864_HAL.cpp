@@ -58,6 +58,7 @@
 #if HAS_MARLINUI_U8GLIB
 
 #include "HAL_LCD_com_defines.h"
+#include "u8g_page_diff.h"
 
 #define WIDTH 128
 #define HEIGHT 64
@@ -142,6 +143,7 @@ static const uint8_t u8g_dev_uc1701_mini12864_HAL_data_start[] PROGMEM = {
 uint8_t u8g_dev_uc1701_mini12864_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
+      TERN_(DOGM_PARTIAL_REFRESH, u8g_page_diff_reset());
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_init_seq);
       break;
@@ -150,6 +152,7 @@ uint8_t u8g_dev_uc1701_mini12864_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
 
     case U8G_DEV_MSG_PAGE_NEXT: {
       u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+      if (TERN0(DOGM_PARTIAL_REFRESH, !u8g_page_changed(pb))) break;
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
       u8g_WriteByte(u8g, dev, 0x0B0 | pb->p.page); /* select current page */
       u8g_SetAddress(u8g, dev, 1);           /* data mode */
@@ -171,6 +174,7 @@ uint8_t u8g_dev_uc1701_mini12864_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
 uint8_t u8g_dev_uc1701_mini12864_HAL_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
+      TERN_(DOGM_PARTIAL_REFRESH, u8g_page_diff_reset());
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_init_seq);
       break;
@@ -179,6 +183,7 @@ uint8_t u8g_dev_uc1701_mini12864_HAL_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
 
     case U8G_DEV_MSG_PAGE_NEXT: {
       u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+      if (TERN0(DOGM_PARTIAL_REFRESH, !u8g_page_changed(pb))) break;
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
       u8g_WriteByte(u8g, dev, 0x0B0 | (2 * pb->p.page)); /* select current page */
       u8g_SetAddress(u8g, dev, 1); /* data mode */
@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if HAS_MARLINUI_U8GLIB && ENABLED(DOGM_PARTIAL_REFRESH)
+
+#include "u8g_page_diff.h"
+
+#define PAGE_DIFF_PAGES ((LCD_PIXEL_HEIGHT) / 8)  // Enough for the smallest page height
+
+static_assert(PAGE_DIFF_PAGES <= 8, "DOGM_PARTIAL_REFRESH supports up to 64 pixel rows.");
+
+static uint32_t page_signature[PAGE_DIFF_PAGES];
+static uint8_t page_valid; // One bit per page
+
+// Forget what is on the display, so all pages get sent on the next update
+void u8g_page_diff_reset() { page_valid = 0; }
+
+/**
+ * Return true if the page buffer differs from what was last sent for this page.
+ * The signature is a pair of running sums (as in Fletcher's checksum), which is
+ * cheap enough to compute on AVR and still sensitive to the position of each byte.
+ */
+bool u8g_page_changed(u8g_pb_t * const pb) {
+  const uint8_t page = pb->p.page;
+  if (page >= PAGE_DIFF_PAGES) return true;
+
+  const uint8_t *ptr = (uint8_t *)pb->buf;
+  uint16_t sum1 = 0, sum2 = 0;
+  for (uint16_t i = uint16_t(pb->width) * pb->p.page_height / 8; i--;) {
+    sum1 += *ptr++;
+    sum2 += sum1;
+  }
+  const uint32_t sig = uint32_t(sum2) << 16 | sum1;
+
+  if (TEST(page_valid, page) && page_signature[page] == sig) return false;
+
+  page_signature[page] = sig;
+  SBI(page_valid, page);
+  return true;
+}
+
+#endif // HAS_MARLINUI_U8GLIB && DOGM_PARTIAL_REFRESH
@@ -32,6 +32,7 @@
 #if ENABLED(U8GLIB_ST7920)
 
 #include "ultralcd_st7920_u8glib_rrd_AVR.h"
+#include "u8g_page_diff.h"
 
 #if F_CPU >= 20000000
   #define CPU_ST7920_DELAY_1 DELAY_NS(0)
@@ -119,6 +120,7 @@ uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
   uint8_t i, y;
   switch (msg) {
     case U8G_DEV_MSG_INIT: {
+      TERN_(DOGM_PARTIAL_REFRESH, u8g_page_diff_reset());
       OUT_WRITE(ST7920_CS_PIN, LOW);
       OUT_WRITE(ST7920_DAT_PIN, LOW);
       OUT_WRITE(ST7920_CLK_PIN, HIGH);
@@ -150,6 +152,7 @@ uint8_t u8g_dev_rrd_st7920_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
     case U8G_DEV_MSG_PAGE_NEXT: {
       uint8_t* ptr;
       u8g_pb_t* pb = (u8g_pb_t*)(dev->dev_mem);
+      if (TERN0(DOGM_PARTIAL_REFRESH, !u8g_page_changed(pb))) break;
       y = pb->p.page_y0;
       ptr = (uint8_t*)pb->buf;
 
@@ -77,13 +77,19 @@ uint16_t CLCD::FontMetrics::get_text_width(progmem_str str, size_t n) const {
   return width;
 }
 
+// Queued commands go out ahead of any other access, so everything stays in order
+static inline void ftdi_select() {
+  CLCD::CommandFifo::flush();
+  spi_ftdi_select();
+}
+
 /************************** HOST COMMAND FUNCTION *********************************/
 
 void CLCD::host_cmd(unsigned char host_command, unsigned char byte2) {  // Sends 24-Bit Host Command to LCD
   if (host_command != FTDI::ACTIVE) {
     host_command |= 0x40;
   }
-  spi_ftdi_select();
+  ftdi_select();
   spi_send(host_command);
   spi_send(byte2);
   spi_send(0x00);
@@ -101,7 +107,7 @@ void CLCD::spi_read_addr(uint32_t reg_address) {
 
 // Write 4-Byte Address, Read Multiple Bytes
 void CLCD::mem_read_bulk(uint32_t reg_address, uint8_t *data, uint16_t len) {
-  spi_ftdi_select();
+  ftdi_select();
   spi_read_addr(reg_address);
   spi_read_bulk (data, len);
   spi_ftdi_deselect();
@@ -109,7 +115,7 @@ void CLCD::mem_read_bulk(uint32_t reg_address, uint8_t *data, uint16_t len) {
 
 // Write 4-Byte Address, Read 1-Byte Data
 uint8_t CLCD::mem_read_8(uint32_t reg_address) {
-  spi_ftdi_select();
+  ftdi_select();
   spi_read_addr(reg_address);
   uint8_t r_data = spi_read_8();
   spi_ftdi_deselect();
@@ -119,7 +125,7 @@ uint8_t CLCD::mem_read_8(uint32_t reg_address) {
 // Write 4-Byte Address, Read 2-Bytes Data
 uint16_t CLCD::mem_read_16(uint32_t reg_address) {
   using namespace SPI::least_significant_byte_first;
-  spi_ftdi_select();
+  ftdi_select();
   spi_read_addr(reg_address);
   uint16_t r_data = spi_read_16();
   spi_ftdi_deselect();
@@ -129,7 +135,7 @@ uint16_t CLCD::mem_read_16(uint32_t reg_address) {
 // Write 4-Byte Address, Read 4-Bytes Data
 uint32_t CLCD::mem_read_32(uint32_t reg_address) {
   using namespace SPI::least_significant_byte_first;
-  spi_ftdi_select();
+  ftdi_select();
   spi_read_addr(reg_address);
   uint32_t r_data = spi_read_32();
   spi_ftdi_deselect();
@@ -155,7 +161,7 @@ void CLCD::spi_write_addr(uint32_t reg_address) {
 
 // Write 3-Byte Address, Multiple Bytes, plus padding bytes, from RAM
 void CLCD::mem_write_bulk(uint32_t reg_address, const void *data, uint16_t len, uint8_t padding) {
-  spi_ftdi_select();
+  ftdi_select();
   spi_write_addr(reg_address);
   spi_write_bulk<ram_write>(data, len, padding);
   spi_ftdi_deselect();
@@ -163,7 +169,7 @@ void CLCD::mem_write_bulk(uint32_t reg_address, const void *data, uint16_t len,
 
 // Write 3-Byte Address, Multiple Bytes, plus padding bytes, from PROGMEM
 void CLCD::mem_write_bulk(uint32_t reg_address, progmem_str str, uint16_t len, uint8_t padding) {
-  spi_ftdi_select();
+  ftdi_select();
   spi_write_addr(reg_address);
   spi_write_bulk<pgm_write>(str, len, padding);
   spi_ftdi_deselect();
@@ -171,7 +177,7 @@ void CLCD::mem_write_bulk(uint32_t reg_address, progmem_str str, uint16_t len, u
 
  // Write 3-Byte Address, Multiple Bytes, plus padding bytes, from PROGMEM
 void CLCD::mem_write_pgm(uint32_t reg_address, const void *data, uint16_t len, uint8_t padding) {
-  spi_ftdi_select();
+  ftdi_select();
   spi_write_addr(reg_address);
   spi_write_bulk<pgm_write>(data, len, padding);
   spi_ftdi_deselect();
@@ -179,7 +185,7 @@ void CLCD::mem_write_pgm(uint32_t reg_address, const void *data, uint16_t len, u
 
 // Write 3-Byte Address, Multiple Bytes, plus padding bytes, from PROGMEM, reversing bytes (suitable for loading XBM images)
 void CLCD::mem_write_xbm(uint32_t reg_address, progmem_str data, uint16_t len, uint8_t padding) {
-  spi_ftdi_select();
+  ftdi_select();
   spi_write_addr(reg_address);
   spi_write_bulk<xbm_write>(data, len, padding);
   spi_ftdi_deselect();
@@ -187,7 +193,7 @@ void CLCD::mem_write_xbm(uint32_t reg_address, progmem_str data, uint16_t len, u
 
 // Write 3-Byte Address, Write 1-Byte Data
 void CLCD::mem_write_8(uint32_t reg_address, uint8_t data) {
-  spi_ftdi_select();
+  ftdi_select();
   spi_write_addr(reg_address);
   spi_write_8(data);
   spi_ftdi_deselect();
@@ -196,7 +202,7 @@ void CLCD::mem_write_8(uint32_t reg_address, uint8_t data) {
 // Write 3-Byte Address, Write 2-Bytes Data
 void CLCD::mem_write_16(uint32_t reg_address, uint16_t data) {
   using namespace SPI::least_significant_byte_first;
-  spi_ftdi_select();
+  ftdi_select();
   spi_write_addr(reg_address);
   spi_write_16(data);
   spi_ftdi_deselect();
@@ -205,7 +211,7 @@ void CLCD::mem_write_16(uint32_t reg_address, uint16_t data) {
 // Write 3-Byte Address, Write 4-Bytes Data
 void CLCD::mem_write_32(uint32_t reg_address, uint32_t data) {
   using namespace SPI::least_significant_byte_first;
-  spi_ftdi_select();
+  ftdi_select();
   spi_write_addr(reg_address);
   spi_write_32(data);
   spi_ftdi_deselect();
@@ -213,7 +219,7 @@ void CLCD::mem_write_32(uint32_t reg_address, uint32_t data) {
 
 // Fill area of len size with repeated data bytes
 void CLCD::mem_write_fill(uint32_t reg_address, uint8_t data, uint16_t len) {
-  spi_ftdi_select();
+  ftdi_select();
   spi_write_addr(reg_address);
   while (len--) spi_write_8(data);
   spi_ftdi_deselect();
@@ -612,6 +618,20 @@ void CLCD::CommandFifo::inflate(uint32_t ptr) {
   cmd( &cmd_data, sizeof(cmd_data) );
 }
 
+// Inflates a zlib stream from PROGMEM into RAMG. The stream is fed to
+// the FIFO in pieces, executing each one so the coprocessor drains it.
+void CLCD::CommandFifo::inflate(uint32_t ptr, progmem_str data, uint32_t len) {
+  inflate(ptr);
+  const char *p = (const char*)data;
+  while (len) {
+    const uint16_t n = len < 1024 ? len : 1024;
+    if (!write(progmem_str(p), n)) break;
+    execute();
+    p   += n;
+    len -= n;
+  }
+}
+
 void CLCD::CommandFifo::getptr(uint32_t result) {
   struct {
     uint32_t  type = CMD_GETPTR;
@@ -914,6 +934,8 @@ void CLCD::CommandFifo::execute() {
   }
 }
 
+bool CLCD::CommandFifo::flush() { return true; }
+
 void CLCD::CommandFifo::reset() {
   safe_delay(100);
   mem_write_32(REG::CPURESET,  0x00000001);
@@ -985,30 +1007,48 @@ template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
          _write_unaligned(pad_bytes, padding);
 }
 #else
+uint16_t CLCD::CommandFifo::cmd_space; // = 0
+#if CLCD_CMD_QUEUE_SIZE
+  #if ENABLED(TOUCH_UI_SPI_ASYNC)
+    uint8_t CLCD::CommandFifo::queue_buf[2][CLCD_CMD_QUEUE_SIZE];
+    uint8_t *CLCD::CommandFifo::queue = queue_buf[0];
+  #else
+    uint8_t CLCD::CommandFifo::queue[CLCD_CMD_QUEUE_SIZE];
+  #endif
+  uint16_t CLCD::CommandFifo::queued; // = 0
+#endif
+
 void CLCD::CommandFifo::start() {
 }
 
 void CLCD::CommandFifo::execute() {
+  flush();
+  TERN_(TOUCH_UI_SPI_ASYNC, spi_write_block_finish());
 }
 
 void CLCD::CommandFifo::reset() {
   #if ENABLED(TOUCH_UI_DEBUG)
     SERIAL_ECHOLNPGM("Resetting command processor");
   #endif
+  // The queued commands belong to the display list being abandoned,
+  // so drop them rather than sending them into the faulted FIFO.
+  TERN_(CLCD_CMD_QUEUE_SIZE, queued = 0);
   safe_delay(100);
   mem_write_32(REG::CPURESET,  0x00000001);
   mem_write_32(REG::CMD_WRITE, 0x00000000);
   mem_write_32(REG::CMD_READ,  0x00000000);
   mem_write_32(REG::CPURESET,  0x00000000);
   safe_delay(300);
+  cmd_space = 0;
 };
 
-// Writes len bytes into the FIFO, if len is not
-// divisible by four, zero bytes will be written
-// to align to the boundary.
+// The FT810 provides a special register that can be used
+// for writing data without us having to do our own FIFO
+// management. The space it reports is remembered, so it
+// only has to be read again when the writes have used it up.
 
-template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
-  const uint8_t padding = MULTIPLE_OF_4(len) - len;
+bool CLCD::CommandFifo::wait_for_space(const uint16_t len) {
+  if (cmd_space >= len) return true;
 
   if (has_fault()) {
     #if ENABLED(TOUCH_UI_DEBUG)
@@ -1016,30 +1056,87 @@ template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
     #endif
     return false;
   }
-  // The FT810 provides a special register that can be used
-  // for writing data without us having to do our own FIFO
-  // management.
-  uint16_t Command_Space = mem_read_32(REG::CMDB_SPACE) & 0x0FFF;
-  if (Command_Space < (len + padding)) {
+  cmd_space = mem_read_32(REG::CMDB_SPACE) & 0x0FFF;
+  if (cmd_space < len) {
     #if ENABLED(TOUCH_UI_DEBUG)
       SERIAL_ECHO_START();
-      SERIAL_ECHOPAIR("Waiting for ", len + padding);
-      SERIAL_ECHOLNPAIR(" bytes in command queue, now free: ", Command_Space);
+      SERIAL_ECHOPAIR("Waiting for ", len);
+      SERIAL_ECHOLNPAIR(" bytes in command queue, now free: ", cmd_space);
     #endif
     do {
-      Command_Space = mem_read_32(REG::CMDB_SPACE) & 0x0FFF;
+      cmd_space = mem_read_32(REG::CMDB_SPACE) & 0x0FFF;
       if (has_fault()) {
         #if ENABLED(TOUCH_UI_DEBUG)
           SERIAL_ECHOLNPGM("... fault");
         #endif
+        cmd_space = 0;
         return false;
       }
-    } while (Command_Space < len + padding);
+    } while (cmd_space < len);
     #if ENABLED(TOUCH_UI_DEBUG)
       SERIAL_ECHOLNPGM("... done");
     #endif
   }
+  return true;
+}
+
+// Send the queued commands to REG::CMDB_WRITE in one burst
+
+bool CLCD::CommandFifo::flush() {
+  #if CLCD_CMD_QUEUE_SIZE
+    static bool flushing; // Reads made while waiting for space must not flush again
+    const uint16_t len = queued;
+    if (!len || flushing) return true;
+    flushing = true;
+    const bool ok = wait_for_space(len);
+    if (ok) {
+      spi_ftdi_select();
+      spi_write_addr(REG::CMDB_WRITE);
+      #if ENABLED(TOUCH_UI_SPI_ASYNC)
+        // DMA sends this batch while the next one goes into the other buffer
+        spi_write_block_async(queue, len);
+        queue = queue_buf[queue == queue_buf[0]];
+      #else
+        spi_write_block(queue, len);
+        spi_ftdi_deselect();
+      #endif
+      cmd_space -= len;
+      queued = 0; // Keep the commands until they are really sent
+    }
+    flushing = false;
+    return ok;
+  #else
+    return true;
+  #endif
+}
+
+#if CLCD_CMD_QUEUE_SIZE
+  static inline void copy_cmd_bytes(uint8_t *dst, const void *src, uint16_t len) { memcpy(dst, src, len); }
+  static inline void copy_cmd_bytes(uint8_t *dst, progmem_str src, uint16_t len) { memcpy_P(dst, (const char*)src, len); }
+#endif
+
+// Writes len bytes into the FIFO, if len is not
+// divisible by four, zero bytes will be written
+// to align to the boundary.
+
+template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
+  const uint8_t padding = MULTIPLE_OF_4(len) - len;
+
+  #if CLCD_CMD_QUEUE_SIZE
+    // Queue anything that fits, flushing first if the queue is too full
+    if (len + padding <= CLCD_CMD_QUEUE_SIZE) {
+      if (queued + len + padding > CLCD_CMD_QUEUE_SIZE && !flush()) return false;
+      copy_cmd_bytes(queue + queued, data, len);
+      ::memset(queue + queued + len, 0, padding);
+      queued += len + padding;
+      return true;
+    }
+    if (!flush()) return false;
+  #endif
+
+  if (!wait_for_space(len + padding)) return false;
   mem_write_bulk(REG::CMDB_WRITE, data, len, padding);
+  cmd_space -= len + padding;
   return true;
 }
 #endif
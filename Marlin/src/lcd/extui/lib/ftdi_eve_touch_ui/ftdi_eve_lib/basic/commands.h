@@ -173,10 +173,31 @@ class CLCD::FontMetrics {
 
 /******************* FT800/810 Graphic Commands *********************************/
 
+// On the FT810 and later, commands are queued in RAM and sent in bursts.
+// Set to 0 to send each command as it comes.
+#ifndef CLCD_CMD_QUEUE_SIZE
+  #ifdef __AVR__
+    #define CLCD_CMD_QUEUE_SIZE 64
+  #else
+    #define CLCD_CMD_QUEUE_SIZE 512
+  #endif
+#endif
+
 class CLCD::CommandFifo {
   protected:
     #if FTDI_API_LEVEL >= 810
       uint32_t getRegCmdBSpace();
+      static uint16_t cmd_space; // FIFO space last read, less what was written since
+      static bool wait_for_space(const uint16_t len);
+      #if CLCD_CMD_QUEUE_SIZE
+        #if ENABLED(TOUCH_UI_SPI_ASYNC)
+          static uint8_t queue_buf[2][CLCD_CMD_QUEUE_SIZE]; // One is filled while the other is sent
+          static uint8_t *queue;
+        #else
+          static uint8_t queue[CLCD_CMD_QUEUE_SIZE];
+        #endif
+        static uint16_t queued;
+      #endif
     #else
       static uint32_t command_write_ptr;
       template <class T> bool _write_unaligned(T data, uint16_t len);
@@ -192,6 +213,7 @@ class CLCD::CommandFifo {
     static void reset();
     static bool is_processing();
     static bool has_fault();
+    static bool flush();
 
     void execute();
 
@@ -257,6 +279,7 @@ class CLCD::CommandFifo {
     void memcrc   (uint32_t ptr, uint32_t num, uint32_t result);
     void memwrite (uint32_t ptr, uint32_t value);
     void inflate  (uint32_t ptr);
+    void inflate  (uint32_t ptr, progmem_str data, uint32_t len);
     void getptr   (uint32_t result);
     void append   (uint32_t ptr, uint32_t size);
 };
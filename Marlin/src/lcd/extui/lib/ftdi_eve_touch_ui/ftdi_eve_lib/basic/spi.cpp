@@ -113,8 +113,25 @@ namespace FTDI {
     return true;
   }
 
+  #if ENABLED(TOUCH_UI_SPI_ASYNC)
+    static bool async_pending; // = false
+
+    void SPI::spi_write_block_async(const uint8_t *buf, uint16_t len) {
+      SPI_OBJ.dmaSendAsync(buf, len, true);
+      async_pending = true;
+    }
+
+    void SPI::spi_write_block_finish() {
+      if (!async_pending) return;
+      async_pending = false;
+      SPI_OBJ.dmaSendAsync(nullptr, 0); // Wait for the transfer in progress
+      spi_ftdi_deselect();
+    }
+  #endif
+
   // CLCD SPI - Chip Select
   void SPI::spi_ftdi_select() {
+    TERN_(TOUCH_UI_SPI_ASYNC, spi_write_block_finish());
     #ifndef CLCD_USE_SOFT_SPI
       SPI_OBJ.beginTransaction(spi_settings);
     #endif
@@ -139,6 +156,7 @@ namespace FTDI {
   #ifdef SPI_FLASH_SS
   // Serial SPI Flash SPI - Chip Select
   void SPI::spi_flash_select() {
+    TERN_(TOUCH_UI_SPI_ASYNC, spi_write_block_finish());
     #ifndef CLCD_USE_SOFT_SPI
       SPI_OBJ.beginTransaction(spi_settings);
     #endif
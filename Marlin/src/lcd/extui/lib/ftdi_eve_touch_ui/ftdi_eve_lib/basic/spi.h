@@ -67,6 +67,25 @@ namespace FTDI {
       #endif
     };
 
+    // Send a block in one transfer. On hardware SPI this uses DMA where the
+    // SPI class offers it. The buffer may be overwritten with received bytes.
+    inline void spi_write_block(uint8_t *buf, uint16_t len) {
+      #ifdef CLCD_USE_SOFT_SPI
+        while (len--) _soft_spi_send(*buf++);
+      #elif defined(__STM32F1__) || defined(TARGET_LPC1768)
+        SPI_OBJ.dmaSend(buf, len, true);
+      #else
+        SPI_OBJ.transfer(buf, len);
+      #endif
+    }
+
+    #if ENABLED(TOUCH_UI_SPI_ASYNC)
+      // Start sending a block by DMA and return at once. The chip stays
+      // selected until spi_write_block_finish(), which any select calls.
+      void spi_write_block_async(const uint8_t *buf, uint16_t len);
+      void spi_write_block_finish();
+    #endif
+
     inline void       spi_write_8    (uint8_t val)    {spi_send(val);};
     inline uint8_t    spi_read_8     ()               {return spi_recv();};
 
@@ -113,18 +132,28 @@ namespace FTDI {
 
     // Generic template for function for writing multiple bytes, plus padding bytes.
     // The template parameter op is an inlineable function which is applied to each byte.
+    // With hardware SPI the bytes are staged in chunks and sent with spi_write_block.
 
     template<bulk_write_op byte_op>
-    void spi_write_bulk(const void *data, uint16_t len, uint8_t padding) {
+    void spi_write_bulk(const void *data, uint16_t len) {
       const uint8_t* p = (const uint8_t *)data;
-      while (len--)     spi_send(byte_op(p++));
-      while (padding--) spi_send(0);
+      #ifdef CLCD_USE_SOFT_SPI
+        while (len--) spi_send(byte_op(p++));
+      #else
+        uint8_t chunk[32];
+        while (len) {
+          const uint16_t n = len < sizeof(chunk) ? len : sizeof(chunk);
+          for (uint16_t i = 0; i < n; i++) chunk[i] = byte_op(p++);
+          spi_write_block(chunk, n);
+          len -= n;
+        }
+      #endif
     }
 
     template<bulk_write_op byte_op>
-    void spi_write_bulk(const void *data, uint16_t len) {
-      const uint8_t* p = (const uint8_t *)data;
-      while (len--) spi_send(byte_op(p++));
+    void spi_write_bulk(const void *data, uint16_t len, uint8_t padding) {
+      spi_write_bulk<byte_op>(data, len);
+      while (padding--) spi_send(0);
     }
 
     void spi_read_bulk(      void *data, uint16_t len);
@@ -28,53 +28,50 @@
  * to a menu into RAM_G so that on subsequent calls drawing the menu does
  * not require as much SPI traffic.
  *
- * Layout of Cache memory:
+ * The slot table is kept in MCU RAM: each entry holds
+ * the offset, size and used bytes of a cached DL slot
+ * and the value of the use clock when that slot was
+ * last drawn. RAM_G only holds the display lists, so
+ * SPI traffic is needed only to copy them.
  *
- * The cache memory begins with a table at
- * DL_CACHE_START: each table entry contains
- * an address, size and used bytes for a cached
- * DL slot.
+ *  location        data
  *
- * Immediately following the table is the
- * DL_FREE_ADDR, which points to free cache
- * space; following this is occupied DL space,
- * and after that free space that is yet to
- * be used.
- *
- *  location        data        sizeof
- *
- *  DL_CACHE_START  slot0_addr     4
- *                  slot0_size     4
- *                  slot0_used     4
- *                  slot1_addr     4
- *                  slot1_size     4
- *                  slot1_used     4
- *                      ...
- *                  slotN_addr     4
- *                  slotN_size     4
- *                  slotN_used     4
- *  DL_FREE_ADDR    dl_free_ptr    4
- *                  cached data
+ *  DL_CACHE_START  cached data
  *                      ...
- *  dl_free_ptr     empty space
+ *  free_offset     empty space
  *                      ...
+ *
+ * When there is not enough empty space at free_offset, the
+ * least recently drawn slots are evicted until the holes
+ * add up to enough room, then the cached display lists are
+ * slid down towards DL_CACHE_START to squeeze them out.
  */
 
 #define DL_CACHE_START   MAP::RAM_G_SIZE - 0xFFFF
-#define DL_FREE_ADDR     DL_CACHE_START + DL_CACHE_SLOTS * 12
+#define DL_CACHE_SIZE    0xFFFF
 
 using namespace FTDI;
 
+DLCache::slot_t  DLCache::slots[DL_CACHE_SLOTS];
+uint16_t         DLCache::free_offset;
+uint16_t         DLCache::use_clock;
+DLCache::stats_t DLCache::stats;
+
 // The init function ensures all cache locations are marked as empty
 
 void DLCache::init() {
-  CLCD::mem_write_32(DL_FREE_ADDR, DL_FREE_ADDR + 4);
-  for (uint8_t slot = 0; slot < DL_CACHE_SLOTS; slot++)
-    save_slot(slot, 0, 0, 0);
+  ZERO(slots);
+  free_offset = 0;
+  use_clock = 0;
 }
 
 bool DLCache::has_data() {
-  return dl_slot_size != 0;
+  if (dl_slot_used != 0) {
+    stats.hits++;
+    return true;
+  }
+  stats.misses++;
+  return false;
 }
 
 bool DLCache::wait_until_idle() {
@@ -112,20 +109,21 @@ bool DLCache::store(uint32_t min_bytes /* = 0*/) {
   // Figure out how long the display list is
   const uint32_t dl_size = CLCD::dl_size();
 
+  if (dl_slot_addr != 0 && dl_size > dl_slot_size) {
+    // The display list outgrew its slot, release it so
+    // a bigger block can be allocated below.
+    dl_slot_addr = 0;
+    dl_slot_size = 0;
+    dl_slot_used = 0;
+    save_slot();
+  }
+
   if (dl_slot_addr == 0) {
     // If we are allocating new space...
-    dl_slot_addr = CLCD::mem_read_32(DL_FREE_ADDR);
-    dl_slot_size = max(dl_size, min_bytes);
-
-    const uint32_t free_space = MAP::RAM_G_SIZE - dl_slot_addr;
-    if (dl_slot_size <= free_space) {
-      CLCD::mem_write_32(DL_FREE_ADDR, dl_slot_addr + dl_slot_size);
-    }
-    else {
-      dl_slot_addr = 0;
-      dl_slot_size = 0;
-      dl_slot_used = 0;
-    }
+    const uint32_t size = max(dl_size, min_bytes);
+    dl_slot_addr = allocate(dl_slot_indx, size);
+    dl_slot_size = dl_slot_addr ? size : 0;
+    dl_slot_used = 0;
   }
 
   if (dl_size > dl_slot_size) {
@@ -147,6 +145,7 @@ bool DLCache::store(uint32_t min_bytes /* = 0*/) {
     #endif
     dl_slot_used = dl_size;
     save_slot();
+    touch_slot();
     cmd.memcpy(dl_slot_addr, MAP::RAM_DL, dl_slot_used);
     cmd.execute();
     return true;
@@ -154,20 +153,129 @@ bool DLCache::store(uint32_t min_bytes /* = 0*/) {
 }
 
 void DLCache::save_slot(uint8_t indx, uint32_t addr, uint16_t size, uint16_t used) {
-  CLCD::mem_write_32(DL_CACHE_START + indx * 12 + 0, addr);
-  CLCD::mem_write_32(DL_CACHE_START + indx * 12 + 4, size);
-  CLCD::mem_write_32(DL_CACHE_START + indx * 12 + 8, used);
+  slot_t &slot = slots[indx];
+  slot.offset = addr ? addr - (DL_CACHE_START) : 0;
+  slot.size   = addr ? size : 0;
+  slot.used   = used;
 }
 
 void DLCache::load_slot(uint8_t indx, uint32_t &addr, uint16_t &size, uint16_t &used) {
-  addr  = CLCD::mem_read_32(DL_CACHE_START + indx * 12 + 0);
-  size  = CLCD::mem_read_32(DL_CACHE_START + indx * 12 + 4);
-  used  = CLCD::mem_read_32(DL_CACHE_START + indx * 12 + 8);
+  const slot_t &slot = slots[indx];
+  addr  = slot.size ? DL_CACHE_START + slot.offset : 0;
+  size  = slot.size;
+  used  = slot.used;
+}
+
+// Record that this slot has just been drawn, for LRU eviction.
+// When the clock runs out all stamps are halved, which keeps their order.
+
+void DLCache::touch_slot() {
+  if (!++use_clock) {
+    for (uint8_t i = 0; i < DL_CACHE_SLOTS; i++) slots[i].stamp >>= 1;
+    use_clock = 0x8000;
+  }
+  slots[dl_slot_indx].stamp = use_clock;
+}
+
+// Returns the number of bytes that are not held by any slot,
+// whether at the end of the cache or in holes between slots.
+
+uint32_t DLCache::free_bytes() {
+  uint32_t used = 0;
+  for (uint8_t i = 0; i < DL_CACHE_SLOTS; i++) used += slots[i].size;
+  return DL_CACHE_SIZE - used;
+}
+
+/* Finds room for size bytes on behalf of slot indx and
+ * returns its address, or zero if the request cannot be
+ * satisfied even after evicting every other slot.
+ */
+
+uint32_t DLCache::allocate(uint8_t indx, uint32_t size) {
+  // Too big for the whole cache, so evicting would not help
+  if (size > DL_CACHE_SIZE) return 0;
+
+  if (size > uint32_t(DL_CACHE_SIZE - free_offset)) {
+    // Evict the least recently drawn slots until the holes
+    // add up to enough space, then squeeze them out.
+    uint32_t avail = free_bytes();
+    while (size > avail) {
+      const uint16_t freed = evict_lru(indx);
+      if (!freed) return 0;
+      avail += freed;
+    }
+    compact();
+  }
+  const uint32_t addr = DL_CACHE_START + free_offset;
+  free_offset += size;
+  return addr;
+}
+
+// Evicts the least recently drawn slot other than keep and
+// returns the number of bytes freed, or zero if none is left.
+
+uint16_t DLCache::evict_lru(uint8_t keep) {
+  uint8_t  victim = DL_CACHE_SLOTS;
+  uint16_t oldest = UINT16_MAX;
+  for (uint8_t i = 0; i < DL_CACHE_SLOTS; i++) {
+    if (i == keep || !slots[i].size) continue;
+    if (slots[i].stamp <= oldest) {
+      oldest = slots[i].stamp;
+      victim = i;
+    }
+  }
+  if (victim == DL_CACHE_SLOTS) return 0;
+  #if ENABLED(TOUCH_UI_DEBUG)
+    SERIAL_ECHOLNPAIR("Evicting DL from RAMG cache, slot: ", victim);
+  #endif
+  const uint16_t freed = slots[victim].size;
+  save_slot(victim, 0, 0, 0);
+  stats.evictions++;
+  return freed;
+}
+
+/* Slides all cached display lists down, in address order, so
+ * that the free space is contiguous at the end of the cache.
+ * Since a block only ever moves to a lower address, copying
+ * it in pieces no longer than the distance moved ensures the
+ * source and destination of each CMD_MEMCPY never overlap.
+ */
+
+void DLCache::compact() {
+  CLCD::CommandFifo cmd;
+  uint16_t dst = 0;
+  for (;;) {
+    // Find the lowest addressed slot not yet moved
+    uint8_t  next        = DL_CACHE_SLOTS;
+    uint16_t next_offset = UINT16_MAX;
+    for (uint8_t i = 0; i < DL_CACHE_SLOTS; i++) {
+      const slot_t &slot = slots[i];
+      if (slot.size && slot.offset >= dst && slot.offset < next_offset) {
+        next_offset = slot.offset;
+        next        = i;
+      }
+    }
+    if (next == DL_CACHE_SLOTS) break;
+
+    slot_t &slot = slots[next];
+    if (slot.offset != dst) {
+      const uint32_t gap = slot.offset - dst;
+      for (uint32_t offset = 0; offset < slot.used; offset += gap)
+        cmd.memcpy(DL_CACHE_START + dst + offset, DL_CACHE_START + slot.offset + offset, min(gap, uint32_t(slot.used - offset)));
+      slot.offset = dst;
+    }
+    dst += slot.size;
+  }
+  cmd.execute();
+  wait_until_idle();
+  free_offset = dst;
+  stats.compactions++;
 }
 
 void DLCache::append() {
   CLCD::CommandFifo cmd;
   cmd.append(dl_slot_addr, dl_slot_used);
+  touch_slot();
   #if ENABLED(TOUCH_UI_DEBUG)
     cmd.execute();
     wait_until_idle();
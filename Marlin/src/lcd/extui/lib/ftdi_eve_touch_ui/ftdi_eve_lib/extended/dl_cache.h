@@ -35,27 +35,66 @@
  *     dlcache.append();
  *   else
  *     dlcache.store(); // Add stuff to the DL
+ *
+ * When the cache fills up, the least recently used display lists are
+ * evicted and the remaining ones compacted, so a screen whose display
+ * list was evicted will simply regenerate it the next time it is drawn.
  */
+
+// Slot IDs must be below this. Each slot takes 8 bytes of MCU RAM.
+#ifndef DL_CACHE_SLOTS
+  #ifdef __AVR__
+    #define DL_CACHE_SLOTS  64
+  #else
+    #define DL_CACHE_SLOTS 250
+  #endif
+#endif
+
 class DLCache {
+  public:
+    typedef struct {
+      uint32_t hits, misses, evictions, compactions;
+    } stats_t;
+
   private:
     typedef FTDI::ftdi_registers  REG;
     typedef FTDI::ftdi_memory_map MAP;
 
+    // An entry of the slot table, which is kept in MCU RAM
+    typedef struct {
+      uint16_t offset; // From the start of the cache
+      uint16_t size;   // Zero if the slot is empty
+      uint16_t used;
+      uint16_t stamp;  // Use clock when last drawn
+    } slot_t;
+
     uint8_t  dl_slot_indx;
     uint32_t dl_slot_addr;
     uint16_t dl_slot_size;
     uint16_t dl_slot_used;
 
+    static slot_t   slots[DL_CACHE_SLOTS];
+    static uint16_t free_offset;
+    static uint16_t use_clock;
+    static stats_t  stats;
+
     void load_slot() {load_slot(dl_slot_indx, dl_slot_addr, dl_slot_size, dl_slot_used);}
     void save_slot() {save_slot(dl_slot_indx, dl_slot_addr, dl_slot_size, dl_slot_used);}
+    void touch_slot();
 
     static void load_slot(uint8_t indx, uint32_t &addr, uint16_t &size, uint16_t &used);
     static void save_slot(uint8_t indx, uint32_t  addr, uint16_t  size, uint16_t  used);
 
-    bool wait_until_idle();
+    static uint32_t allocate(uint8_t indx, uint32_t size);
+    static uint32_t free_bytes();
+    static uint16_t evict_lru(uint8_t keep);
+    static void compact();
+
+    static bool wait_until_idle();
 
   public:
     static void init();
+    static const stats_t &get_stats() {return stats;}
 
     DLCache(uint8_t slot) {
       dl_slot_indx = slot;
@@ -66,5 +105,3 @@ class DLCache {
     bool store(uint32_t min_bytes = 0);
     void append();
 };
-
-#define DL_CACHE_SLOTS   250
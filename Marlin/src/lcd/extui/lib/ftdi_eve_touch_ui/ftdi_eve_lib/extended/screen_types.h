@@ -174,6 +174,8 @@ class UncachedScreen {
 
 template<uint8_t DL_SLOT,uint32_t DL_SIZE = 0>
 class CachedScreen {
+  static_assert(DL_SLOT < DL_CACHE_SLOTS, "DL_SLOT must be below DL_CACHE_SLOTS.");
+
   protected:
     static void gfxError() {
       using namespace FTDI;
@@ -67,8 +67,8 @@
     }
     CLCD::mem_write_bulk(addr, &cyrillic_fm,  148);
 
-    // Decode the RLE data and load it into RAMG as a bitmap
-    uint32_t lastaddr = write_rle_data(addr + 148, cyrillic_font, sizeof(cyrillic_font));
+    // Inflate the compressed data into RAMG as a bitmap
+    uint32_t lastaddr = write_deflate_data(addr + 148, cyrillic_font, sizeof(cyrillic_font), cyrillic_font_size);
 
     bitmap_addr = addr;
 
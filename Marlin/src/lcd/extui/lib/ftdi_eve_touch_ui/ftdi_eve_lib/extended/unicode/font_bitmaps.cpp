@@ -25,14 +25,19 @@
 
 namespace FTDI {
 
-  uint32_t write_rle_data(uint32_t addr, const uint8_t *data, size_t n) {
-    for (; n >= 2; n -= 2) {
-      uint8_t count = pgm_read_byte(data++);
-      uint8_t value = pgm_read_byte(data++);
-      CLCD::mem_write_fill(addr, value, count);
-      addr += count;
+  uint32_t write_deflate_data(uint32_t addr, const uint8_t *data, size_t n, uint32_t size) {
+    CLCD::CommandFifo cmd;
+    cmd.inflate(addr, (progmem_str)data, n);
+    cmd.execute();
+    // The bitmap handles must not use the data until it is all inflated
+    while (cmd.is_processing()) {
+      if (cmd.has_fault()) {
+        SERIAL_ECHO_MSG("Coprocessor fault while inflating font data");
+        cmd.reset();
+        break;
+      }
     }
-    return addr;
+    return addr + size;
   }
 
   void set_font_bitmap(CommandProcessor& cmd, CLCD::FontMetrics &fm, uint8_t handle) {
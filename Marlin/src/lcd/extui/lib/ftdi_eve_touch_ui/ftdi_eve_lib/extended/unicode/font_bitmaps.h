@@ -24,7 +24,7 @@
 class CommandProcessor;
 
 namespace FTDI {
-  uint32_t write_rle_data(uint32_t addr, const uint8_t *data, size_t n);
+  uint32_t write_deflate_data(uint32_t addr, const uint8_t *data, size_t n, uint32_t size);
   void set_font_bitmap(CommandProcessor& cmd, CLCD::FontMetrics &fm, uint8_t handle);
   void ext_vertex2ii(CommandProcessor &cmd, int x, int y, uint8_t handle, uint8_t cell);
 }
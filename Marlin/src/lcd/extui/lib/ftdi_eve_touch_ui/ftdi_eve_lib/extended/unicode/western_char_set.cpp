@@ -339,7 +339,7 @@
     CLCD::FontMetrics alt_fm;
     alt_fm.ptr    = addr + 148;
     alt_fm.format = L4;
-    alt_fm.stride = 19;
+    alt_fm.stride = 20;
     alt_fm.width  = 38;
     alt_fm.height = 49;
     LOOP_L_N(i, 127)
@@ -354,8 +354,46 @@
     }
     CLCD::mem_write_bulk(addr, &alt_fm,  148);
 
-    // Decode the RLE data and load it into RAMG as a bitmap
-    uint32_t lastaddr = write_rle_data(addr + 148, font, sizeof(font));
+    // Inflate the compressed data into RAMG as a bitmap, one group
+    // of glyphs at a time so the cells match the enabled glyphs.
+    // The cells are a multiple of 4 bytes, so each group starts aligned.
+    uint32_t lastaddr = addr + 148;
+    #define LOAD_GLYPHS(A) do{ \
+      static_assert(A##_size % 4 == 0, #A " must inflate to a multiple of 4 bytes."); \
+      lastaddr = write_deflate_data(lastaddr, A, sizeof(A), A##_size); \
+    }while(0)
+    LOAD_GLYPHS(font);
+    #if ENABLED(TOUCH_UI_UTF8_GERMANIC)
+      LOAD_GLYPHS(font_germanic);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_SCANDINAVIAN)
+      LOAD_GLYPHS(font_scandinavian);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_PUNCTUATION)
+      LOAD_GLYPHS(font_punctuation);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_CURRENCY)
+      LOAD_GLYPHS(font_currency);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_SUPERSCRIPTS)
+      LOAD_GLYPHS(font_superscripts);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_ORDINALS)
+      LOAD_GLYPHS(font_ordinals);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_COPYRIGHT)
+      LOAD_GLYPHS(font_copyright);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_MATHEMATICS)
+      LOAD_GLYPHS(font_mathematics);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_FRACTIONS)
+      LOAD_GLYPHS(font_fractions);
+    #endif
+    #if ENABLED(TOUCH_UI_UTF8_SYMBOLS)
+      LOAD_GLYPHS(font_symbols);
+    #endif
+    #undef LOAD_GLYPHS
 
     bitmap_addr = addr;
 
@@ -375,7 +413,7 @@
     CLCD::FontMetrics alt_fm;
     alt_fm.ptr    = bitmap_addr + 148;
     alt_fm.format = L4;
-    alt_fm.stride = 19;
+    alt_fm.stride = 20;
     alt_fm.width  = 38;
     alt_fm.height = 49;
     set_font_bitmap(cmd, alt_fm, alt_font);
@@ -23,1293 +23,569 @@
 
 /* This is a dump of "font_bitmaps/western_european_bitmap_31.png"
  * using the tool "bitmap2cpp.py". The tool converts the image into
- * 16-level grayscale and packs two pixels per byte. The resulting
- * bytes are then RLE compressed to yield (count, byte) pairs.
+ * 16-level grayscale and packs two pixels per byte. Each row is
+ * padded to 20 bytes, so every glyph cell is 4-byte aligned. The
+ * resulting bytes are then zlib compressed so CMD_INFLATE can expand them.
+ * Each optional group of glyphs is a separate stream, so only the
+ * enabled groups are loaded, in the order of the glyph enum.
  */
 
-const unsigned char font[] PROGMEM = {
-
-  /* 0 GRAVE */
-  0x76, 0x00, 0x01, 0x08, 0x01, 0xEE, 0x01, 0xE5, 0x11, 0x00, 0x01, 0xAF,
-  0x01, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xD0,
-  0x10, 0x00, 0x01, 0x01, 0x01, 0xDF, 0x01, 0xF9, 0x11, 0x00, 0x01, 0x2E,
-  0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF2,
-  0x11, 0x00, 0x01, 0x5F, 0x01, 0xFD, 0x11, 0x00, 0x01, 0x06, 0x01, 0x99,
-  0x01, 0x40, 0xFF, 0x00, 0xFF, 0x00, 0xA4, 0x00,
-
-  /* 1 ACUTE */
-  0x7B, 0x00, 0x01, 0x9E, 0x01, 0xEE, 0x01, 0x50, 0x0F, 0x00, 0x01, 0x05,
-  0x01, 0xFF, 0x01, 0xF8, 0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0xCF, 0x01, 0xFC, 0x10, 0x00, 0x01, 0x09, 0x01, 0xFF,
-  0x01, 0xD1, 0x10, 0x00, 0x01, 0x4F, 0x01, 0xFE, 0x01, 0x20, 0x0F, 0x00,
-  0x01, 0x01, 0x01, 0xEF, 0x01, 0xF3, 0x10, 0x00, 0x01, 0x07, 0x01, 0xAA,
-  0x01, 0x40, 0xFF, 0x00, 0xFF, 0x00, 0xA5, 0x00,
-
-  /* 2 CIRCUMFLEX */
-  0x79, 0x00, 0x01, 0xCF, 0x01, 0xFC, 0x10, 0x00, 0x01, 0x07, 0x02, 0xFF,
-  0x01, 0x60, 0x0F, 0x00, 0x01, 0x2F, 0x02, 0xFF, 0x01, 0xF2, 0x0F, 0x00,
-  0x01, 0xCF, 0x01, 0xF6, 0x01, 0x6F, 0x01, 0xFB, 0x0E, 0x00, 0x01, 0x06,
-  0x01, 0xFF, 0x01, 0xA0, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0x60, 0x0D, 0x00,
-  0x01, 0x1F, 0x01, 0xFD, 0x01, 0x00, 0x01, 0x01, 0x01, 0xDF, 0x01, 0xF1,
-  0x0D, 0x00, 0x01, 0xBF, 0x01, 0xF3, 0x02, 0x00, 0x01, 0x3F, 0x01, 0xFB,
-  0x0C, 0x00, 0x01, 0x02, 0x01, 0x99, 0x01, 0x50, 0x02, 0x00, 0x01, 0x05,
-  0x01, 0x99, 0x01, 0x20, 0xFF, 0x00, 0xFF, 0x00, 0xA2, 0x00,
-
-  /* 3 TILDE */
-  0x7C, 0x00, 0x01, 0x11, 0x0D, 0x00, 0x01, 0x09, 0x01, 0xFF, 0x01, 0xC3,
-  0x02, 0x00, 0x01, 0xFF, 0x01, 0x80, 0x0C, 0x00, 0x01, 0xAF, 0x02, 0xFF,
-  0x01, 0x50, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x60, 0x0B, 0x00, 0x01, 0x02,
-  0x01, 0xFF, 0x01, 0xD9, 0x01, 0xFF, 0x01, 0xF7, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0x40, 0x0B, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0x20, 0x01, 0x3E,
-  0x02, 0xFF, 0x01, 0xFD, 0x0C, 0x00, 0x01, 0x09, 0x01, 0xFE, 0x01, 0x00,
-  0x01, 0x02, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xF4, 0x0C, 0x00, 0x01, 0x07,
-  0x01, 0xA8, 0x02, 0x00, 0x01, 0x06, 0x01, 0x98, 0x01, 0x20, 0xFF, 0x00,
-  0xFF, 0x00, 0xB6, 0x00,
-
-  /* 4 DIAERESIS */
-  0x8A, 0x00, 0x02, 0x44, 0x02, 0x00, 0x02, 0x44, 0x0D, 0x00, 0x02, 0xFF,
-  0x01, 0x10, 0x01, 0x01, 0x02, 0xFF, 0x0D, 0x00, 0x02, 0xFF, 0x01, 0x10,
-  0x01, 0x01, 0x02, 0xFF, 0x0D, 0x00, 0x02, 0xFF, 0x01, 0x10, 0x01, 0x01,
-  0x02, 0xFF, 0x0D, 0x00, 0x02, 0xCC, 0x01, 0x10, 0x01, 0x01, 0x02, 0xCC,
-  0xFF, 0x00, 0xFF, 0x00, 0xC9, 0x00,
+constexpr uint32_t font_size = 7840; // Inflated size
 
-  /* 5 DOT_ABOVE / DEGREE_SIGN */
-  0x2D, 0x00, 0x01, 0x13, 0x01, 0x30, 0x10, 0x00, 0x01, 0x2B, 0x02, 0xFF,
-  0x01, 0xA1, 0x0E, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x02, 0xFF, 0x01, 0xFD,
-  0x01, 0x10, 0x0D, 0x00, 0x01, 0x0D, 0x01, 0xFF, 0x01, 0x94, 0x01, 0x5A,
-  0x01, 0xFF, 0x01, 0xB0, 0x0D, 0x00, 0x01, 0x4F, 0x01, 0xF7, 0x02, 0x00,
-  0x01, 0x9F, 0x01, 0xF2, 0x0D, 0x00, 0x01, 0x8F, 0x01, 0xF0, 0x02, 0x00,
-  0x01, 0x2F, 0x01, 0xF6, 0x0D, 0x00, 0x01, 0x8F, 0x01, 0xE0, 0x02, 0x00,
-  0x01, 0x0F, 0x01, 0xF7, 0x0D, 0x00, 0x01, 0x7F, 0x01, 0xF2, 0x02, 0x00,
-  0x01, 0x4F, 0x01, 0xF5, 0x0D, 0x00, 0x01, 0x2F, 0x01, 0xFC, 0x01, 0x10,
-  0x01, 0x02, 0x01, 0xDF, 0x01, 0xF0, 0x0D, 0x00, 0x01, 0x08, 0x01, 0xFF,
-  0x01, 0xFB, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x60, 0x0E, 0x00, 0x01, 0x9F,
-  0x02, 0xFF, 0x01, 0xF8, 0x0F, 0x00, 0x01, 0x03, 0x01, 0x9C, 0x01, 0xC9,
-  0x01, 0x30, 0xFF, 0x00, 0xFF, 0x00, 0xA4, 0x00,
-
-  /* 6 CEDILLA */
-  0xFF, 0x00, 0xFF, 0x00, 0xEE, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0x20,
-  0x11, 0x00, 0x01, 0xCF, 0x01, 0xC0, 0x11, 0x00, 0x01, 0x3F, 0x01, 0xF6,
-  0x11, 0x00, 0x01, 0x0F, 0x01, 0xFB, 0x11, 0x00, 0x01, 0x3F, 0x01, 0xFD,
-  0x0E, 0x00, 0x01, 0x07, 0x01, 0xD9, 0x01, 0x89, 0x01, 0xFF, 0x01, 0xFB,
-  0x0E, 0x00, 0x01, 0x07, 0x03, 0xFF, 0x01, 0xF3, 0x0E, 0x00, 0x01, 0x04,
-  0x01, 0xBD, 0x01, 0xEE, 0x01, 0xD9, 0x01, 0x20, 0x2F, 0x00,
-
-  /* 7 NO_DOT_I */
-  0xFF, 0x00, 0x32, 0x00, 0x01, 0x01, 0x01, 0x99, 0x01, 0x96, 0x10, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF,
-  0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF,
-  0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF,
-  0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF,
-  0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF,
-  0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF,
-  0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF,
-  0x01, 0xF9, 0x10, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0x10, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF9, 0xCD, 0x00,
+const unsigned char font[] PROGMEM = {
+  0x78, 0xda, 0xed, 0x99, 0xbd, 0x4a, 0xc3, 0x50, 0x14, 0xc7, 0xef, 0x4d,
+  0x6d, 0xd3, 0x8a, 0xd2, 0x88, 0x0f, 0x60, 0x76, 0x41, 0xfb, 0x04, 0xb6,
+  0x43, 0xf7, 0x76, 0x76, 0xd1, 0x37, 0xf0, 0x11, 0x74, 0x75, 0x72, 0x11,
+  0x31, 0x20, 0xb6, 0x6e, 0xe2, 0xa2, 0x2f, 0x20, 0x0a, 0x4e, 0x42, 0x20,
+  0x3a, 0x66, 0x8a, 0x8b, 0x6b, 0x5a, 0xbf, 0x12, 0x4b, 0x3f, 0xfe, 0x5e,
+  0x70, 0xf1, 0xde, 0x93, 0xc9, 0x40, 0xc5, 0x72, 0x7e, 0x90, 0xe5, 0xc7,
+  0x39, 0x4b, 0x2e, 0xe7, 0xe3, 0x26, 0x42, 0xfc, 0x1d, 0xe5, 0xf8, 0x99,
+  0xca, 0x4b, 0xb8, 0xc4, 0x2d, 0xe0, 0x81, 0x38, 0x19, 0x0d, 0x68, 0xf2,
+  0x1a, 0xda, 0xc4, 0x15, 0xf0, 0x4a, 0x03, 0xb7, 0xc6, 0xd4, 0x95, 0xbc,
+  0x86, 0x60, 0x18, 0x26, 0x2f, 0xa7, 0x31, 0x29, 0xc3, 0x22, 0x3e, 0x49,
+  0xd8, 0x3a, 0xba, 0xc4, 0x05, 0x23, 0xa2, 0x2a, 0x78, 0x24, 0xae, 0x35,
+  0x21, 0x5d, 0x42, 0xf6, 0xde, 0x48, 0x98, 0x7d, 0xc1, 0x25, 0xcd, 0x30,
+  0xb9, 0xc9, 0x28, 0x4b, 0x1b, 0xd8, 0xa6, 0x15, 0x4d, 0x87, 0x6d, 0x90,
+  0xec, 0x0c, 0xcd, 0x49, 0x8b, 0xee, 0xbc, 0x99, 0xbc, 0x32, 0x56, 0x23,
+  0xfd, 0x45, 0x77, 0x37, 0xaa, 0xa2, 0xeb, 0x7a, 0xb2, 0xe5, 0xa9, 0xd6,
+  0x52, 0xf4, 0x5c, 0x3e, 0x12, 0x86, 0xc9, 0xcb, 0x92, 0x39, 0x69, 0xef,
+  0x84, 0xc0, 0x9e, 0xb1, 0x8f, 0xa3, 0x2d, 0xf5, 0x62, 0xb5, 0x10, 0x22,
+  0xb5, 0xd1, 0xd0, 0xbb, 0x81, 0xbb, 0x01, 0xe8, 0x5b, 0x75, 0x65, 0x22,
+  0xac, 0x08, 0xef, 0x7a, 0xd7, 0x38, 0x57, 0xe5, 0x7f, 0xcc, 0xe5, 0xcb,
+  0x30, 0x53, 0xa1, 0xd9, 0xfc, 0x7e, 0x7e, 0x02, 0x38, 0x12, 0xf8, 0x9d,
+  0xf3, 0x7d, 0x47, 0xfa, 0x3e, 0xbf, 0x57, 0x86, 0xc9, 0x66, 0xb9, 0x46,
+  0xd4, 0x2a, 0x70, 0x66, 0x28, 0xab, 0xa7, 0xc6, 0xa5, 0xa3, 0xbb, 0x45,
+  0x1c, 0x6e, 0xe2, 0xca, 0xb8, 0xe9, 0xa6, 0x42, 0x74, 0x8c, 0xa5, 0xfa,
+  0xa0, 0xaf, 0x56, 0xed, 0xc4, 0x70, 0x4f, 0x42, 0x54, 0x53, 0xdd, 0xed,
+  0xaa, 0xbc, 0xd6, 0x87, 0xb1, 0xa2, 0x8f, 0x1c, 0x2b, 0xea, 0xeb, 0xae,
+  0x8c, 0x61, 0x40, 0x96, 0xf9, 0x0e, 0xe8, 0x95, 0xbd, 0x70, 0x72, 0x5f,
+  0xe3, 0x03, 0x66, 0x18, 0x86, 0x99, 0x31, 0x4a, 0x19, 0x7f, 0x5e, 0x44,
+  0x70, 0x4b, 0x5d, 0x3d, 0xa1, 0xae, 0x3a, 0xcc, 0x88, 0x33, 0x7f, 0xb2,
+  0xd8, 0xe1, 0x3e, 0xcc, 0x38, 0x1b, 0x80, 0xf9, 0xe1, 0x76, 0xee, 0x3a,
+  0x0e, 0xf9, 0x8a, 0x38, 0x7d, 0xa4, 0x77, 0x44, 0x1d, 0x06, 0xec, 0xfe,
+  0xa1, 0x9b, 0x11, 0xbe, 0x00, 0x17, 0x74, 0xb5, 0x17
+};
 
 #if ENABLED(TOUCH_UI_UTF8_GERMANIC)
-  /* 8 SHARP_S */
-  0x8A, 0x00, 0x01, 0x35, 0x01, 0x66, 0x01, 0x52, 0x0E, 0x00, 0x01, 0x03,
-  0x01, 0xAF, 0x03, 0xFF, 0x01, 0xE7, 0x0D, 0x00, 0x01, 0x7F, 0x05, 0xFF,
-  0x01, 0xC1, 0x0B, 0x00, 0x01, 0x07, 0x02, 0xFF, 0x01, 0xFC, 0x01, 0xAA,
-  0x01, 0xDF, 0x01, 0xFF, 0x01, 0xFC, 0x0B, 0x00, 0x01, 0x2F, 0x01, 0xFF,
-  0x01, 0xF9, 0x01, 0x10, 0x01, 0x00, 0x01, 0x02, 0x01, 0xCF, 0x01, 0xFF,
-  0x01, 0x70, 0x0A, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0x80, 0x03, 0x00,
-  0x01, 0x0D, 0x01, 0xFF, 0x01, 0xE0, 0x0A, 0x00, 0x01, 0xEF, 0x01, 0xFF,
-  0x04, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xF3, 0x09, 0x00, 0x01, 0x02,
-  0x01, 0xFF, 0x01, 0xFB, 0x04, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF7,
-  0x09, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF9, 0x03, 0x00, 0x01, 0x03,
-  0x01, 0x9E, 0x01, 0xFF, 0x01, 0xF8, 0x09, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF8, 0x02, 0x00, 0x01, 0x01, 0x01, 0xAF, 0x02, 0xFF, 0x01, 0xD7,
-  0x09, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x02, 0x00, 0x01, 0x1D,
-  0x01, 0xFF, 0x01, 0xFC, 0x01, 0x50, 0x0A, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF8, 0x02, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0x70, 0x0B, 0x00,
-  0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x01, 0x00, 0x01, 0x01, 0x01, 0xFF,
-  0x01, 0xFA, 0x0C, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x01, 0x00,
-  0x01, 0x05, 0x01, 0xFF, 0x01, 0xF4, 0x0C, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF8, 0x01, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF4, 0x0C, 0x00,
-  0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x01, 0x00, 0x01, 0x05, 0x01, 0xFF,
-  0x01, 0xF9, 0x0C, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x01, 0x00,
-  0x01, 0x02, 0x02, 0xFF, 0x01, 0x50, 0x0B, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF8, 0x02, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0xF8, 0x0B, 0x00,
-  0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x02, 0x00, 0x01, 0x1D, 0x02, 0xFF,
-  0x01, 0xD3, 0x0A, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x02, 0x00,
-  0x01, 0x01, 0x01, 0xCF, 0x02, 0xFF, 0x01, 0x70, 0x09, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF8, 0x03, 0x00, 0x01, 0x07, 0x02, 0xFF, 0x01, 0xFB,
-  0x09, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x04, 0x00, 0x01, 0x2B,
-  0x02, 0xFF, 0x01, 0xB0, 0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8,
-  0x05, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0xF6, 0x08, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF8, 0x05, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xFD,
-  0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x06, 0x00, 0x01, 0xDF,
-  0x01, 0xFF, 0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x06, 0x00,
-  0x01, 0xBF, 0x01, 0xFF, 0x01, 0x10, 0x07, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF8, 0x06, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x08, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF8, 0x05, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xFD,
-  0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x01, 0x02, 0x01, 0x84,
-  0x03, 0x00, 0x01, 0x2D, 0x01, 0xFF, 0x01, 0xF8, 0x08, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF8, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xEC, 0x01, 0xA9,
-  0x01, 0xAC, 0x02, 0xFF, 0x01, 0xE0, 0x08, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF8, 0x01, 0x02, 0x05, 0xFF, 0x01, 0xFE, 0x01, 0x20, 0x08, 0x00,
-  0x01, 0x03, 0x01, 0xEE, 0x01, 0xE7, 0x01, 0x01, 0x01, 0xBF, 0x03, 0xFF,
-  0x01, 0xFE, 0x01, 0x80, 0x0E, 0x00, 0x01, 0x35, 0x01, 0x78, 0x01, 0x76,
-  0x01, 0x30, 0xB4, 0x00,
-#endif
+constexpr uint32_t font_germanic_size = 980; // Inflated size
+
+const unsigned char font_germanic[] PROGMEM = {
+  0x78, 0xda, 0xd5, 0xd2, 0x3f, 0x0e, 0x01, 0x41, 0x14, 0x06, 0xf0, 0x37,
+  0x2b, 0xbb, 0x2a, 0x89, 0x0b, 0x48, 0xf4, 0x22, 0x34, 0xee, 0x21, 0x0e,
+  0xa1, 0xa5, 0x12, 0x9d, 0x2d, 0x9c, 0x43, 0x4f, 0x24, 0xeb, 0x06, 0x1b,
+  0x27, 0xd8, 0x42, 0xa1, 0xa4, 0xdb, 0x46, 0x28, 0x08, 0xd6, 0x2e, 0x9f,
+  0x9d, 0x2d, 0xec, 0xdb, 0x37, 0x0e, 0xc0, 0x2b, 0xde, 0x64, 0x7e, 0x99,
+  0x4c, 0xbe, 0xf9, 0x43, 0xf4, 0x63, 0xd5, 0xe9, 0xf7, 0x84, 0x94, 0x3c,
+  0x00, 0x61, 0xd1, 0x26, 0xd0, 0xb5, 0xe6, 0x54, 0x06, 0x92, 0xc5, 0x0e,
+  0x09, 0xb7, 0x16, 0xa2, 0x2a, 0x59, 0x01, 0x86, 0xcc, 0x3c, 0xb8, 0x69,
+  0xaf, 0x60, 0xcf, 0xec, 0x04, 0xdd, 0x6d, 0x9c, 0x73, 0xb2, 0x10, 0xeb,
+  0x41, 0xe1, 0xc6, 0x92, 0x20, 0xd2, 0x7d, 0x86, 0x3b, 0xb7, 0x74, 0xa2,
+  0xd2, 0x88, 0x5b, 0x61, 0x35, 0x24, 0x5d, 0x12, 0xe6, 0x15, 0x92, 0x64,
+  0xa6, 0xf0, 0x20, 0x69, 0x36, 0x2e, 0x86, 0x39, 0x5f, 0xcc, 0xce, 0xf2,
+  0x14, 0xcd, 0x02, 0xba, 0xd2, 0xc8, 0xe7, 0x89, 0x3f, 0xf9, 0xb0, 0x91,
+  0xa6, 0x02, 0xf0, 0x84, 0x99, 0xe9, 0x8b, 0x8d, 0xa5, 0x51, 0x03, 0x58,
+  0x49, 0xa3, 0x01, 0xae, 0x86, 0x39, 0x78, 0x1a, 0x46, 0x3b, 0x98, 0xe6,
+  0xa3, 0x6a, 0x58, 0x60, 0xae, 0x53, 0xc5, 0xfd, 0xac, 0x69, 0x3a, 0x36,
+  0xd9, 0xf1, 0xb4, 0xe1, 0x30, 0x5f, 0x82, 0x3d, 0x70, 0x66, 0xba, 0x5e,
+  0xf5, 0xdc, 0x8e, 0xa1, 0xf2, 0x35, 0xb9, 0xf2, 0x03, 0x8e, 0x47, 0x6d,
+  0xfa, 0xeb, 0x7a, 0x03, 0x58, 0x3f, 0x96, 0xe2
+};
+#endif // TOUCH_UI_UTF8_GERMANIC
 
 #if ENABLED(TOUCH_UI_UTF8_SCANDINAVIAN)
-  /* 9 LRG_O_STROKE */
-  0x93, 0x00, 0x01, 0x40, 0x0A, 0x00, 0x01, 0x47, 0x01, 0x9A, 0x01, 0xBA,
-  0x01, 0x95, 0x01, 0x10, 0x02, 0x00, 0x01, 0x07, 0x01, 0xF8, 0x08, 0x00,
-  0x01, 0x02, 0x01, 0xAF, 0x04, 0xFF, 0x01, 0xFC, 0x01, 0x50, 0x01, 0x00,
-  0x01, 0x5F, 0x01, 0xFF, 0x01, 0x30, 0x07, 0x00, 0x01, 0x8F, 0x06, 0xFF,
-  0x01, 0xFC, 0x01, 0x23, 0x01, 0xFF, 0x01, 0xF6, 0x07, 0x00, 0x01, 0x1C,
-  0x03, 0xFF, 0x01, 0xCA, 0x01, 0x9B, 0x01, 0xDF, 0x02, 0xFF, 0x01, 0xFE,
-  0x01, 0xFF, 0x01, 0x80, 0x07, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0xFD,
-  0x01, 0x50, 0x02, 0x00, 0x01, 0x02, 0x01, 0x9F, 0x02, 0xFF, 0x01, 0xFA,
-  0x07, 0x00, 0x01, 0x09, 0x02, 0xFF, 0x01, 0x90, 0x04, 0x00, 0x01, 0x03,
-  0x01, 0xEF, 0x01, 0xFF, 0x01, 0xF3, 0x07, 0x00, 0x01, 0x5F, 0x01, 0xFF,
-  0x01, 0xF9, 0x06, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0xFC, 0x07, 0x00,
-  0x01, 0xDF, 0x01, 0xFF, 0x01, 0xC0, 0x05, 0x00, 0x01, 0x06, 0x03, 0xFF,
-  0x01, 0x60, 0x05, 0x00, 0x01, 0x04, 0x02, 0xFF, 0x01, 0x30, 0x05, 0x00,
-  0x01, 0x4F, 0x01, 0xFF, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xC0, 0x05, 0x00,
-  0x01, 0x0B, 0x01, 0xFF, 0x01, 0xFC, 0x05, 0x00, 0x01, 0x02, 0x01, 0xEF,
-  0x01, 0xF7, 0x01, 0x3F, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00, 0x01, 0x0F,
-  0x01, 0xFF, 0x01, 0xF6, 0x05, 0x00, 0x01, 0x1D, 0x01, 0xFF, 0x01, 0xA0,
-  0x01, 0x0D, 0x01, 0xFF, 0x01, 0xF8, 0x05, 0x00, 0x01, 0x3F, 0x01, 0xFF,
-  0x01, 0xF2, 0x05, 0x00, 0x01, 0xCF, 0x01, 0xFC, 0x01, 0x00, 0x01, 0x09,
-  0x01, 0xFF, 0x01, 0xFB, 0x05, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0xE0,
-  0x04, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xD1, 0x01, 0x00, 0x01, 0x06,
-  0x01, 0xFF, 0x01, 0xFE, 0x05, 0x00, 0x01, 0x8F, 0x01, 0xFF, 0x01, 0xC0,
-  0x04, 0x00, 0x01, 0x7F, 0x01, 0xFF, 0x01, 0x20, 0x01, 0x00, 0x01, 0x03,
-  0x02, 0xFF, 0x05, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0xB0, 0x03, 0x00,
-  0x01, 0x05, 0x01, 0xFF, 0x01, 0xF4, 0x02, 0x00, 0x01, 0x02, 0x02, 0xFF,
-  0x01, 0x10, 0x04, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0xA0, 0x03, 0x00,
-  0x01, 0x3F, 0x01, 0xFF, 0x01, 0x60, 0x02, 0x00, 0x01, 0x01, 0x02, 0xFF,
-  0x01, 0x30, 0x04, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0xA0, 0x02, 0x00,
-  0x01, 0x01, 0x01, 0xEF, 0x01, 0xF8, 0x03, 0x00, 0x01, 0x02, 0x02, 0xFF,
-  0x01, 0x20, 0x04, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0xB0, 0x02, 0x00,
-  0x01, 0x0D, 0x01, 0xFF, 0x01, 0xB0, 0x03, 0x00, 0x01, 0x03, 0x02, 0xFF,
-  0x01, 0x10, 0x04, 0x00, 0x01, 0x8F, 0x01, 0xFF, 0x01, 0xC0, 0x02, 0x00,
-  0x01, 0xBF, 0x01, 0xFD, 0x04, 0x00, 0x01, 0x04, 0x02, 0xFF, 0x05, 0x00,
-  0x01, 0x6F, 0x01, 0xFF, 0x01, 0xE0, 0x01, 0x00, 0x01, 0x08, 0x01, 0xFF,
-  0x01, 0xE1, 0x04, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xFE, 0x05, 0x00,
-  0x01, 0x2F, 0x01, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x6F, 0x01, 0xFF,
-  0x01, 0x30, 0x04, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xFA, 0x05, 0x00,
-  0x01, 0x0F, 0x01, 0xFF, 0x01, 0xF6, 0x01, 0x04, 0x01, 0xFF, 0x01, 0xF5,
-  0x05, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF7, 0x05, 0x00, 0x01, 0x09,
-  0x01, 0xFF, 0x01, 0xFC, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0x70, 0x05, 0x00,
-  0x01, 0x5F, 0x01, 0xFF, 0x01, 0xF2, 0x05, 0x00, 0x01, 0x03, 0x02, 0xFF,
-  0x01, 0xEF, 0x01, 0xFA, 0x06, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0xB0,
-  0x06, 0x00, 0x01, 0xCF, 0x02, 0xFF, 0x01, 0xC0, 0x05, 0x00, 0x01, 0x06,
-  0x02, 0xFF, 0x01, 0x40, 0x06, 0x00, 0x01, 0x2F, 0x02, 0xFF, 0x01, 0x20,
-  0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xFB, 0x07, 0x00, 0x01, 0x0B,
-  0x02, 0xFF, 0x01, 0xD2, 0x04, 0x00, 0x01, 0x06, 0x02, 0xFF, 0x01, 0xE1,
-  0x07, 0x00, 0x01, 0x5F, 0x03, 0xFF, 0x01, 0x93, 0x02, 0x00, 0x01, 0x05,
-  0x01, 0xCF, 0x02, 0xFF, 0x01, 0x30, 0x06, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xFB, 0x03, 0xFF, 0x01, 0xFD, 0x01, 0xDE, 0x03, 0xFF, 0x01, 0xE3,
-  0x07, 0x00, 0x01, 0x1E, 0x01, 0xFF, 0x01, 0x80, 0x01, 0x4D, 0x06, 0xFF,
-  0x01, 0xFA, 0x01, 0x10, 0x07, 0x00, 0x01, 0xBF, 0x01, 0xFB, 0x02, 0x00,
-  0x01, 0x5C, 0x04, 0xFF, 0x01, 0xE9, 0x01, 0x30, 0x08, 0x00, 0x01, 0x1C,
-  0x01, 0xD0, 0x03, 0x00, 0x01, 0x04, 0x01, 0x67, 0x01, 0x86, 0x01, 0x53,
-  0x0B, 0x00, 0x01, 0x10, 0xA8, 0x00,
-
-  /* 10 SML_O_STROKE */
-  0xFF, 0x00, 0x15, 0x00, 0x01, 0x02, 0x01, 0x20, 0x0C, 0x00, 0x01, 0x02,
-  0x01, 0x32, 0x01, 0x10, 0x02, 0x00, 0x01, 0x1D, 0x01, 0xE3, 0x0A, 0x00,
-  0x01, 0x01, 0x01, 0x7C, 0x02, 0xFF, 0x01, 0xFD, 0x01, 0x82, 0x01, 0x00,
-  0x01, 0xCF, 0x01, 0xF7, 0x0A, 0x00, 0x01, 0x6E, 0x05, 0xFF, 0x01, 0x89,
-  0x01, 0xFF, 0x01, 0xA0, 0x09, 0x00, 0x01, 0x08, 0x07, 0xFF, 0x01, 0xFC,
-  0x0A, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0xFC, 0x01, 0x50, 0x01, 0x00,
-  0x01, 0x3A, 0x02, 0xFF, 0x01, 0xF1, 0x09, 0x00, 0x01, 0x01, 0x02, 0xFF,
-  0x01, 0x90, 0x03, 0x00, 0x01, 0x7F, 0x01, 0xFF, 0x01, 0xF5, 0x09, 0x00,
-  0x01, 0x08, 0x01, 0xFF, 0x01, 0xFC, 0x03, 0x00, 0x01, 0x01, 0x01, 0xDF,
-  0x01, 0xFF, 0x01, 0xFD, 0x09, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF3,
-  0x03, 0x00, 0x01, 0x0B, 0x03, 0xFF, 0x01, 0x30, 0x08, 0x00, 0x01, 0x3F,
-  0x01, 0xFF, 0x01, 0xD0, 0x03, 0x00, 0x01, 0x9F, 0x01, 0xFA, 0x01, 0x8F,
-  0x01, 0xFF, 0x01, 0x80, 0x08, 0x00, 0x01, 0x7F, 0x01, 0xFF, 0x01, 0x80,
-  0x02, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xC0, 0x01, 0x3F, 0x01, 0xFF,
-  0x01, 0xB0, 0x08, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0x50, 0x02, 0x00,
-  0x01, 0x3F, 0x01, 0xFE, 0x01, 0x10, 0x01, 0x1F, 0x01, 0xFF, 0x01, 0xE0,
-  0x08, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0x40, 0x01, 0x00, 0x01, 0x02,
-  0x01, 0xEF, 0x01, 0xF3, 0x01, 0x00, 0x01, 0x0F, 0x01, 0xFF, 0x01, 0xF0,
-  0x08, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x30, 0x01, 0x00, 0x01, 0x0D,
-  0x01, 0xFF, 0x01, 0x50, 0x01, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF0,
-  0x08, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0x30, 0x01, 0x00, 0x01, 0xBF,
-  0x01, 0xF8, 0x02, 0x00, 0x01, 0x0F, 0x01, 0xFF, 0x01, 0xF0, 0x08, 0x00,
-  0x01, 0x9F, 0x01, 0xFF, 0x01, 0x40, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xB0,
-  0x02, 0x00, 0x01, 0x0F, 0x01, 0xFF, 0x01, 0xE0, 0x08, 0x00, 0x01, 0x7F,
-  0x01, 0xFF, 0x01, 0x60, 0x01, 0x5F, 0x01, 0xFD, 0x03, 0x00, 0x01, 0x3F,
-  0x01, 0xFF, 0x01, 0xC0, 0x08, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xA3,
-  0x01, 0xFF, 0x01, 0xE2, 0x03, 0x00, 0x01, 0x7F, 0x01, 0xFF, 0x01, 0x90,
-  0x08, 0x00, 0x01, 0x0F, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0xFF, 0x01, 0x40,
-  0x03, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x08, 0x00, 0x01, 0x0A,
-  0x02, 0xFF, 0x01, 0xF6, 0x03, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xFE,
-  0x09, 0x00, 0x01, 0x02, 0x02, 0xFF, 0x01, 0xB0, 0x03, 0x00, 0x01, 0x2E,
-  0x01, 0xFF, 0x01, 0xF8, 0x0A, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0xF7,
-  0x02, 0x00, 0x01, 0x05, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xD0, 0x09, 0x00,
-  0x01, 0x04, 0x03, 0xFF, 0x01, 0xFC, 0x01, 0xAB, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xFE, 0x01, 0x20, 0x09, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0xAF,
-  0x05, 0xFF, 0x01, 0xD2, 0x09, 0x00, 0x01, 0x01, 0x01, 0xDF, 0x01, 0xF5,
-  0x01, 0x04, 0x01, 0xBF, 0x03, 0xFF, 0x01, 0xD6, 0x0A, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0x70, 0x01, 0x00, 0x01, 0x01, 0x01, 0x46, 0x01, 0x76,
-  0x01, 0x52, 0x0C, 0x00, 0x01, 0x28, 0xA9, 0x00,
-
-  /* 11 LRG_AE */
-  0x9E, 0x00, 0x01, 0x14, 0x0B, 0x44, 0x01, 0x41, 0x06, 0x00, 0x01, 0x8F,
-  0x0B, 0xFF, 0x01, 0xF3, 0x06, 0x00, 0x01, 0xEF, 0x0B, 0xFF, 0x01, 0xF3,
-  0x05, 0x00, 0x01, 0x05, 0x02, 0xFF, 0x01, 0xEE, 0x09, 0xFF, 0x01, 0xF3,
-  0x05, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xF5, 0x01, 0x00, 0x01, 0xDF,
-  0x01, 0xFF, 0x01, 0x63, 0x06, 0x33, 0x01, 0x30, 0x05, 0x00, 0x01, 0x3F,
-  0x01, 0xFF, 0x01, 0xE0, 0x01, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40,
-  0x0C, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0x80, 0x01, 0x00, 0x01, 0xDF,
-  0x01, 0xFF, 0x01, 0x40, 0x0B, 0x00, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x10,
-  0x01, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40, 0x0B, 0x00, 0x01, 0x07,
-  0x01, 0xFF, 0x01, 0xFA, 0x02, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40,
-  0x0B, 0x00, 0x01, 0x0D, 0x01, 0xFF, 0x01, 0xF3, 0x02, 0x00, 0x01, 0xDF,
-  0x01, 0xFF, 0x01, 0x40, 0x0B, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xD0,
-  0x02, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40, 0x0B, 0x00, 0x01, 0xBF,
-  0x01, 0xFF, 0x01, 0x60, 0x02, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40,
-  0x0A, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xFE, 0x03, 0x00, 0x01, 0xDF,
-  0x01, 0xFF, 0x01, 0x40, 0x0A, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xF9,
-  0x03, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xED, 0x06, 0xDD, 0x01, 0x80,
-  0x03, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF2, 0x03, 0x00, 0x01, 0xDF,
-  0x08, 0xFF, 0x01, 0xA0, 0x03, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0xB0,
-  0x03, 0x00, 0x01, 0xDF, 0x08, 0xFF, 0x01, 0xA0, 0x03, 0x00, 0x01, 0xCF,
-  0x01, 0xFF, 0x01, 0x40, 0x03, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xA8,
-  0x06, 0x88, 0x01, 0x50, 0x02, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xFE,
-  0x04, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40, 0x09, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xF7, 0x04, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40,
-  0x09, 0x00, 0x01, 0x1F, 0x01, 0xFF, 0x01, 0xF4, 0x04, 0x33, 0x01, 0xDF,
-  0x01, 0xFF, 0x01, 0x40, 0x09, 0x00, 0x01, 0x7F, 0x08, 0xFF, 0x01, 0x40,
-  0x09, 0x00, 0x01, 0xEF, 0x08, 0xFF, 0x01, 0x40, 0x08, 0x00, 0x01, 0x05,
-  0x09, 0xFF, 0x01, 0x40, 0x08, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0xF7,
-  0x05, 0x33, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40, 0x08, 0x00, 0x01, 0x2F,
-  0x01, 0xFF, 0x01, 0xE0, 0x05, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40,
-  0x08, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0x80, 0x05, 0x00, 0x01, 0xDF,
-  0x01, 0xFF, 0x01, 0x40, 0x08, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x05, 0x00,
-  0x01, 0xDF, 0x01, 0xFF, 0x01, 0x40, 0x07, 0x00, 0x01, 0x06, 0x01, 0xFF,
-  0x01, 0xFB, 0x06, 0x00, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xA8, 0x06, 0x88,
-  0x01, 0x85, 0x01, 0x0D, 0x01, 0xFF, 0x01, 0xF4, 0x06, 0x00, 0x01, 0xDF,
-  0x08, 0xFF, 0x01, 0xF9, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xE0, 0x06, 0x00,
-  0x01, 0xDF, 0x08, 0xFF, 0x01, 0xF9, 0x01, 0x8D, 0x01, 0xDD, 0x01, 0x60,
-  0x06, 0x00, 0x01, 0xBD, 0x08, 0xDD, 0x01, 0xD8, 0xBE, 0x00,
-
-  /* 12 SML_AE */
-  0xFF, 0x00, 0x22, 0x00, 0x01, 0x01, 0x01, 0x34, 0x01, 0x31, 0x06, 0x00,
-  0x01, 0x12, 0x01, 0x42, 0x01, 0x10, 0x05, 0x00, 0x01, 0x02, 0x01, 0x7B,
-  0x01, 0xEF, 0x02, 0xFF, 0x01, 0xFB, 0x01, 0x60, 0x02, 0x00, 0x01, 0x03,
-  0x01, 0x9E, 0x02, 0xFF, 0x01, 0xFD, 0x01, 0x81, 0x04, 0x00, 0x01, 0xBF,
-  0x05, 0xFF, 0x01, 0xFE, 0x01, 0x40, 0x01, 0x01, 0x01, 0x9F, 0x05, 0xFF,
-  0x01, 0x60, 0x03, 0x00, 0x01, 0xDF, 0x02, 0xFF, 0x01, 0xEE, 0x03, 0xFF,
-  0x01, 0xF5, 0x01, 0x1D, 0x03, 0xFF, 0x01, 0xEF, 0x02, 0xFF, 0x01, 0xF8,
-  0x03, 0x00, 0x01, 0xDF, 0x01, 0xB6, 0x01, 0x30, 0x01, 0x00, 0x01, 0x01,
-  0x01, 0x5D, 0x02, 0xFF, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xE7, 0x01, 0x20,
-  0x01, 0x00, 0x01, 0x29, 0x02, 0xFF, 0x01, 0x50, 0x02, 0x00, 0x01, 0x71,
-  0x05, 0x00, 0x01, 0xAF, 0x02, 0xFF, 0x01, 0xFB, 0x01, 0x10, 0x03, 0x00,
-  0x01, 0x4F, 0x01, 0xFF, 0x01, 0xE0, 0x08, 0x00, 0x01, 0x0D, 0x02, 0xFF,
-  0x01, 0xD0, 0x04, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF7, 0x08, 0x00,
-  0x01, 0x06, 0x02, 0xFF, 0x01, 0x40, 0x05, 0x00, 0x01, 0xEF, 0x01, 0xFD,
-  0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xFD, 0x06, 0x00, 0x01, 0x9F,
-  0x01, 0xFF, 0x04, 0x00, 0x01, 0x02, 0x01, 0x45, 0x02, 0x66, 0x01, 0x67,
-  0x01, 0xFF, 0x01, 0xF9, 0x06, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x03, 0x00,
-  0x01, 0x4A, 0x06, 0xFF, 0x01, 0xFB, 0x03, 0x66, 0x01, 0x67, 0x02, 0x77,
-  0x01, 0xAF, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x1B, 0x10, 0xFF, 0x01, 0x00,
-  0x01, 0x01, 0x01, 0xDF, 0x02, 0xFF, 0x01, 0xCA, 0x01, 0x98, 0x01, 0x88,
-  0x01, 0x89, 0x0A, 0xFF, 0x01, 0x00, 0x01, 0x09, 0x01, 0xFF, 0x01, 0xFD,
-  0x01, 0x40, 0x03, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xFA, 0x08, 0x77,
-  0x01, 0x00, 0x01, 0x1F, 0x01, 0xFF, 0x01, 0xD0, 0x04, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF7, 0x09, 0x00, 0x01, 0x5F, 0x01, 0xFF, 0x01, 0x70,
-  0x04, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xFA, 0x09, 0x00, 0x01, 0x7F,
-  0x01, 0xFF, 0x01, 0x30, 0x04, 0x00, 0x01, 0x09, 0x01, 0xFF, 0x01, 0xFE,
-  0x09, 0x00, 0x01, 0x7F, 0x01, 0xFF, 0x01, 0x30, 0x04, 0x00, 0x01, 0x0F,
-  0x02, 0xFF, 0x01, 0x50, 0x08, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0x60,
-  0x04, 0x00, 0x01, 0x8F, 0x02, 0xFF, 0x01, 0xE1, 0x08, 0x00, 0x01, 0x3F,
-  0x01, 0xFF, 0x01, 0xD0, 0x03, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xFE,
-  0x01, 0xFF, 0x01, 0xFC, 0x01, 0x10, 0x05, 0x00, 0x01, 0x45, 0x01, 0x00,
-  0x01, 0x0D, 0x01, 0xFF, 0x01, 0xFC, 0x01, 0x20, 0x01, 0x00, 0x01, 0x01,
-  0x01, 0x9F, 0x01, 0xFF, 0x01, 0xA2, 0x02, 0xFF, 0x01, 0xE6, 0x01, 0x10,
-  0x02, 0x00, 0x01, 0x02, 0x01, 0x8D, 0x01, 0xF8, 0x01, 0x00, 0x01, 0x05,
-  0x02, 0xFF, 0x01, 0xFD, 0x01, 0xAB, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0xFC,
-  0x01, 0x00, 0x01, 0x3F, 0x02, 0xFF, 0x01, 0xFD, 0x01, 0xBA, 0x01, 0xBC,
-  0x02, 0xFF, 0x01, 0xF8, 0x02, 0x00, 0x01, 0x7F, 0x05, 0xFF, 0x01, 0xA0,
-  0x01, 0x00, 0x01, 0x02, 0x01, 0xCF, 0x06, 0xFF, 0x01, 0xF7, 0x02, 0x00,
-  0x01, 0x03, 0x01, 0xBF, 0x03, 0xFF, 0x01, 0xB4, 0x03, 0x00, 0x01, 0x05,
-  0x01, 0xBF, 0x04, 0xFF, 0x01, 0xB7, 0x01, 0x10, 0x03, 0x00, 0x01, 0x01,
-  0x01, 0x46, 0x01, 0x76, 0x01, 0x41, 0x06, 0x00, 0x01, 0x35, 0x01, 0x67,
-  0x01, 0x64, 0x01, 0x20, 0xAD, 0x00,
-
-  /* 13 LRG_ETH */
-  0x9A, 0x00, 0x01, 0x34, 0x03, 0x44, 0x01, 0x43, 0x01, 0x21, 0x0D, 0x00,
-  0x01, 0xBF, 0x05, 0xFF, 0x01, 0xFE, 0x01, 0xB8, 0x01, 0x40, 0x0A, 0x00,
-  0x01, 0xBF, 0x07, 0xFF, 0x01, 0xFE, 0x01, 0x81, 0x09, 0x00, 0x01, 0xBF,
-  0x08, 0xFF, 0x01, 0xFE, 0x01, 0x60, 0x08, 0x00, 0x01, 0xBF, 0x01, 0xFF,
-  0x01, 0x61, 0x02, 0x11, 0x01, 0x23, 0x01, 0x58, 0x01, 0xCF, 0x02, 0xFF,
-  0x01, 0xF9, 0x08, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x04, 0x00,
-  0x01, 0x02, 0x01, 0x9F, 0x02, 0xFF, 0x01, 0x80, 0x07, 0x00, 0x01, 0xBF,
-  0x01, 0xFF, 0x01, 0x50, 0x05, 0x00, 0x01, 0x04, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xF4, 0x07, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x06, 0x00,
-  0x01, 0x2F, 0x01, 0xFF, 0x01, 0xFD, 0x07, 0x00, 0x01, 0xBF, 0x01, 0xFF,
-  0x01, 0x50, 0x06, 0x00, 0x01, 0x06, 0x02, 0xFF, 0x01, 0x50, 0x06, 0x00,
-  0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x07, 0x00, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xB0, 0x06, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x07, 0x00,
-  0x01, 0x7F, 0x01, 0xFF, 0x01, 0xF0, 0x06, 0x00, 0x01, 0xBF, 0x01, 0xFF,
-  0x01, 0x50, 0x07, 0x00, 0x01, 0x3F, 0x01, 0xFF, 0x01, 0xF3, 0x06, 0x00,
-  0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x07, 0x00, 0x01, 0x0F, 0x01, 0xFF,
-  0x01, 0xF5, 0x04, 0x00, 0x01, 0x23, 0x01, 0x33, 0x01, 0xCF, 0x01, 0xFF,
-  0x01, 0x73, 0x02, 0x33, 0x01, 0x30, 0x04, 0x00, 0x01, 0x0D, 0x01, 0xFF,
-  0x01, 0xF6, 0x04, 0x00, 0x01, 0xCF, 0x06, 0xFF, 0x01, 0xF2, 0x04, 0x00,
-  0x01, 0x0C, 0x01, 0xFF, 0x01, 0xF7, 0x04, 0x00, 0x01, 0xCF, 0x06, 0xFF,
-  0x01, 0xF2, 0x04, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0xF9, 0x04, 0x00,
-  0x01, 0x9B, 0x01, 0xBB, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xDB, 0x02, 0xBB,
-  0x01, 0xB1, 0x04, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xF8, 0x06, 0x00,
-  0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x07, 0x00, 0x01, 0x0D, 0x01, 0xFF,
-  0x01, 0xF7, 0x06, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x07, 0x00,
-  0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF6, 0x06, 0x00, 0x01, 0xBF, 0x01, 0xFF,
-  0x01, 0x50, 0x07, 0x00, 0x01, 0x1F, 0x01, 0xFF, 0x01, 0xF4, 0x06, 0x00,
-  0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x07, 0x00, 0x01, 0x5F, 0x01, 0xFF,
-  0x01, 0xF1, 0x06, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x07, 0x00,
-  0x01, 0xAF, 0x01, 0xFF, 0x01, 0xD0, 0x06, 0x00, 0x01, 0xBF, 0x01, 0xFF,
-  0x01, 0x50, 0x06, 0x00, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x80, 0x06, 0x00,
-  0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x06, 0x00, 0x01, 0x0B, 0x02, 0xFF,
-  0x01, 0x20, 0x06, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x06, 0x00,
-  0x01, 0x8F, 0x01, 0xFF, 0x01, 0xF9, 0x07, 0x00, 0x01, 0xBF, 0x01, 0xFF,
-  0x01, 0x50, 0x05, 0x00, 0x01, 0x0A, 0x02, 0xFF, 0x01, 0xE1, 0x07, 0x00,
-  0x01, 0xBF, 0x01, 0xFF, 0x01, 0x50, 0x04, 0x00, 0x01, 0x29, 0x03, 0xFF,
-  0x01, 0x30, 0x07, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0xA7, 0x01, 0x77,
-  0x01, 0x78, 0x01, 0x9A, 0x01, 0xBF, 0x03, 0xFF, 0x01, 0xE3, 0x08, 0x00,
-  0x01, 0xBF, 0x08, 0xFF, 0x01, 0xF9, 0x01, 0x10, 0x08, 0x00, 0x01, 0xBF,
-  0x07, 0xFF, 0x01, 0xD8, 0x01, 0x10, 0x09, 0x00, 0x01, 0xAD, 0x03, 0xDD,
-  0x01, 0xDC, 0x01, 0xCB, 0x01, 0xA7, 0x01, 0x41, 0xC7, 0x00,
-
-  /* 14 SML_ETH */
-  0x88, 0x00, 0x01, 0x38, 0x01, 0x88, 0x01, 0x81, 0x10, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0xFC, 0x03, 0x00, 0x01, 0x5A, 0x01, 0x40, 0x0C, 0x00,
-  0x01, 0xDF, 0x01, 0xFF, 0x01, 0xB0, 0x01, 0x04, 0x01, 0xAF, 0x01, 0xFF,
-  0x01, 0xA0, 0x0C, 0x00, 0x01, 0x1E, 0x01, 0xFF, 0x01, 0xFC, 0x02, 0xFF,
-  0x01, 0xD8, 0x01, 0x20, 0x0C, 0x00, 0x01, 0x07, 0x02, 0xFF, 0x01, 0xFD,
-  0x01, 0x82, 0x0D, 0x00, 0x01, 0x5A, 0x03, 0xFF, 0x01, 0xF4, 0x0D, 0x00,
-  0x01, 0x7F, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0x87, 0x02, 0xFF, 0x01, 0x30,
-  0x0C, 0x00, 0x01, 0x6F, 0x01, 0xE9, 0x01, 0x30, 0x01, 0x00, 0x01, 0x8F,
-  0x01, 0xFF, 0x01, 0xE2, 0x0C, 0x00, 0x01, 0x03, 0x03, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xFD, 0x01, 0x10, 0x0E, 0x00, 0x01, 0x23, 0x01, 0x44,
-  0x01, 0xDF, 0x01, 0xFF, 0x01, 0xB0, 0x0C, 0x00, 0x01, 0x02, 0x01, 0x9E,
-  0x04, 0xFF, 0x01, 0xF7, 0x0C, 0x00, 0x01, 0x7F, 0x06, 0xFF, 0x01, 0x30,
-  0x0A, 0x00, 0x01, 0x09, 0x02, 0xFF, 0x01, 0xFE, 0x01, 0xCB, 0x01, 0xDF,
-  0x02, 0xFF, 0x01, 0xD0, 0x0A, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0xFB,
-  0x01, 0x30, 0x02, 0x00, 0x01, 0x4E, 0x01, 0xFF, 0x01, 0xF5, 0x09, 0x00,
-  0x01, 0x02, 0x02, 0xFF, 0x01, 0x70, 0x03, 0x00, 0x01, 0x05, 0x01, 0xFF,
-  0x01, 0xFD, 0x09, 0x00, 0x01, 0x09, 0x01, 0xFF, 0x01, 0xFA, 0x05, 0x00,
-  0x01, 0xEF, 0x01, 0xFF, 0x01, 0x20, 0x08, 0x00, 0x01, 0x0F, 0x01, 0xFF,
-  0x01, 0xF1, 0x05, 0x00, 0x01, 0x8F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00,
-  0x01, 0x4F, 0x01, 0xFF, 0x01, 0xA0, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF,
-  0x01, 0xB0, 0x08, 0x00, 0x01, 0x8F, 0x01, 0xFF, 0x01, 0x70, 0x05, 0x00,
-  0x01, 0x1F, 0x01, 0xFF, 0x01, 0xD0, 0x08, 0x00, 0x01, 0x9F, 0x01, 0xFF,
-  0x01, 0x40, 0x05, 0x00, 0x01, 0x0F, 0x01, 0xFF, 0x01, 0xF0, 0x08, 0x00,
-  0x01, 0xAF, 0x01, 0xFF, 0x01, 0x30, 0x05, 0x00, 0x01, 0x0E, 0x01, 0xFF,
-  0x01, 0xF0, 0x08, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0x30, 0x05, 0x00,
-  0x01, 0x0F, 0x01, 0xFF, 0x01, 0xF0, 0x08, 0x00, 0x01, 0x9F, 0x01, 0xFF,
-  0x01, 0x40, 0x05, 0x00, 0x01, 0x0F, 0x01, 0xFF, 0x01, 0xE0, 0x08, 0x00,
-  0x01, 0x8F, 0x01, 0xFF, 0x01, 0x70, 0x05, 0x00, 0x01, 0x2F, 0x01, 0xFF,
-  0x01, 0xD0, 0x08, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xA0, 0x05, 0x00,
-  0x01, 0x6F, 0x01, 0xFF, 0x01, 0x90, 0x08, 0x00, 0x01, 0x0F, 0x01, 0xFF,
-  0x01, 0xF1, 0x05, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x08, 0x00,
-  0x01, 0x09, 0x01, 0xFF, 0x01, 0xF9, 0x04, 0x00, 0x01, 0x05, 0x01, 0xFF,
-  0x01, 0xFE, 0x09, 0x00, 0x01, 0x02, 0x02, 0xFF, 0x01, 0x60, 0x03, 0x00,
-  0x01, 0x3E, 0x01, 0xFF, 0x01, 0xF6, 0x0A, 0x00, 0x01, 0x7F, 0x01, 0xFF,
-  0x01, 0xF9, 0x01, 0x20, 0x01, 0x00, 0x01, 0x07, 0x02, 0xFF, 0x01, 0xB0,
-  0x0A, 0x00, 0x01, 0x09, 0x02, 0xFF, 0x01, 0xFD, 0x01, 0xBD, 0x02, 0xFF,
-  0x01, 0xFD, 0x01, 0x10, 0x0B, 0x00, 0x01, 0x7F, 0x05, 0xFF, 0x01, 0xB0,
-  0x0C, 0x00, 0x01, 0x02, 0x01, 0xAE, 0x03, 0xFF, 0x01, 0xB4, 0x0F, 0x00,
-  0x01, 0x35, 0x01, 0x65, 0x01, 0x40, 0xB6, 0x00,
-
-  /* 15 LRG_THORN */
-  0x9A, 0x00, 0x02, 0x55, 0x11, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x10, 0x00,
-  0x02, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x10, 0x00,
-  0x02, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x10, 0x00,
-  0x05, 0xFF, 0x01, 0xED, 0x01, 0xA7, 0x01, 0x10, 0x0B, 0x00, 0x07, 0xFF,
-  0x01, 0xFA, 0x01, 0x10, 0x0A, 0x00, 0x08, 0xFF, 0x01, 0xE2, 0x0A, 0x00,
-  0x02, 0xFF, 0x01, 0x65, 0x01, 0x55, 0x01, 0x56, 0x01, 0x7A, 0x02, 0xFF,
-  0x01, 0xFE, 0x01, 0x10, 0x09, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x03, 0x00,
-  0x01, 0x1B, 0x02, 0xFF, 0x01, 0x80, 0x09, 0x00, 0x02, 0xFF, 0x01, 0x20,
-  0x04, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0xF0, 0x09, 0x00, 0x02, 0xFF,
-  0x01, 0x20, 0x04, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xF3, 0x09, 0x00,
-  0x02, 0xFF, 0x01, 0x20, 0x04, 0x00, 0x01, 0x0F, 0x01, 0xFF, 0x01, 0xF6,
-  0x09, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x04, 0x00, 0x01, 0x0D, 0x01, 0xFF,
-  0x01, 0xF7, 0x09, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x04, 0x00, 0x01, 0x0D,
-  0x01, 0xFF, 0x01, 0xF7, 0x09, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x04, 0x00,
-  0x01, 0x0F, 0x01, 0xFF, 0x01, 0xF6, 0x09, 0x00, 0x02, 0xFF, 0x01, 0x20,
-  0x04, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xF3, 0x09, 0x00, 0x02, 0xFF,
-  0x01, 0x20, 0x04, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0xF0, 0x09, 0x00,
-  0x02, 0xFF, 0x01, 0x20, 0x03, 0x00, 0x01, 0x1B, 0x02, 0xFF, 0x01, 0x80,
-  0x09, 0x00, 0x02, 0xFF, 0x01, 0x65, 0x02, 0x55, 0x01, 0x7A, 0x02, 0xFF,
-  0x01, 0xFE, 0x01, 0x10, 0x09, 0x00, 0x08, 0xFF, 0x01, 0xE2, 0x0A, 0x00,
-  0x07, 0xFF, 0x01, 0xFA, 0x01, 0x10, 0x0A, 0x00, 0x05, 0xFF, 0x01, 0xED,
-  0x01, 0xA7, 0x01, 0x10, 0x0B, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x10, 0x00,
-  0x02, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x10, 0x00,
-  0x02, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x02, 0xFF, 0x01, 0x20, 0x10, 0x00,
-  0x02, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x02, 0xCC, 0x01, 0x10, 0xCC, 0x00,
-
-  /* 16 SML_THORN */
-  0x86, 0x00, 0x01, 0x02, 0x01, 0x99, 0x01, 0x94, 0x10, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7,
-  0x10, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7,
-  0x10, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7,
-  0x02, 0x00, 0x01, 0x13, 0x01, 0x54, 0x01, 0x20, 0x0B, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF7, 0x01, 0x00, 0x01, 0x5C, 0x02, 0xFF, 0x01, 0xFD,
-  0x01, 0x70, 0x0A, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7, 0x01, 0x0B,
-  0x04, 0xFF, 0x01, 0xFD, 0x01, 0x20, 0x09, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF7, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0xEC, 0x01, 0xDF, 0x02, 0xFF,
-  0x01, 0xE1, 0x09, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0xFF,
-  0x01, 0xC3, 0x02, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0xFC, 0x09, 0x00,
-  0x01, 0x03, 0x02, 0xFF, 0x01, 0xFA, 0x03, 0x00, 0x01, 0x02, 0x01, 0xEF,
-  0x01, 0xFF, 0x01, 0x60, 0x08, 0x00, 0x01, 0x03, 0x02, 0xFF, 0x01, 0xE0,
-  0x04, 0x00, 0x01, 0x5F, 0x01, 0xFF, 0x01, 0xD0, 0x08, 0x00, 0x01, 0x03,
-  0x02, 0xFF, 0x01, 0x60, 0x04, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xF3,
-  0x08, 0x00, 0x01, 0x03, 0x02, 0xFF, 0x05, 0x00, 0x01, 0x06, 0x01, 0xFF,
-  0x01, 0xF7, 0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xFC, 0x05, 0x00,
-  0x01, 0x02, 0x01, 0xFF, 0x01, 0xFB, 0x08, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF9, 0x06, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x08, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF8, 0x06, 0x00, 0x01, 0xEF, 0x01, 0xFE, 0x08, 0x00,
-  0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x06, 0x00, 0x01, 0xEF, 0x01, 0xFF,
-  0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF8, 0x06, 0x00, 0x01, 0xEF,
-  0x01, 0xFE, 0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF9, 0x06, 0x00,
-  0x01, 0xFF, 0x01, 0xFD, 0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xFC,
-  0x05, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xFB, 0x08, 0x00, 0x01, 0x03,
-  0x02, 0xFF, 0x05, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF8, 0x08, 0x00,
-  0x01, 0x03, 0x02, 0xFF, 0x01, 0x60, 0x04, 0x00, 0x01, 0x0C, 0x01, 0xFF,
-  0x01, 0xF3, 0x08, 0x00, 0x01, 0x03, 0x02, 0xFF, 0x01, 0xD0, 0x04, 0x00,
-  0x01, 0x5F, 0x01, 0xFF, 0x01, 0xD0, 0x08, 0x00, 0x01, 0x03, 0x02, 0xFF,
-  0x01, 0xFA, 0x03, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0x60,
-  0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0xFF, 0x01, 0xB3,
-  0x02, 0x00, 0x01, 0x6E, 0x01, 0xFF, 0x01, 0xFC, 0x09, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF7, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0xEC, 0x01, 0xCF,
-  0x02, 0xFF, 0x01, 0xE2, 0x09, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7,
-  0x01, 0x0B, 0x04, 0xFF, 0x01, 0xFD, 0x01, 0x20, 0x09, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF7, 0x01, 0x00, 0x01, 0x6C, 0x02, 0xFF, 0x01, 0xFE,
-  0x01, 0x70, 0x0A, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7, 0x02, 0x00,
-  0x01, 0x23, 0x01, 0x54, 0x01, 0x20, 0x0B, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF7, 0x10, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00,
-  0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF7, 0x10, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00,
-  0x01, 0x03, 0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00, 0x01, 0x03, 0x01, 0xFF,
-  0x01, 0xF7, 0x10, 0x00, 0x01, 0x01, 0x01, 0x66, 0x01, 0x63, 0x22, 0x00,
+constexpr uint32_t font_scandinavian_size = 7840; // Inflated size
+
+const unsigned char font_scandinavian[] PROGMEM = {
+  0x78, 0xda, 0xed, 0x99, 0x5d, 0x68, 0x5b, 0x75, 0x14, 0xc0, 0x6f, 0x92,
+  0xa6, 0x9f, 0xa6, 0xc9, 0xd4, 0xb7, 0xad, 0x36, 0xd2, 0x17, 0xf7, 0xb2,
+  0x56, 0xbb, 0x81, 0xf8, 0x60, 0x33, 0xdd, 0x14, 0x04, 0x6d, 0x51, 0x2b,
+  0x32, 0x26, 0x8d, 0xcc, 0xb6, 0x2f, 0x62, 0x2a, 0x82, 0x15, 0x15, 0xd2,
+  0x0a, 0x6a, 0xf7, 0x30, 0x3a, 0x50, 0x41, 0x37, 0x58, 0x8a, 0x3e, 0x54,
+  0x18, 0x9a, 0x88, 0xa2, 0xb2, 0x3a, 0x52, 0xf0, 0x6d, 0x1b, 0xa4, 0xfa,
+  0x20, 0x03, 0xad, 0xc9, 0x36, 0x50, 0x06, 0x9b, 0xd7, 0x7e, 0x99, 0x34,
+  0xc9, 0xcd, 0xf1, 0xfc, 0xbf, 0xee, 0xff, 0xdc, 0x7b, 0x33, 0xe7, 0x4b,
+  0xb7, 0xa1, 0x39, 0x0f, 0xcd, 0xed, 0x2f, 0xf7, 0xfe, 0x3f, 0xce, 0xff,
+  0x7c, 0xde, 0x18, 0xc6, 0xad, 0x2a, 0x31, 0x72, 0xfd, 0xe8, 0xb1, 0x53,
+  0x1f, 0x44, 0x0c, 0xa3, 0xa5, 0x64, 0x13, 0x7f, 0x1a, 0x50, 0xaa, 0x43,
+  0xc6, 0x08, 0xf4, 0x29, 0x36, 0x0b, 0x5c, 0xaa, 0x3d, 0xf0, 0x97, 0x42,
+  0x3b, 0xf0, 0xff, 0x33, 0xc7, 0xf3, 0x00, 0x35, 0x98, 0x52, 0x2c, 0x07,
+  0xd6, 0x10, 0x0e, 0x90, 0x02, 0x28, 0x2b, 0xd4, 0x06, 0x70, 0x94, 0x7d,
+  0x06, 0x4c, 0x58, 0x53, 0x6c, 0x04, 0x36, 0xc5, 0x45, 0x0a, 0xaa, 0x8a,
+  0xe5, 0x61, 0x91, 0x7f, 0x36, 0xe3, 0xb0, 0x71, 0x81, 0x9a, 0x40, 0x2e,
+  0x60, 0x10, 0xd4, 0xb7, 0x46, 0x87, 0x7c, 0xc2, 0x6f, 0x16, 0x07, 0xd4,
+  0x80, 0x61, 0xb9, 0xa8, 0x2e, 0x98, 0x0b, 0x81, 0xdc, 0xc7, 0x00, 0xac,
+  0x8a, 0x15, 0x55, 0x71, 0x05, 0x15, 0xc1, 0x12, 0x50, 0x60, 0x1f, 0xed,
+  0xf0, 0x03, 0xce, 0x52, 0x53, 0x1b, 0xe3, 0x03, 0x27, 0x21, 0x6a, 0x04,
+  0x00, 0xd4, 0xaa, 0x32, 0xf8, 0x37, 0x08, 0xeb, 0x38, 0x0d, 0x40, 0x84,
+  0xb3, 0x34, 0xcc, 0xf1, 0x51, 0x71, 0x69, 0x3e, 0xb5, 0x2c, 0xce, 0x7c,
+  0x26, 0x9b, 0x11, 0xef, 0x8b, 0xea, 0x67, 0x43, 0x7c, 0x80, 0x80, 0x7a,
+  0x96, 0xcf, 0x91, 0xb5, 0xe4, 0x96, 0xf4, 0x5a, 0x5a, 0xe1, 0x82, 0xd8,
+  0xb1, 0x5c, 0x4b, 0x2f, 0xae, 0x39, 0x21, 0xc6, 0x6e, 0x57, 0x0a, 0xc4,
+  0xbd, 0x35, 0xc1, 0x06, 0xbf, 0xec, 0x84, 0xa2, 0x52, 0x69, 0x75, 0x17,
+  0x4c, 0x48, 0x4d, 0x8a, 0x6d, 0xb2, 0xc9, 0xcc, 0xb2, 0x3a, 0x84, 0x8c,
+  0x7d, 0x1c, 0x5a, 0xa9, 0xea, 0xcc, 0x7b, 0xd5, 0x4a, 0x07, 0x95, 0x5a,
+  0x98, 0x52, 0xe1, 0x47, 0x79, 0xdb, 0x05, 0x7d, 0x46, 0x00, 0xef, 0xa1,
+  0x16, 0x72, 0x60, 0x5b, 0x41, 0x00, 0x2a, 0x08, 0xad, 0x5f, 0xf1, 0xcf,
+  0x25, 0x75, 0xdb, 0x5d, 0x30, 0xf5, 0xb8, 0xb0, 0x8d, 0x72, 0x44, 0xb1,
+  0x2c, 0x0e, 0x7c, 0x90, 0xa1, 0xcb, 0xb6, 0xfd, 0x18, 0x3b, 0x96, 0xd8,
+  0xee, 0xc7, 0xdf, 0x79, 0x8a, 0xda, 0x61, 0xc4, 0x68, 0xc8, 0x7f, 0x4d,
+  0xfc, 0x51, 0xe7, 0xbf, 0xf7, 0xe1, 0x21, 0x77, 0x5d, 0x22, 0xc4, 0xf7,
+  0x26, 0xda, 0xd0, 0x5b, 0x46, 0xae, 0x48, 0xd8, 0x4b, 0xdc, 0x82, 0x0e,
+  0x73, 0x1f, 0x93, 0xd2, 0x0a, 0x32, 0xe4, 0x90, 0xdb, 0x12, 0x2c, 0x2a,
+  0x3d, 0x00, 0xb0, 0x42, 0x46, 0x13, 0xe1, 0x25, 0x29, 0x7d, 0x44, 0x3e,
+  0xca, 0x1e, 0xf2, 0xe5, 0xc1, 0xd2, 0xac, 0x93, 0x07, 0x0b, 0x34, 0x74,
+  0x1d, 0xd3, 0xd0, 0x9b, 0x99, 0x51, 0xa6, 0xca, 0xb3, 0x3a, 0x80, 0xe1,
+  0x40, 0x53, 0xcc, 0x0f, 0x16, 0x07, 0x6c, 0x27, 0x62, 0x3e, 0x8d, 0x41,
+  0x6d, 0xa0, 0x16, 0xe9, 0x16, 0xf1, 0x43, 0xfa, 0x7e, 0x0c, 0x63, 0xd0,
+  0x1a, 0xfa, 0xe7, 0x9f, 0x36, 0xcb, 0xe2, 0xd8, 0x21, 0xbc, 0xb7, 0x93,
+  0xb0, 0x34, 0xb2, 0x6c, 0xc9, 0x70, 0xdc, 0x97, 0x82, 0x58, 0x2b, 0x1b,
+  0x3e, 0x4c, 0xc6, 0x4b, 0x42, 0x7c, 0xc4, 0xe2, 0x6b, 0x5a, 0xb4, 0xd9,
+  0x20, 0x7c, 0x02, 0x17, 0xf9, 0x77, 0x47, 0x6d, 0x16, 0xc6, 0x70, 0x1b,
+  0xe3, 0xae, 0x3d, 0x64, 0xb3, 0x76, 0xe0, 0x01, 0x30, 0xa8, 0xe2, 0x88,
+  0x21, 0x02, 0x12, 0xdb, 0xc0, 0x2e, 0x28, 0x11, 0xfd, 0x65, 0x59, 0x04,
+  0x09, 0x9a, 0x7c, 0xdb, 0x86, 0x1d, 0x63, 0xa1, 0x7a, 0xd2, 0x84, 0x1a,
+  0x39, 0xb6, 0x5e, 0xe0, 0x19, 0x40, 0xc4, 0x04, 0xa9, 0xe6, 0xfc, 0x46,
+  0x53, 0x16, 0xd1, 0x4f, 0x64, 0xb4, 0x00, 0xc6, 0x20, 0xdf, 0x23, 0xaf,
+  0x3e, 0xe9, 0x38, 0xef, 0x7b, 0x1a, 0x1e, 0xb0, 0x35, 0x72, 0xe7, 0x3e,
+  0x2d, 0x7b, 0x9d, 0x59, 0x99, 0x8b, 0x4a, 0xae, 0xa6, 0x97, 0x05, 0x01,
+  0xfe, 0x70, 0xb3, 0xdb, 0xd0, 0x61, 0xf2, 0x70, 0xa8, 0x9f, 0x4b, 0x9f,
+  0xf2, 0x87, 0x02, 0xb2, 0x98, 0x63, 0xda, 0x34, 0xfa, 0x83, 0x8b, 0xf9,
+  0x58, 0x5e, 0x73, 0xb1, 0x16, 0x96, 0xaf, 0x5c, 0x2c, 0xc4, 0xe6, 0x72,
+  0xb1, 0x41, 0x66, 0x7b, 0x2e, 0x96, 0x65, 0x49, 0xd5, 0xc9, 0xfc, 0xdc,
+  0x94, 0x9d, 0xac, 0x95, 0x17, 0x0d, 0x79, 0xb8, 0xba, 0xcc, 0x65, 0x4a,
+  0x78, 0xf5, 0x2a, 0x67, 0x52, 0xe6, 0x44, 0x90, 0xc8, 0x78, 0x58, 0x8e,
+  0x8f, 0x94, 0x87, 0x4f, 0x67, 0xb8, 0x0c, 0x71, 0xeb, 0xad, 0x19, 0xee,
+  0x39, 0xda, 0x45, 0x86, 0x75, 0xb0, 0x6e, 0x58, 0x67, 0x2a, 0x72, 0xb0,
+  0xa4, 0x1a, 0x9c, 0x30, 0xd3, 0xcb, 0x82, 0xe0, 0x65, 0x1d, 0x50, 0xec,
+  0x77, 0x8f, 0xd7, 0x2b, 0xe3, 0x00, 0x65, 0x29, 0x19, 0x93, 0x28, 0x53,
+  0x99, 0x9b, 0xb0, 0x66, 0x95, 0xc4, 0xed, 0xbd, 0xbd, 0x8d, 0x7a, 0x5f,
+  0x57, 0x4c, 0xca, 0x26, 0xea, 0xbd, 0xe0, 0x61, 0x47, 0x96, 0x65, 0x9d,
+  0x75, 0x7a, 0x59, 0xca, 0xf9, 0x86, 0x9b, 0xfd, 0x4f, 0xc5, 0xb7, 0xfb,
+  0x5e, 0x71, 0x71, 0xfb, 0x43, 0xb2, 0x28, 0xf3, 0xbf, 0x81, 0x16, 0x5d,
+  0x41, 0x0b, 0x09, 0x9c, 0xc0, 0x7c, 0x3d, 0x2d, 0x3d, 0x95, 0x49, 0x2d,
+  0xe6, 0x4b, 0xf1, 0x8b, 0xb8, 0x34, 0x28, 0x16, 0x5c, 0x36, 0xba, 0xf0,
+  0x0f, 0x3e, 0xc1, 0xd3, 0x4d, 0xfe, 0xeb, 0x3e, 0xc3, 0xf7, 0x1c, 0x60,
+  0xd5, 0xfe, 0x7b, 0xd4, 0xd8, 0x09, 0x3c, 0x55, 0xbd, 0x2c, 0xc3, 0x09,
+  0x54, 0x22, 0x3c, 0x0e, 0x14, 0x48, 0x9c, 0x10, 0x09, 0xa9, 0x05, 0x74,
+  0x49, 0x60, 0x17, 0xac, 0xa6, 0x45, 0xf2, 0x8d, 0xa5, 0x7c, 0x43, 0xac,
+  0x70, 0xff, 0xd8, 0xd8, 0xb8, 0xea, 0x24, 0x12, 0x9c, 0x3d, 0x26, 0x6c,
+  0xbb, 0x32, 0x86, 0xdf, 0x4c, 0x4e, 0xa6, 0x19, 0xdb, 0x0e, 0x2e, 0xe1,
+  0x95, 0x01, 0x9c, 0xf9, 0x70, 0xe6, 0x30, 0x65, 0x6d, 0x60, 0xc5, 0x78,
+  0xe0, 0x29, 0x4f, 0x4a, 0x61, 0xae, 0xbf, 0x24, 0xe6, 0x25, 0xa5, 0xca,
+  0x88, 0x28, 0xbc, 0x83, 0xba, 0xc1, 0x61, 0xe1, 0xa0, 0x4f, 0x94, 0xe5,
+  0x35, 0x0f, 0x0b, 0x03, 0xc9, 0xd3, 0x09, 0xa1, 0xb1, 0x59, 0x52, 0x65,
+  0xcb, 0x1a, 0x04, 0x5b, 0x00, 0xa8, 0x0a, 0xc5, 0xef, 0x67, 0x0a, 0xa9,
+  0x46, 0x0d, 0xd4, 0xf1, 0xc7, 0x00, 0xbf, 0x21, 0xf4, 0x1f, 0x29, 0xf1,
+  0x58, 0x62, 0x9d, 0xcc, 0x61, 0x61, 0x33, 0x80, 0x17, 0xa7, 0xbe, 0x13,
+  0x8a, 0x4e, 0xca, 0x08, 0xe7, 0xcf, 0x89, 0x6d, 0xb0, 0x75, 0x06, 0xd8,
+  0x21, 0x7d, 0xc5, 0x96, 0xc8, 0x4f, 0xeb, 0x1b, 0x3e, 0x2a, 0xa6, 0x69,
+  0x99, 0x33, 0xf6, 0x8c, 0xbf, 0x10, 0x6d, 0x98, 0xfb, 0x16, 0xc9, 0x6e,
+  0xcc, 0xcd, 0x0f, 0xdf, 0xed, 0x64, 0xd2, 0x67, 0xbe, 0x8d, 0x79, 0x18,
+  0xd2, 0x69, 0x2f, 0x83, 0x5a, 0x9c, 0xb0, 0xe7, 0xb7, 0x6d, 0xeb, 0x79,
+  0x36, 0x07, 0xca, 0xca, 0x39, 0xe3, 0x06, 0xc5, 0x7a, 0xec, 0x29, 0x17,
+  0x33, 0x9a, 0x4c, 0x15, 0xfa, 0x35, 0xc3, 0xec, 0x62, 0x79, 0x58, 0xb3,
+  0x36, 0x4b, 0x9b, 0x61, 0x06, 0xcb, 0x78, 0x58, 0xd2, 0x2e, 0x5b, 0x35,
+  0xb3, 0xfb, 0x6e, 0xc2, 0xc2, 0xb2, 0xfe, 0xee, 0xe9, 0xcf, 0xc1, 0x2b,
+  0xb2, 0xa0, 0x08, 0xc9, 0xb6, 0x5c, 0x1a, 0xe7, 0xaa, 0x28, 0x3b, 0x8a,
+  0x1e, 0xd6, 0x21, 0x77, 0x77, 0x7c, 0xc1, 0x84, 0x9f, 0x17, 0x16, 0xbe,
+  0x10, 0xf7, 0x95, 0x3c, 0x73, 0x84, 0x6c, 0x3f, 0xd4, 0xac, 0xd3, 0x7e,
+  0x1f, 0xa1, 0x59, 0xb7, 0xad, 0x04, 0xcd, 0x46, 0xec, 0x9e, 0x41, 0xb3,
+  0xb4, 0x5d, 0x07, 0xdb, 0xcc, 0xa7, 0x95, 0x6a, 0xb3, 0x0e, 0x95, 0x76,
+  0x09, 0x9b, 0xd5, 0x07, 0xa2, 0x58, 0x3b, 0xf1, 0x6a, 0xc9, 0x76, 0xd2,
+  0x6e, 0x23, 0x0b, 0xf3, 0x93, 0xaf, 0x1d, 0xcb, 0xd2, 0xde, 0x59, 0x9f,
+  0xf9, 0x66, 0xc4, 0xc3, 0xce, 0x93, 0xe6, 0xf8, 0x33, 0xcc, 0xcd, 0xbf,
+  0x9c, 0x9d, 0xdf, 0xdb, 0xf0, 0xb0, 0x2d, 0x96, 0xfb, 0x67, 0xa6, 0x3d,
+  0x4c, 0xbc, 0x71, 0x3a, 0xe0, 0x2c, 0x8b, 0xf3, 0x90, 0x69, 0x4a, 0xd3,
+  0x76, 0x95, 0xbf, 0x0a, 0xa9, 0xe2, 0xb1, 0x39, 0xa3, 0x6b, 0x0b, 0xef,
+  0x75, 0x1d, 0x72, 0x00, 0x0f, 0x77, 0xdd, 0x89, 0x92, 0x60, 0xbd, 0x4b,
+  0x1b, 0x53, 0x9e, 0x2c, 0x2e, 0xf7, 0xa1, 0x99, 0x5d, 0x74, 0xb0, 0x00,
+  0xb7, 0x33, 0xcb, 0xfd, 0xda, 0xa4, 0x67, 0x5f, 0x9e, 0x74, 0xab, 0x3c,
+  0x3a, 0x9c, 0x50, 0xe9, 0xc0, 0x53, 0xb4, 0xd2, 0x59, 0xda, 0x30, 0xda,
+  0x9c, 0xcd, 0x03, 0xed, 0x07, 0x31, 0x49, 0x55, 0xf0, 0x96, 0x27, 0x68,
+  0x3f, 0x8d, 0xbd, 0xe4, 0x04, 0xcf, 0x79, 0x16, 0x7d, 0xb4, 0x2c, 0x83,
+  0x46, 0x94, 0xf4, 0xa6, 0x2b, 0xd2, 0x3b, 0x26, 0x48, 0xc1, 0x3f, 0x27,
+  0x3f, 0xf5, 0x0a, 0xd5, 0xf7, 0xdd, 0x64, 0xe2, 0x94, 0xcc, 0xf7, 0x61,
+  0x57, 0xef, 0x2c, 0x9c, 0xdc, 0xcb, 0x5c, 0xfd, 0xb4, 0x64, 0x05, 0xcf,
+  0x1c, 0xbd, 0x64, 0x0e, 0xb5, 0x96, 0x84, 0xa3, 0x9f, 0x5e, 0x91, 0x01,
+  0x69, 0x88, 0xec, 0x6d, 0xd3, 0xa8, 0xd3, 0x4f, 0xb3, 0xb8, 0xfc, 0xa0,
+  0x7e, 0xff, 0xc9, 0x55, 0xba, 0x19, 0x65, 0x47, 0x9c, 0x71, 0xea, 0xd4,
+  0x3a, 0x0d, 0xae, 0x43, 0x12, 0xba, 0x77, 0x9d, 0xd1, 0xe7, 0x32, 0x51,
+  0x3b, 0x64, 0xcf, 0x68, 0xac, 0xe1, 0x86, 0x5b, 0x2d, 0xc3, 0xc3, 0x5e,
+  0x06, 0x10, 0xbd, 0x01, 0x0c, 0xe5, 0xea, 0x7c, 0xc4, 0xc3, 0xe8, 0xdb,
+  0x53, 0xcd, 0x1c, 0xde, 0x0f, 0x30, 0x3a, 0xfc, 0xcc, 0xeb, 0xe8, 0xb0,
+  0x11, 0xf7, 0x1c, 0xdb, 0x49, 0x25, 0x60, 0xcf, 0x9b, 0x23, 0xfe, 0xa1,
+  0xd8, 0xa0, 0x7e, 0x03, 0x6f, 0xb3, 0x30, 0x35, 0x68, 0xc9, 0x42, 0x34,
+  0x72, 0xfc, 0x03, 0xab, 0xf7, 0x6c, 0xbd, 0x39, 0xea, 0xac, 0xc5, 0xbd,
+  0xe6, 0xd1, 0xe1, 0x61, 0xcf, 0xde, 0xea, 0xe9, 0xe0, 0x1a, 0xba, 0xf2,
+  0xe8, 0x34, 0x7a, 0x53, 0xce, 0xf7, 0xdc, 0xb9, 0xc6, 0x1b, 0xed, 0x1b,
+  0xf1, 0x8a, 0xf9, 0xa3, 0xf7, 0x3d, 0x2c, 0xe0, 0xca, 0x76, 0x37, 0x9d,
+  0xdd, 0xf1, 0x74, 0xd4, 0xcd, 0x0e, 0x62, 0x5a, 0x98, 0x70, 0x32, 0xf6,
+  0x42, 0x1a, 0xac, 0xa8, 0x83, 0xa5, 0xe1, 0x4a, 0x9e, 0xb6, 0x88, 0xac,
+  0xf1, 0x85, 0xef, 0xf9, 0xdb, 0x6f, 0xca, 0x78, 0x02, 0xf6, 0x9b, 0x10,
+  0xa7, 0xac, 0x20, 0x8a, 0xdd, 0x25, 0xca, 0xe2, 0xa2, 0xa0, 0x5e, 0xa3,
+  0x4c, 0x76, 0x01, 0x45, 0xc2, 0xe4, 0xef, 0x6a, 0xfa, 0x57, 0x21, 0x64,
+  0xb2, 0xca, 0x05, 0xda, 0x84, 0xcb, 0xc2, 0xdc, 0xac, 0xd5, 0x61, 0x70,
+  0x9d, 0xfb, 0xea, 0x8d, 0x57, 0x6f, 0x5e, 0xb5, 0xbe, 0xd2, 0xf5, 0xf6,
+  0xb1, 0x54, 0x67, 0xbf, 0x75, 0xf4, 0x62, 0xc1, 0x97, 0xec, 0x47, 0x06,
+  0x87, 0xfe, 0x8a, 0x59, 0xb8, 0x92, 0x73, 0xc4, 0x97, 0x6b, 0x9c, 0x87,
+  0xf1, 0x22, 0x46, 0xa6, 0x09, 0xf7, 0xf9, 0xf6, 0x78, 0xcf, 0xf7, 0x56,
+  0xb1, 0x3f, 0xdf, 0xd8, 0xa1, 0x7f, 0xe3, 0x46, 0x7f, 0x03, 0x8c, 0x69,
+  0x58, 0x76
+};
 #endif // TOUCH_UI_UTF8_SCANDINAVIAN
 
 #if ENABLED(TOUCH_UI_UTF8_PUNCTUATION)
-  /* 17 LEFT_DBL_QUOTE */
-  0xFF, 0x00, 0x4A, 0x00, 0x01, 0x30, 0x03, 0x00, 0x01, 0x02, 0x0D, 0x00,
-  0x01, 0x08, 0x01, 0xA0, 0x02, 0x00, 0x01, 0x01, 0x01, 0xC6, 0x0D, 0x00,
-  0x01, 0xAF, 0x01, 0xA0, 0x02, 0x00, 0x01, 0x1D, 0x01, 0xF6, 0x0C, 0x00,
-  0x01, 0x1C, 0x01, 0xFF, 0x01, 0xA0, 0x01, 0x00, 0x01, 0x02, 0x01, 0xEF,
-  0x01, 0xF6, 0x0B, 0x00, 0x01, 0x01, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x50,
-  0x01, 0x00, 0x01, 0x3E, 0x01, 0xFF, 0x01, 0xE2, 0x0B, 0x00, 0x01, 0x2E,
-  0x01, 0xFF, 0x01, 0xF4, 0x01, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xFD,
-  0x01, 0x20, 0x0A, 0x00, 0x01, 0x04, 0x01, 0xEF, 0x01, 0xFE, 0x01, 0x30,
-  0x01, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0xD1, 0x0B, 0x00, 0x01, 0x5F,
-  0x01, 0xFF, 0x01, 0xD2, 0x01, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xFB,
-  0x0B, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xFC, 0x01, 0x10, 0x01, 0x00,
-  0x01, 0xAF, 0x01, 0xFF, 0x01, 0xA0, 0x0B, 0x00, 0x01, 0x0C, 0x01, 0xFF,
-  0x01, 0xD0, 0x02, 0x00, 0x01, 0xFF, 0x01, 0xFA, 0x0C, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xF8, 0x02, 0x00, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0x50,
-  0x0C, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0xA0, 0x01, 0x00, 0x01, 0x1C,
-  0x01, 0xFF, 0x01, 0xF6, 0x0C, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xFB,
-  0x02, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x90, 0x0C, 0x00, 0x01, 0x6F,
-  0x01, 0xFF, 0x01, 0xD1, 0x01, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xFA,
-  0x0C, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0x20, 0x01, 0x00,
-  0x01, 0x8F, 0x01, 0xFF, 0x01, 0xB0, 0x0C, 0x00, 0x01, 0x4F, 0x01, 0xFF,
-  0x01, 0xA0, 0x01, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF6, 0x0C, 0x00,
-  0x01, 0x02, 0x01, 0xEF, 0x01, 0xA0, 0x02, 0x00, 0x01, 0x5F, 0x01, 0xF6,
-  0x0D, 0x00, 0x01, 0x1D, 0x01, 0xA0, 0x02, 0x00, 0x01, 0x04, 0x01, 0xE6,
-  0x0D, 0x00, 0x01, 0x01, 0x01, 0x60, 0x03, 0x00, 0x01, 0x24, 0xFF, 0x00,
-
-  /* 18 RIGHT_DBL_QUOTE */
-  0xFF, 0x00, 0x46, 0x00, 0x01, 0x20, 0x03, 0x00, 0x01, 0x20, 0x0D, 0x00,
-  0x01, 0x01, 0x01, 0xE3, 0x03, 0x00, 0x01, 0x5D, 0x01, 0x10, 0x0C, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0x50, 0x02, 0x00, 0x01, 0x5F, 0x01, 0xE2,
-  0x0C, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF6, 0x02, 0x00, 0x01, 0x5F,
-  0x01, 0xFE, 0x01, 0x30, 0x0C, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x80,
-  0x01, 0x00, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0xF5, 0x0C, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xFA, 0x01, 0x00, 0x01, 0x01, 0x01, 0xCF, 0x01, 0xFF,
-  0x01, 0x60, 0x0C, 0x00, 0x01, 0x8F, 0x01, 0xFF, 0x01, 0xB0, 0x01, 0x00,
-  0x01, 0x0B, 0x01, 0xFF, 0x01, 0xF9, 0x0C, 0x00, 0x01, 0x06, 0x01, 0xFF,
-  0x01, 0xFC, 0x01, 0x10, 0x01, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0xA0,
-  0x0C, 0x00, 0x01, 0x5F, 0x01, 0xFF, 0x01, 0xD1, 0x01, 0x00, 0x01, 0x08,
-  0x01, 0xFF, 0x01, 0xFB, 0x0C, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xF5,
-  0x02, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0x10, 0x0B, 0x00, 0x01, 0x2D,
-  0x01, 0xFF, 0x01, 0xF3, 0x01, 0x00, 0x01, 0x04, 0x01, 0xFF, 0x01, 0xFE,
-  0x01, 0x10, 0x0A, 0x00, 0x01, 0x03, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0x40,
-  0x01, 0x00, 0x01, 0x5F, 0x01, 0xFF, 0x01, 0xD2, 0x0B, 0x00, 0x01, 0x4F,
-  0x01, 0xFF, 0x01, 0xE3, 0x01, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xFC,
-  0x01, 0x10, 0x0A, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0x10,
-  0x01, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0xB0, 0x0B, 0x00, 0x01, 0x6F,
-  0x01, 0xFF, 0x01, 0xC1, 0x01, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF9,
-  0x0B, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xFA, 0x02, 0x00, 0x01, 0x5F,
-  0x01, 0xFF, 0x01, 0x70, 0x0B, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x90,
-  0x02, 0x00, 0x01, 0x5F, 0x01, 0xF6, 0x0C, 0x00, 0x01, 0x01, 0x01, 0xF8,
-  0x03, 0x00, 0x01, 0x5F, 0x01, 0x40, 0x0C, 0x00, 0x01, 0x01, 0x01, 0x50,
-  0x03, 0x00, 0x01, 0x43, 0xFF, 0x00, 0x04, 0x00,
-
-  /* 19 INV_EXCLAMATION */
-  0xFF, 0x00, 0x34, 0x00, 0x01, 0xAD, 0x01, 0xDD, 0x01, 0x40, 0x10, 0x00,
-  0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF,
-  0x01, 0x50, 0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x10, 0x00,
-  0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0x34, 0x01, 0x44,
-  0x01, 0x10, 0x49, 0x00, 0x01, 0x02, 0x01, 0x22, 0x11, 0x00, 0x01, 0x6F,
-  0x01, 0xFF, 0x11, 0x00, 0x01, 0x7F, 0x01, 0xFF, 0x11, 0x00, 0x01, 0x7F,
-  0x01, 0xFF, 0x01, 0x10, 0x10, 0x00, 0x01, 0x8F, 0x01, 0xFF, 0x01, 0x20,
-  0x10, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0x30, 0x10, 0x00, 0x01, 0xAF,
-  0x01, 0xFF, 0x01, 0x30, 0x10, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x40,
-  0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF,
-  0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50,
-  0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF,
-  0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50,
-  0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF,
-  0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50,
-  0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF,
-  0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50,
-  0x10, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0x34,
-  0x01, 0x44, 0x01, 0x10, 0x33, 0x00,
-
-  /* 20 INV_QUESTION */
-  0xFF, 0x00, 0x36, 0x00, 0x02, 0xDD, 0x11, 0x00, 0x02, 0xFF, 0x11, 0x00,
-  0x02, 0xFF, 0x11, 0x00, 0x02, 0xFF, 0x11, 0x00, 0x02, 0xFF, 0x11, 0x00,
-  0x02, 0x44, 0x37, 0x00, 0x01, 0xBC, 0x01, 0xCB, 0x11, 0x00, 0x01, 0xEF,
-  0x01, 0xFE, 0x11, 0x00, 0x01, 0xEF, 0x01, 0xFE, 0x11, 0x00, 0x01, 0xEF,
-  0x01, 0xFE, 0x11, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x10, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xFB, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xF6,
-  0x10, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0xD0, 0x0F, 0x00, 0x01, 0x0A,
-  0x02, 0xFF, 0x01, 0x30, 0x0F, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0xF4,
-  0x0F, 0x00, 0x01, 0x09, 0x02, 0xFF, 0x01, 0x40, 0x0F, 0x00, 0x01, 0x7F,
-  0x01, 0xFF, 0x01, 0xF4, 0x0F, 0x00, 0x01, 0x03, 0x02, 0xFF, 0x01, 0x40,
-  0x0F, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF8, 0x10, 0x00, 0x01, 0x0F,
-  0x01, 0xFF, 0x01, 0xF2, 0x10, 0x00, 0x01, 0x1F, 0x01, 0xFF, 0x01, 0xF0,
-  0x10, 0x00, 0x01, 0x0F, 0x01, 0xFF, 0x01, 0xF2, 0x10, 0x00, 0x01, 0x0E,
-  0x01, 0xFF, 0x01, 0xF8, 0x04, 0x00, 0x01, 0x05, 0x01, 0xD0, 0x0A, 0x00,
-  0x01, 0x08, 0x02, 0xFF, 0x01, 0x70, 0x02, 0x00, 0x01, 0x05, 0x01, 0xCF,
-  0x01, 0xF0, 0x0A, 0x00, 0x01, 0x01, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xFE,
-  0x01, 0x98, 0x01, 0x8B, 0x02, 0xFF, 0x01, 0xF0, 0x0B, 0x00, 0x01, 0x3F,
-  0x06, 0xFF, 0x01, 0xC0, 0x0B, 0x00, 0x01, 0x02, 0x01, 0xCF, 0x04, 0xFF,
-  0x01, 0xC5, 0x0D, 0x00, 0x01, 0x03, 0x01, 0x8B, 0x01, 0xCC, 0x01, 0xB9,
-  0x01, 0x62, 0x31, 0x00,
+constexpr uint32_t font_punctuation_size = 3920; // Inflated size
+
+const unsigned char font_punctuation[] PROGMEM = {
+  0x78, 0xda, 0xed, 0x97, 0xbd, 0x4e, 0x02, 0x41, 0x14, 0x85, 0xef, 0xf2,
+  0xa3, 0x88, 0x46, 0xf7, 0x01, 0x20, 0x12, 0x63, 0xab, 0xa1, 0xb0, 0x56,
+  0x12, 0xe9, 0xf5, 0x05, 0x0c, 0xc4, 0x17, 0xc0, 0x37, 0xc0, 0x9e, 0x02,
+  0x4a, 0x3b, 0x78, 0x01, 0x03, 0xad, 0x89, 0x09, 0x5a, 0x68, 0xa3, 0x09,
+  0x68, 0x4f, 0x4c, 0x20, 0xb1, 0x5d, 0xe3, 0x0f, 0x01, 0x94, 0x3d, 0xde,
+  0x5d, 0x2c, 0xf6, 0xce, 0x90, 0xa8, 0x08, 0x85, 0xc9, 0x9e, 0x64, 0xb6,
+  0xf8, 0x32, 0x7b, 0xe7, 0xcc, 0xee, 0x9c, 0xd9, 0x1d, 0x22, 0x5f, 0xb3,
+  0x51, 0x92, 0x5b, 0x40, 0xa2, 0x48, 0x85, 0xc8, 0xb8, 0x96, 0xac, 0xca,
+  0x2c, 0xde, 0x15, 0x28, 0x86, 0x0a, 0x05, 0x2c, 0xc1, 0x8c, 0x07, 0xec,
+  0xd3, 0x36, 0xda, 0x5e, 0xb6, 0x89, 0x57, 0x0a, 0x63, 0x98, 0xf0, 0xa0,
+  0x90, 0x65, 0x27, 0x29, 0x87, 0x3b, 0x6f, 0xb7, 0x0c, 0xee, 0x29, 0x82,
+  0x77, 0x2f, 0x9a, 0xc3, 0x87, 0x49, 0x55, 0x1e, 0xc5, 0xa3, 0x25, 0x34,
+  0x89, 0x30, 0x10, 0x46, 0xa2, 0xe8, 0x11, 0x59, 0x3c, 0xb2, 0x30, 0xcc,
+  0xf7, 0xc5, 0x20, 0x1d, 0xbb, 0xf5, 0xeb, 0x28, 0x09, 0xe8, 0xf8, 0x88,
+  0x2a, 0x15, 0x5d, 0xbf, 0x45, 0xd4, 0x04, 0xdc, 0xe3, 0x8a, 0xf3, 0x4a,
+  0xc5, 0x80, 0xc5, 0xee, 0x32, 0x92, 0x51, 0x9c, 0x59, 0xe8, 0x51, 0x32,
+  0x23, 0xcb, 0x97, 0x75, 0x7f, 0xb9, 0xf9, 0x9a, 0xb1, 0x12, 0x5f, 0xcd,
+  0xbb, 0xf6, 0x3a, 0x7c, 0x39, 0x30, 0x25, 0x73, 0xe2, 0x92, 0x69, 0x2b,
+  0x8c, 0x17, 0x72, 0xc6, 0x4e, 0x0a, 0x58, 0xc7, 0x31, 0x47, 0xf8, 0x4d,
+  0x09, 0xdc, 0x80, 0x8c, 0x06, 0xb2, 0x02, 0x3a, 0x71, 0x59, 0x44, 0x9f,
+  0xbe, 0x4b, 0x30, 0x27, 0xfd, 0x4e, 0x4d, 0x3a, 0x07, 0x8e, 0x47, 0x28,
+  0x43, 0x78, 0xdc, 0xc0, 0x0b, 0x85, 0x60, 0x7b, 0x59, 0xd0, 0x42, 0xca,
+  0xdd, 0x29, 0x44, 0x2c, 0x3b, 0xa3, 0x71, 0x44, 0x7c, 0x4d, 0xae, 0x56,
+  0x93, 0x31, 0xbf, 0x64, 0xdf, 0x7d, 0x39, 0xdf, 0x81, 0xe3, 0xe6, 0x48,
+  0xb2, 0x92, 0x16, 0x68, 0xa3, 0xe7, 0xb8, 0x4e, 0x49, 0xe6, 0xec, 0x36,
+  0xbb, 0xfe, 0x72, 0xf3, 0x35, 0x6d, 0x9d, 0xb6, 0x52, 0x1a, 0x6b, 0x28,
+  0x1f, 0xb7, 0xbf, 0xb2, 0xad, 0xb4, 0x39, 0x55, 0xcf, 0x81, 0x35, 0x9d,
+  0xe5, 0xa0, 0xb3, 0xfc, 0x58, 0xa6, 0x7b, 0x29, 0x22, 0xa1, 0xb1, 0x32,
+  0x92, 0x1a, 0xab, 0x8e, 0x61, 0x75, 0xcc, 0xfe, 0xf9, 0xfd, 0x47, 0x36,
+  0xed, 0x77, 0xee, 0xeb, 0x37, 0x6a, 0xb5, 0x74, 0x06, 0x4c, 0x97, 0xa5,
+  0xd3, 0x93, 0xfb, 0x3b, 0xbf, 0xd1, 0x99, 0x65, 0x4f, 0xce, 0x30, 0xd4,
+  0x50, 0x50, 0xf9, 0xe6, 0x8f, 0x7e, 0xe7, 0xbb, 0x63, 0x42, 0xdd, 0x54,
+  0x51, 0x14, 0x7a, 0xd0, 0xab, 0x7c, 0xae, 0x50, 0xb4, 0x00, 0x3d, 0xfb,
+  0x79, 0xbd, 0x5b, 0x70, 0x4c, 0x37, 0xf7, 0x0c, 0xa1, 0x68, 0x05, 0xcf,
+  0x1a, 0x5b, 0xc5, 0xd3, 0x8f, 0xfa, 0x2d, 0x8f, 0xea, 0x85, 0x9b, 0xe2,
+  0xf8, 0xe1, 0xfc, 0x6b, 0x84, 0x1b, 0xde, 0x0a, 0x86, 0x05, 0xfb, 0xa4,
+  0x00, 0x59, 0x75, 0x07, 0xae, 0x2e, 0xc4, 0x16, 0xdb, 0x70, 0xd0, 0x95,
+  0x32, 0x93, 0xc2, 0xed, 0xd9, 0xe1, 0x24, 0xaf, 0xfb, 0x13, 0x84, 0xbd,
+  0xfc, 0x34
+};
 #endif // TOUCH_UI_UTF8_PUNCTUATION
 
 #if ENABLED(TOUCH_UI_UTF8_CURRENCY)
-  /* 21 CENT_SIGN */
-  0xB1, 0x00, 0x01, 0x01, 0x01, 0x32, 0x11, 0x00, 0x01, 0x05, 0x01, 0xFB,
-  0x11, 0x00, 0x01, 0x05, 0x01, 0xFB, 0x11, 0x00, 0x01, 0x05, 0x01, 0xFB,
-  0x11, 0x00, 0x01, 0x05, 0x01, 0xFC, 0x11, 0x00, 0x01, 0x05, 0x01, 0xFC,
-  0x11, 0x00, 0x01, 0x39, 0x01, 0xFD, 0x01, 0x42, 0x0E, 0x00, 0x01, 0x05,
-  0x01, 0xBF, 0x03, 0xFF, 0x01, 0xFB, 0x01, 0x50, 0x0B, 0x00, 0x01, 0x03,
-  0x01, 0xCF, 0x05, 0xFF, 0x01, 0xF6, 0x0B, 0x00, 0x01, 0x4F, 0x02, 0xFF,
-  0x02, 0xFE, 0x01, 0xCE, 0x01, 0xFF, 0x01, 0xF6, 0x0A, 0x00, 0x01, 0x02,
-  0x02, 0xFF, 0x01, 0xE6, 0x01, 0x05, 0x01, 0xFC, 0x01, 0x00, 0x01, 0x38,
-  0x01, 0xE6, 0x0A, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0x10,
-  0x01, 0x05, 0x01, 0xFC, 0x02, 0x00, 0x01, 0x02, 0x0A, 0x00, 0x01, 0x5F,
-  0x01, 0xFF, 0x01, 0xE1, 0x01, 0x00, 0x01, 0x05, 0x01, 0xFC, 0x0D, 0x00,
-  0x01, 0xCF, 0x01, 0xFF, 0x01, 0x60, 0x01, 0x00, 0x01, 0x05, 0x01, 0xFC,
-  0x0D, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x01, 0x05, 0x01, 0xFC, 0x0C, 0x00,
-  0x01, 0x04, 0x01, 0xFF, 0x01, 0xFB, 0x02, 0x00, 0x01, 0x05, 0x01, 0xFC,
-  0x0C, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF8, 0x02, 0x00, 0x01, 0x05,
-  0x01, 0xFC, 0x0C, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF7, 0x02, 0x00,
-  0x01, 0x05, 0x01, 0xFB, 0x0C, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xF6,
-  0x02, 0x00, 0x01, 0x05, 0x01, 0xFC, 0x0C, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF7, 0x02, 0x00, 0x01, 0x05, 0x01, 0xFB, 0x0C, 0x00, 0x01, 0x06,
-  0x01, 0xFF, 0x01, 0xF9, 0x02, 0x00, 0x01, 0x05, 0x01, 0xFB, 0x0C, 0x00,
-  0x01, 0x03, 0x01, 0xFF, 0x01, 0xFC, 0x02, 0x00, 0x01, 0x05, 0x01, 0xFB,
-  0x0D, 0x00, 0x02, 0xFF, 0x01, 0x10, 0x01, 0x00, 0x01, 0x05, 0x01, 0xFB,
-  0x0D, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0x80, 0x01, 0x00, 0x01, 0x05,
-  0x01, 0xFB, 0x0D, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xF3, 0x01, 0x00,
-  0x01, 0x05, 0x01, 0xFB, 0x0D, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0xFE,
-  0x01, 0x30, 0x01, 0x05, 0x01, 0xFB, 0x02, 0x00, 0x01, 0x33, 0x0A, 0x00,
-  0x01, 0x01, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xF9, 0x01, 0x35, 0x01, 0xFB,
-  0x01, 0x02, 0x01, 0x6C, 0x01, 0xF6, 0x0B, 0x00, 0x01, 0x2D, 0x06, 0xFF,
-  0x01, 0xF6, 0x0B, 0x00, 0x01, 0x01, 0x01, 0x9F, 0x05, 0xFF, 0x01, 0xF5,
-  0x0C, 0x00, 0x01, 0x02, 0x01, 0x8D, 0x03, 0xFF, 0x01, 0xC7, 0x01, 0x20,
-  0x0E, 0x00, 0x01, 0x06, 0x01, 0xFC, 0x01, 0x20, 0x10, 0x00, 0x01, 0x05,
-  0x01, 0xFB, 0x11, 0x00, 0x01, 0x05, 0x01, 0xFB, 0x11, 0x00, 0x01, 0x05,
-  0x01, 0xFB, 0x11, 0x00, 0x01, 0x05, 0x01, 0xFB, 0x11, 0x00, 0x01, 0x05,
-  0x01, 0xFB, 0x57, 0x00,
-
-  /* 22 POUND_SIGN */
-  0x9E, 0x00, 0x01, 0x6B, 0x01, 0xDF, 0x01, 0xFD, 0x01, 0xC9, 0x01, 0x40,
-  0x0D, 0x00, 0x01, 0x6E, 0x05, 0xFF, 0x01, 0x30, 0x0B, 0x00, 0x01, 0x07,
-  0x06, 0xFF, 0x01, 0x30, 0x0B, 0x00, 0x01, 0x3F, 0x01, 0xFF, 0x01, 0xFE,
-  0x01, 0x85, 0x01, 0x34, 0x01, 0x7B, 0x01, 0xFF, 0x01, 0x30, 0x0B, 0x00,
-  0x01, 0xAF, 0x01, 0xFF, 0x01, 0xC1, 0x03, 0x00, 0x01, 0x18, 0x01, 0x30,
-  0x0A, 0x00, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x30, 0x0F, 0x00, 0x01, 0x04,
-  0x01, 0xFF, 0x01, 0xFD, 0x10, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xFA,
-  0x10, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xF8, 0x10, 0x00, 0x01, 0x09,
-  0x01, 0xFF, 0x01, 0xF7, 0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6,
-  0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6, 0x10, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xF6, 0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6,
-  0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6, 0x0E, 0x00, 0x01, 0x0A,
-  0x07, 0xFF, 0x01, 0xF4, 0x0A, 0x00, 0x01, 0x0A, 0x07, 0xFF, 0x01, 0xF4,
-  0x0A, 0x00, 0x01, 0x08, 0x01, 0xDD, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xFE,
-  0x03, 0xDD, 0x01, 0xD4, 0x0C, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6,
-  0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6, 0x10, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xF6, 0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6,
-  0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6, 0x10, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xF6, 0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6,
-  0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF6, 0x10, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xF6, 0x0E, 0x00, 0x01, 0x4B, 0x01, 0xBB, 0x01, 0xBE,
-  0x01, 0xFF, 0x01, 0xFD, 0x05, 0xBB, 0x01, 0x70, 0x08, 0x00, 0x01, 0x6F,
-  0x09, 0xFF, 0x01, 0xA0, 0x08, 0x00, 0x01, 0x6F, 0x09, 0xFF, 0x01, 0xA0,
-  0x08, 0x00, 0x01, 0x4A, 0x09, 0xAA, 0x01, 0x60, 0xC5, 0x00,
-
-  /* 23 CURRENCY_SIGN */
-  0xFF, 0x00, 0x0D, 0x00, 0x01, 0x30, 0x07, 0x00, 0x01, 0x01, 0x01, 0x40,
-  0x08, 0x00, 0x01, 0x0B, 0x01, 0xF5, 0x07, 0x00, 0x01, 0x1D, 0x01, 0xF4,
-  0x08, 0x00, 0x01, 0xBF, 0x01, 0xFF, 0x01, 0x40, 0x05, 0x00, 0x01, 0x01,
-  0x01, 0xDF, 0x01, 0xFF, 0x01, 0x30, 0x07, 0x00, 0x01, 0x5F, 0x01, 0xFF,
-  0x01, 0xF4, 0x01, 0x00, 0x01, 0x6B, 0x01, 0xDD, 0x01, 0xC8, 0x01, 0x20,
-  0x01, 0x1D, 0x01, 0xFF, 0x01, 0xFA, 0x08, 0x00, 0x01, 0x05, 0x02, 0xFF,
-  0x01, 0x8E, 0x03, 0xFF, 0x01, 0xFA, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xA0,
-  0x09, 0x00, 0x01, 0x5F, 0x07, 0xFF, 0x01, 0xFA, 0x0A, 0x00, 0x01, 0x05,
-  0x02, 0xFF, 0x01, 0xE9, 0x01, 0x55, 0x01, 0x7C, 0x02, 0xFF, 0x01, 0xA0,
-  0x0A, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0xFB, 0x01, 0x10, 0x02, 0x00,
-  0x01, 0x6F, 0x01, 0xFF, 0x01, 0xA0, 0x0A, 0x00, 0x01, 0x0B, 0x01, 0xFF,
-  0x01, 0xC0, 0x03, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF2, 0x0A, 0x00,
-  0x01, 0x1F, 0x01, 0xFF, 0x01, 0x30, 0x04, 0x00, 0x01, 0xDF, 0x01, 0xF7,
-  0x0A, 0x00, 0x01, 0x4F, 0x01, 0xFD, 0x05, 0x00, 0x01, 0x8F, 0x01, 0xFA,
-  0x0A, 0x00, 0x01, 0x6F, 0x01, 0xFC, 0x05, 0x00, 0x01, 0x6F, 0x01, 0xFC,
-  0x0A, 0x00, 0x01, 0x5F, 0x01, 0xFC, 0x05, 0x00, 0x01, 0x7F, 0x01, 0xFB,
-  0x0A, 0x00, 0x01, 0x3F, 0x01, 0xFF, 0x01, 0x10, 0x04, 0x00, 0x01, 0xBF,
-  0x01, 0xF8, 0x0A, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0x80, 0x03, 0x00,
-  0x01, 0x03, 0x01, 0xFF, 0x01, 0xF3, 0x0A, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF5, 0x03, 0x00, 0x01, 0x1D, 0x01, 0xFF, 0x01, 0xC0, 0x0A, 0x00,
-  0x01, 0x01, 0x02, 0xFF, 0x01, 0x92, 0x01, 0x00, 0x01, 0x16, 0x01, 0xEF,
-  0x01, 0xFF, 0x01, 0x60, 0x0A, 0x00, 0x01, 0x1D, 0x03, 0xFF, 0x01, 0xFE,
-  0x03, 0xFF, 0x01, 0xF4, 0x09, 0x00, 0x01, 0x01, 0x01, 0xDF, 0x05, 0xFF,
-  0x01, 0xFE, 0x02, 0xFF, 0x01, 0x40, 0x08, 0x00, 0x01, 0x1D, 0x01, 0xFF,
-  0x01, 0xFA, 0x01, 0x06, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0x81,
-  0x01, 0x5F, 0x01, 0xFF, 0x01, 0xF4, 0x08, 0x00, 0x01, 0xCF, 0x01, 0xFF,
-  0x01, 0xA0, 0x01, 0x00, 0x01, 0x01, 0x01, 0x44, 0x01, 0x20, 0x01, 0x00,
-  0x01, 0x05, 0x02, 0xFF, 0x01, 0x20, 0x07, 0x00, 0x01, 0x4F, 0x01, 0xFA,
-  0x07, 0x00, 0x01, 0x4F, 0x01, 0xF8, 0x08, 0x00, 0x01, 0x05, 0x01, 0xA0,
-  0x07, 0x00, 0x01, 0x05, 0x01, 0x80, 0xEB, 0x00,
-
-  /* 24 YEN_SIGN */
-  0x98, 0x00, 0x01, 0x01, 0x01, 0x88, 0x01, 0x85, 0x07, 0x00, 0x01, 0x38,
-  0x01, 0x88, 0x01, 0x40, 0x07, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x10,
-  0x06, 0x00, 0x01, 0xCF, 0x01, 0xFF, 0x01, 0x10, 0x07, 0x00, 0x01, 0x3F,
-  0x01, 0xFF, 0x01, 0x90, 0x05, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xF8,
-  0x08, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0xF2, 0x05, 0x00, 0x01, 0x0D,
-  0x01, 0xFF, 0x01, 0xE0, 0x08, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xFA,
-  0x05, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0x60, 0x09, 0x00, 0x01, 0xAF,
-  0x01, 0xFF, 0x01, 0x30, 0x04, 0x00, 0x01, 0xEF, 0x01, 0xFD, 0x0A, 0x00,
-  0x01, 0x1F, 0x01, 0xFF, 0x01, 0xC0, 0x03, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF5, 0x0A, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xF4, 0x03, 0x00,
-  0x01, 0x1F, 0x01, 0xFF, 0x01, 0xC0, 0x0A, 0x00, 0x01, 0x01, 0x01, 0xEF,
-  0x01, 0xFD, 0x03, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0x40, 0x0B, 0x00,
-  0x01, 0x7F, 0x01, 0xFF, 0x01, 0x50, 0x01, 0x00, 0x01, 0x02, 0x01, 0xFF,
-  0x01, 0xFB, 0x0C, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xE0, 0x01, 0x00,
-  0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF3, 0x0C, 0x00, 0x01, 0x06, 0x01, 0xFF,
-  0x01, 0xF7, 0x01, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0xA0, 0x0A, 0x00,
-  0x01, 0x2A, 0x02, 0xAA, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0x10, 0x01, 0xBF,
-  0x01, 0xFF, 0x01, 0xCA, 0x01, 0xAA, 0x01, 0xA5, 0x08, 0x00, 0x01, 0x4F,
-  0x04, 0xFF, 0x01, 0x83, 0x04, 0xFF, 0x01, 0xF8, 0x08, 0x00, 0x01, 0x3C,
-  0x02, 0xCC, 0x01, 0xCE, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0xFF, 0x01, 0xFC,
-  0x02, 0xCC, 0x01, 0xC6, 0x0B, 0x00, 0x01, 0x03, 0x03, 0xFF, 0x01, 0x70,
-  0x0F, 0x00, 0x01, 0xAF, 0x01, 0xFF, 0x01, 0xFE, 0x10, 0x00, 0x01, 0x2F,
-  0x01, 0xFF, 0x01, 0xF5, 0x0C, 0x00, 0x01, 0x01, 0x03, 0x11, 0x01, 0x1E,
-  0x01, 0xFF, 0x01, 0xF3, 0x03, 0x11, 0x01, 0x10, 0x08, 0x00, 0x01, 0x4F,
-  0x09, 0xFF, 0x01, 0xF8, 0x08, 0x00, 0x01, 0x4F, 0x09, 0xFF, 0x01, 0xF8,
-  0x08, 0x00, 0x01, 0x27, 0x03, 0x77, 0x01, 0x7E, 0x01, 0xFF, 0x01, 0xF8,
-  0x03, 0x77, 0x01, 0x73, 0x0C, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF2,
-  0x10, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF2, 0x10, 0x00, 0x01, 0x0E,
-  0x01, 0xFF, 0x01, 0xF2, 0x10, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF2,
-  0x10, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF2, 0x10, 0x00, 0x01, 0x0E,
-  0x01, 0xFF, 0x01, 0xF2, 0x10, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF2,
-  0x10, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xF2, 0x10, 0x00, 0x01, 0x08,
-  0x01, 0x99, 0x01, 0x91, 0xC9, 0x00,
+constexpr uint32_t font_currency_size = 3920; // Inflated size
+
+const unsigned char font_currency[] PROGMEM = {
+  0x78, 0xda, 0xed, 0x96, 0xbf, 0x6f, 0xd3, 0x50, 0x10, 0xc7, 0xe3, 0x94,
+  0xa4, 0x21, 0x85, 0xca, 0x59, 0x50, 0x97, 0x40, 0x36, 0x24, 0x24, 0xd4,
+  0x8a, 0x1f, 0x52, 0x91, 0x90, 0x88, 0x10, 0x53, 0x19, 0xdc, 0x85, 0x39,
+  0xd9, 0x8b, 0x68, 0x25, 0x86, 0x0c, 0x20, 0x5a, 0x84, 0x2a, 0x75, 0xa1,
+  0xfc, 0xd8, 0x98, 0xda, 0x85, 0x25, 0x4b, 0xfe, 0x80, 0x4a, 0xa4, 0x2c,
+  0x2d, 0xa0, 0xa8, 0x59, 0x58, 0x2d, 0xc3, 0x52, 0x89, 0x29, 0x52, 0x53,
+  0x68, 0x1a, 0xff, 0xf8, 0xf2, 0x9e, 0x1d, 0xc7, 0x77, 0x7e, 0x08, 0x22,
+  0x51, 0x50, 0xa1, 0xbd, 0xe1, 0xc5, 0xf9, 0xf8, 0xd9, 0xef, 0xde, 0xf9,
+  0xee, 0xfb, 0x2e, 0x91, 0xf8, 0x57, 0x4d, 0xbb, 0xa4, 0xb2, 0x94, 0xfd,
+  0x1b, 0xcc, 0x19, 0x8c, 0x5d, 0x73, 0x6f, 0xc6, 0x67, 0xd5, 0x01, 0xd8,
+  0xd3, 0x14, 0x0d, 0x35, 0x21, 0xed, 0x1b, 0x65, 0x06, 0xe0, 0x79, 0x5b,
+  0x8c, 0x25, 0x81, 0x6d, 0xb1, 0xc6, 0xe4, 0x36, 0x61, 0xa7, 0xe0, 0xea,
+  0x72, 0xdd, 0x24, 0x61, 0x25, 0x7c, 0x56, 0x7c, 0x69, 0xa2, 0xac, 0x30,
+  0x40, 0xf1, 0xf9, 0x04, 0x6c, 0x85, 0xa5, 0xd1, 0x51, 0xd8, 0x30, 0xf6,
+  0x94, 0xb8, 0x64, 0xa4, 0xb3, 0x03, 0xcc, 0x4b, 0x63, 0x5f, 0x61, 0x43,
+  0x70, 0xd4, 0x38, 0x03, 0xba, 0xc2, 0x6a, 0x58, 0x50, 0x98, 0x81, 0xb6,
+  0xc2, 0x46, 0xe0, 0x4d, 0x48, 0x76, 0x99, 0xe6, 0x40, 0x0b, 0xfb, 0x57,
+  0xed, 0xe4, 0x5d, 0x16, 0xe7, 0x8b, 0x50, 0x63, 0xaf, 0xad, 0xf8, 0xec,
+  0x2b, 0x7b, 0x63, 0xf2, 0xa9, 0x40, 0x9b, 0x85, 0xd8, 0xd7, 0x4c, 0x3b,
+  0x85, 0x83, 0xcd, 0xab, 0x01, 0xd9, 0x51, 0xb3, 0x19, 0xcb, 0x7d, 0x5f,
+  0xe4, 0xe8, 0x9e, 0xff, 0x91, 0x26, 0x78, 0xba, 0xa9, 0xec, 0x06, 0xbc,
+  0xc5, 0x2b, 0x0f, 0x38, 0xab, 0xe1, 0xad, 0x18, 0xc7, 0x28, 0xd3, 0x62,
+  0x8f, 0x05, 0xd5, 0xe0, 0x2a, 0x8e, 0x0c, 0xa3, 0xab, 0xb0, 0x8c, 0xac,
+  0x90, 0x98, 0x9d, 0x94, 0x99, 0x1f, 0xb3, 0x2c, 0x4f, 0xb3, 0x3f, 0xc0,
+  0xb2, 0x41, 0x00, 0xb0, 0xfb, 0x0b, 0x96, 0x31, 0x2d, 0x78, 0xa6, 0x69,
+  0x7e, 0xfc, 0xcb, 0xfe, 0x1d, 0x34, 0xbb, 0xbd, 0xf6, 0x06, 0xee, 0x9a,
+  0xb4, 0xb9, 0x3e, 0x9b, 0x45, 0x68, 0xab, 0x3f, 0x65, 0x53, 0xd5, 0xd0,
+  0xca, 0xc7, 0xf5, 0x75, 0x54, 0x2c, 0xac, 0x71, 0x2d, 0x12, 0x93, 0x91,
+  0x50, 0xe7, 0xf3, 0x51, 0x85, 0xd4, 0x11, 0xdc, 0xd7, 0xac, 0x48, 0x15,
+  0x4a, 0xa2, 0x82, 0x66, 0xcc, 0x77, 0x85, 0x3c, 0x51, 0x80, 0x14, 0xb0,
+  0x2c, 0x92, 0xaa, 0x6b, 0x91, 0xbc, 0x12, 0x13, 0x03, 0xa3, 0x42, 0x21,
+  0x26, 0x7e, 0xb9, 0xf3, 0x90, 0xa6, 0x9f, 0x3c, 0xf4, 0x6c, 0x5d, 0xa6,
+  0xe6, 0x2a, 0x3b, 0xb7, 0xd6, 0x7d, 0x91, 0xd9, 0x21, 0xec, 0x5c, 0xe0,
+  0x83, 0x45, 0x05, 0xc5, 0x08, 0x94, 0xe9, 0x19, 0x5d, 0x63, 0xd6, 0xa1,
+  0x3f, 0x3d, 0x5f, 0x82, 0x3f, 0xf3, 0x36, 0x53, 0x44, 0xdd, 0xdf, 0x23,
+  0x15, 0xad, 0x51, 0x71, 0xae, 0x4a, 0x8f, 0xda, 0x4c, 0xea, 0x64, 0x64,
+  0xf2, 0xbe, 0x47, 0x44, 0x26, 0x5f, 0x26, 0xce, 0xb4, 0x40, 0x4b, 0x26,
+  0x2f, 0xf6, 0xea, 0x71, 0x81, 0x11, 0x71, 0x43, 0x40, 0x8b, 0x64, 0x5a,
+  0x37, 0x2d, 0x54, 0xe7, 0x71, 0x89, 0x4c, 0x6c, 0x8a, 0xcd, 0x6b, 0xb7,
+  0x0a, 0x32, 0x3c, 0xfd, 0x73, 0xd4, 0x08, 0xf7, 0x64, 0x44, 0x0e, 0xa6,
+  0xc2, 0x18, 0xa5, 0x16, 0x8e, 0x73, 0xf8, 0x90, 0x76, 0xd8, 0x4b, 0x8b,
+  0xbd, 0xab, 0xc9, 0xa5, 0x62, 0xf4, 0x7d, 0xf5, 0xd8, 0x85, 0x4c, 0xbf,
+  0xe7, 0xbd, 0x92, 0xe8, 0x90, 0xb4, 0x0f, 0x12, 0xfe, 0x34, 0x3e, 0x91,
+  0x76, 0xb7, 0xdb, 0xd3, 0xee, 0x32, 0x3d, 0xb9, 0xfd, 0x5a, 0x68, 0xb9,
+  0xac, 0x3e, 0xd6, 0xfb, 0xd9, 0x1a, 0x1d, 0xc9, 0xbb, 0xfd, 0x3b, 0x51,
+  0xff, 0x27, 0x9f, 0x5a, 0x01, 0xeb, 0x23, 0xe6, 0x31, 0x2d, 0x56, 0xe2,
+  0x1d, 0xd6, 0xa8, 0xf0, 0x22, 0xcb, 0x4a, 0x41, 0x76, 0xad, 0x7b, 0x89,
+  0x71, 0x56, 0xaa, 0x17, 0xaa, 0x55, 0x78, 0x7a, 0x1d, 0x1f, 0xaa, 0xaf,
+  0x69, 0xd7, 0x0e, 0x3c, 0x91, 0x43, 0xb4, 0xb7, 0xeb, 0x8d, 0xc6, 0x16,
+  0x5c, 0x38, 0x8d, 0xc6, 0x06, 0x6f, 0x79, 0x81, 0xb9, 0x78, 0x10, 0x6b,
+  0xf0, 0x94, 0xc0, 0x8e, 0xc7, 0x1a, 0x51, 0x2d, 0x97, 0xcb, 0x9d, 0x45,
+  0x5b, 0x8c, 0x3a, 0x5f, 0x17, 0x7c, 0xdd, 0x1f, 0xb1, 0xf3, 0x95, 0x4a,
+  0xe5, 0x11, 0x3a, 0x62, 0xbc, 0x1f, 0xdb, 0xf1, 0x8e, 0xb2, 0xee, 0x61,
+  0x62, 0x99, 0x57, 0x2f, 0xfe, 0xc7, 0x9a, 0xf9, 0x0e, 0xfa, 0x0b, 0xc6,
+  0x9f
+};
 #endif // TOUCH_UI_UTF8_CURRENCY
 
 #if ENABLED(TOUCH_UI_UTF8_SUPERSCRIPTS)
-  /* 25 SUPERSCRIPT_ONE */
-  0x99, 0x00, 0x01, 0x01, 0x01, 0x36, 0x01, 0x9B, 0x01, 0xBB, 0x01, 0x20,
-  0x0E, 0x00, 0x01, 0x3F, 0x03, 0xFF, 0x01, 0x20, 0x0E, 0x00, 0x01, 0x3F,
-  0x01, 0xFE, 0x01, 0xBE, 0x01, 0xFF, 0x01, 0x20, 0x0E, 0x00, 0x01, 0x14,
-  0x01, 0x10, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20,
-  0x10, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20,
-  0x10, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20,
-  0x10, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x10, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x20, 0x0F, 0x00, 0x01, 0x11, 0x01, 0x1C, 0x01, 0xFF,
-  0x01, 0x31, 0x01, 0x11, 0x0D, 0x00, 0x01, 0x0D, 0x05, 0xFF, 0x01, 0x40,
-  0x0C, 0x00, 0x01, 0x0D, 0x05, 0xFF, 0x01, 0x40, 0x0C, 0x00, 0x01, 0x01,
-  0x05, 0x22, 0xFF, 0x00, 0xC2, 0x00,
-
-  /* 26 SUPERSCRIPT_TWO */
-  0x88, 0x00, 0x01, 0x01, 0x10, 0x00, 0x01, 0x16, 0x01, 0xAE, 0x01, 0xFF,
-  0x01, 0xFD, 0x01, 0x92, 0x0E, 0x00, 0x05, 0xFF, 0x01, 0x60, 0x0D, 0x00,
-  0x01, 0xFE, 0x01, 0x84, 0x01, 0x22, 0x01, 0x5C, 0x01, 0xFF, 0x01, 0xF3,
-  0x0D, 0x00, 0x01, 0x50, 0x03, 0x00, 0x01, 0xCF, 0x01, 0xFA, 0x11, 0x00,
-  0x01, 0x5F, 0x01, 0xFC, 0x11, 0x00, 0x01, 0x5F, 0x01, 0xFB, 0x11, 0x00,
-  0x01, 0xCF, 0x01, 0xF4, 0x10, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x6F, 0x01, 0xFE, 0x01, 0x10, 0x0F, 0x00, 0x01, 0x05,
-  0x01, 0xFF, 0x01, 0xE2, 0x10, 0x00, 0x01, 0x5F, 0x01, 0xFF, 0x01, 0x30,
-  0x0F, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xE3, 0x10, 0x00, 0x01, 0x6F,
-  0x01, 0xFE, 0x01, 0x20, 0x0F, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xD1,
-  0x10, 0x00, 0x01, 0xAF, 0x01, 0xFD, 0x01, 0x43, 0x03, 0x33, 0x0C, 0x00,
-  0x01, 0x01, 0x06, 0xFF, 0x0C, 0x00, 0x01, 0x01, 0x06, 0xFF, 0x0D, 0x00,
-  0x06, 0x22, 0xFF, 0x00, 0xC2, 0x00,
-
-  /* 27 SUPERSCRIPT_THREE */
-  0x88, 0x00, 0x01, 0x01, 0x01, 0x10, 0x0F, 0x00, 0x01, 0x39, 0x01, 0xCE,
-  0x02, 0xFF, 0x01, 0xB5, 0x0E, 0x00, 0x01, 0x7F, 0x04, 0xFF, 0x01, 0xB0,
-  0x0D, 0x00, 0x01, 0x6B, 0x01, 0x73, 0x01, 0x22, 0x01, 0x38, 0x01, 0xFF,
-  0x01, 0xF9, 0x11, 0x00, 0x01, 0x5F, 0x01, 0xFF, 0x11, 0x00, 0x01, 0x0F,
-  0x01, 0xFF, 0x11, 0x00, 0x01, 0x4F, 0x01, 0xFC, 0x10, 0x00, 0x01, 0x27,
-  0x01, 0xFF, 0x01, 0xF3, 0x0E, 0x00, 0x01, 0x0C, 0x02, 0xFF, 0x01, 0xFA,
-  0x01, 0x20, 0x0E, 0x00, 0x01, 0x0C, 0x02, 0xFF, 0x01, 0xFB, 0x01, 0x40,
-  0x0E, 0x00, 0x01, 0x01, 0x01, 0x23, 0x01, 0x49, 0x01, 0xFF, 0x01, 0xF6,
-  0x11, 0x00, 0x01, 0x3F, 0x01, 0xFF, 0x01, 0x10, 0x10, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x50, 0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0x60,
-  0x10, 0x00, 0x01, 0x1E, 0x01, 0xFF, 0x01, 0x40, 0x0C, 0x00, 0x01, 0xA4,
-  0x02, 0x00, 0x01, 0x05, 0x01, 0xDF, 0x01, 0xFD, 0x0D, 0x00, 0x02, 0xFF,
-  0x01, 0xDE, 0x02, 0xFF, 0x01, 0xE3, 0x0D, 0x00, 0x01, 0xAE, 0x03, 0xFF,
-  0x01, 0xE9, 0x01, 0x10, 0x0E, 0x00, 0x01, 0x24, 0x01, 0x55, 0x01, 0x52,
-  0xFF, 0x00, 0xC4, 0x00,
+constexpr uint32_t font_superscripts_size = 2940; // Inflated size
+
+const unsigned char font_superscripts[] PROGMEM = {
+  0x78, 0xda, 0x63, 0x60, 0x18, 0xe4, 0x80, 0xd1, 0x6c, 0xf6, 0x6e, 0x05,
+  0x34, 0x31, 0xfb, 0xff, 0xff, 0xff, 0x63, 0x88, 0xfd, 0xdb, 0x87, 0x21,
+  0x26, 0x22, 0xc0, 0x8d, 0x21, 0xc6, 0xc0, 0x30, 0x4c, 0xc4, 0x04, 0x65,
+  0xfe, 0x1b, 0x0a, 0xa2, 0x0a, 0xf1, 0xfe, 0x07, 0x01, 0x07, 0x82, 0x62,
+  0x8c, 0x4a, 0x20, 0xc0, 0x30, 0x0a, 0x46, 0x01, 0x3d, 0x72, 0x30, 0x86,
+  0x88, 0xd8, 0xba, 0xff, 0x7f, 0x27, 0xa1, 0x89, 0x81, 0x93, 0x69, 0x02,
+  0xaa, 0xd8, 0xbf, 0x16, 0xa5, 0x98, 0xff, 0x9f, 0x51, 0xc5, 0x02, 0x80,
+  0xf8, 0xfc, 0x2f, 0x4c, 0x5b, 0xe2, 0xff, 0x60, 0x11, 0xfb, 0x8d, 0x29,
+  0x76, 0xfe, 0x0b, 0x86, 0x10, 0xc7, 0xff, 0x05, 0x18, 0x62, 0xf9, 0xff,
+  0x04, 0xd0, 0x85, 0x58, 0xff, 0x3f, 0xc2, 0xb4, 0xe1, 0xbf, 0x01, 0xa6,
+  0xb2, 0xc7, 0x58, 0x4c, 0x53, 0xc0, 0xb4, 0xf4, 0x22, 0x86, 0xb2, 0xf5,
+  0x7f, 0x9d, 0x8d, 0x8d, 0x8d, 0x51, 0x03, 0x0f, 0x1c, 0x2e, 0xff, 0x09,
+  0x8a, 0x31, 0x28, 0x8d, 0xe6, 0xe9, 0x51, 0x40, 0xbf, 0x3c, 0x8d, 0x91,
+  0x3b, 0x2c, 0xcf, 0xfd, 0xff, 0xbf, 0x15, 0x4d, 0xac, 0x1e, 0x94, 0x4c,
+  0x37, 0xa0, 0x8a, 0x65, 0x17, 0x2b, 0x59, 0xfc, 0xff, 0x89, 0x25, 0xaf,
+  0xfe, 0xc7, 0x14, 0xe3, 0xc7, 0x22, 0xe6, 0x8f, 0x99, 0xcf, 0xd5, 0xd1,
+  0xcb, 0x08, 0x06, 0x9e, 0xff, 0xff, 0x7f, 0x29, 0x60, 0x8a, 0xfd, 0x76,
+  0x40, 0xf7, 0x86, 0xb2, 0xe7, 0xff, 0x6f, 0x98, 0x76, 0xd8, 0xff, 0x17,
+  0xc0, 0x52, 0x03, 0x07, 0x60, 0x88, 0x71, 0xa1, 0x17, 0x58, 0x40, 0x20,
+  0x87, 0x56, 0xd7, 0x2e, 0x01, 0x96, 0x08, 0xf7, 0xff, 0xa2, 0x97, 0x75,
+  0xf7, 0xfe, 0xa3, 0x97, 0x12, 0xeb, 0x80, 0x41, 0xf5, 0x12, 0xdd, 0x5a,
+  0x95, 0xd0, 0xa0, 0xd1, 0xb4, 0x36, 0x6c, 0x01, 0x00, 0xfd, 0xec, 0x7d,
+  0xfe
+};
 #endif // TOUCH_UI_UTF8_SUPERSCRIPTS
 
 #if ENABLED(TOUCH_UI_UTF8_ORDINALS)
-  /* 28 MASCULINE_ORDINAL */
-  0x89, 0x00, 0x01, 0x01, 0x01, 0x10, 0x0F, 0x00, 0x01, 0x01, 0x01, 0x8D,
-  0x02, 0xFF, 0x01, 0xB4, 0x0E, 0x00, 0x01, 0x4F, 0x04, 0xFF, 0x01, 0xA0,
-  0x0C, 0x00, 0x01, 0x04, 0x01, 0xFF, 0x01, 0xFC, 0x01, 0x63, 0x01, 0x48,
-  0x01, 0xFF, 0x01, 0xFB, 0x0C, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xA0,
-  0x02, 0x00, 0x01, 0x3F, 0x01, 0xFF, 0x01, 0x60, 0x0B, 0x00, 0x01, 0x6F,
-  0x01, 0xFE, 0x03, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xD0, 0x0B, 0x00,
-  0x01, 0xBF, 0x01, 0xF7, 0x04, 0x00, 0x01, 0xFF, 0x01, 0xF2, 0x0B, 0x00,
-  0x01, 0xEF, 0x01, 0xF3, 0x04, 0x00, 0x01, 0xCF, 0x01, 0xF6, 0x0B, 0x00,
-  0x01, 0xFF, 0x01, 0xF1, 0x04, 0x00, 0x01, 0xAF, 0x01, 0xF7, 0x0B, 0x00,
-  0x01, 0xFF, 0x01, 0xF1, 0x04, 0x00, 0x01, 0xAF, 0x01, 0xF7, 0x0B, 0x00,
-  0x01, 0xFF, 0x01, 0xF2, 0x04, 0x00, 0x01, 0xBF, 0x01, 0xF6, 0x0B, 0x00,
-  0x01, 0xCF, 0x01, 0xF6, 0x04, 0x00, 0x01, 0xEF, 0x01, 0xF4, 0x0B, 0x00,
-  0x01, 0x8F, 0x01, 0xFC, 0x03, 0x00, 0x01, 0x04, 0x01, 0xFF, 0x01, 0xF0,
-  0x0B, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0x60, 0x02, 0x00, 0x01, 0x1D,
-  0x01, 0xFF, 0x01, 0x90, 0x0B, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xF8,
-  0x01, 0x10, 0x01, 0x04, 0x01, 0xDF, 0x01, 0xFE, 0x01, 0x10, 0x0C, 0x00,
-  0x01, 0xAF, 0x04, 0xFF, 0x01, 0xE3, 0x0D, 0x00, 0x01, 0x05, 0x01, 0xDF,
-  0x02, 0xFF, 0x01, 0xFA, 0x01, 0x10, 0x0E, 0x00, 0x01, 0x02, 0x01, 0x56,
-  0x01, 0x64, 0x21, 0x00, 0x01, 0x16, 0x06, 0x66, 0x01, 0x40, 0x0B, 0x00,
-  0x01, 0x3F, 0x06, 0xFF, 0x01, 0xB0, 0x0B, 0x00, 0x01, 0x3F, 0x06, 0xFF,
-  0x01, 0xB0, 0x0B, 0x00, 0x01, 0x01, 0x06, 0x11, 0xFF, 0x00, 0x75, 0x00,
-
-  /* 29 FEMININE_ORDINAL */
-  0x89, 0x00, 0x01, 0x12, 0x01, 0x10, 0x0F, 0x00, 0x01, 0x49, 0x01, 0xDF,
-  0x02, 0xFF, 0x01, 0xB4, 0x0D, 0x00, 0x01, 0x07, 0x05, 0xFF, 0x01, 0xA0,
-  0x0C, 0x00, 0x01, 0x07, 0x01, 0xFC, 0x01, 0x74, 0x01, 0x33, 0x01, 0x59,
-  0x01, 0xFF, 0x01, 0xF8, 0x0C, 0x00, 0x01, 0x03, 0x01, 0x20, 0x03, 0x00,
-  0x01, 0x3F, 0x01, 0xFF, 0x01, 0x10, 0x10, 0x00, 0x01, 0x09, 0x01, 0xFF,
-  0x01, 0x50, 0x0E, 0x00, 0x01, 0x01, 0x01, 0x11, 0x01, 0x16, 0x01, 0xFF,
-  0x01, 0x80, 0x0C, 0x00, 0x01, 0x05, 0x01, 0xAE, 0x04, 0xFF, 0x01, 0x90,
-  0x0B, 0x00, 0x01, 0x01, 0x01, 0xCF, 0x05, 0xFF, 0x01, 0xA0, 0x0B, 0x00,
-  0x01, 0x0D, 0x01, 0xFF, 0x01, 0xE9, 0x01, 0x65, 0x01, 0x44, 0x01, 0x48,
-  0x01, 0xFF, 0x01, 0xA0, 0x0B, 0x00, 0x01, 0x5F, 0x01, 0xFD, 0x01, 0x10,
-  0x02, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xA0, 0x0B, 0x00, 0x01, 0x9F,
-  0x01, 0xF6, 0x03, 0x00, 0x01, 0x09, 0x01, 0xFF, 0x01, 0xA0, 0x0B, 0x00,
-  0x01, 0xAF, 0x01, 0xF5, 0x03, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x01, 0xA0,
-  0x0B, 0x00, 0x01, 0x9F, 0x01, 0xFA, 0x03, 0x00, 0x01, 0xAF, 0x01, 0xFF,
-  0x01, 0xA0, 0x0B, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0xA2, 0x01, 0x00,
-  0x01, 0x3B, 0x02, 0xFF, 0x01, 0xA0, 0x0B, 0x00, 0x01, 0x0A, 0x04, 0xFF,
-  0x01, 0xE7, 0x01, 0xFF, 0x01, 0xA0, 0x0C, 0x00, 0x01, 0x8F, 0x02, 0xFF,
-  0x01, 0xF9, 0x01, 0x15, 0x01, 0xFF, 0x01, 0xA0, 0x0D, 0x00, 0x01, 0x46,
-  0x01, 0x64, 0x02, 0x00, 0x01, 0x11, 0x1F, 0x00, 0x01, 0x16, 0x06, 0x66,
-  0x01, 0x40, 0x0B, 0x00, 0x01, 0x3F, 0x06, 0xFF, 0x01, 0xB0, 0x0B, 0x00,
-  0x01, 0x3F, 0x06, 0xFF, 0x01, 0xB0, 0x0B, 0x00, 0x01, 0x01, 0x06, 0x11,
-  0xFF, 0x00, 0x75, 0x00,
+constexpr uint32_t font_ordinals_size = 1960; // Inflated size
+
+const unsigned char font_ordinals[] PROGMEM = {
+  0x78, 0xda, 0x63, 0x60, 0x18, 0x5c, 0x80, 0x51, 0x00, 0x43, 0xa4, 0xf7,
+  0xff, 0xff, 0x2d, 0x68, 0x62, 0xfe, 0xff, 0x81, 0x60, 0x01, 0x8a, 0x10,
+  0xcb, 0xff, 0x3f, 0xc9, 0x1e, 0xff, 0x7f, 0xa3, 0x88, 0xf1, 0x81, 0xd4,
+  0xd8, 0xff, 0x4f, 0x40, 0x16, 0xcb, 0xff, 0x07, 0x24, 0xd8, 0xff, 0x5f,
+  0x40, 0x16, 0xdb, 0xff, 0x1d, 0x44, 0xfe, 0xff, 0x84, 0x2c, 0xf6, 0xfe,
+  0x33, 0x88, 0x3c, 0xff, 0x0d, 0x59, 0xec, 0xff, 0x47, 0x10, 0xb9, 0xfe,
+  0x3b, 0x41, 0x31, 0xb0, 0x49, 0xfb, 0x51, 0xf4, 0x42, 0x4c, 0x7a, 0xff,
+  0x05, 0x59, 0xac, 0xff, 0x0f, 0xd8, 0xe1, 0x1f, 0x90, 0xc5, 0xf4, 0x41,
+  0xce, 0x95, 0xfd, 0x3f, 0x01, 0x59, 0x8c, 0xe3, 0xff, 0x0f, 0x01, 0x96,
+  0xfb, 0xff, 0x50, 0x83, 0x66, 0x3d, 0x28, 0x0c, 0x1e, 0xa3, 0x86, 0x0b,
+  0xeb, 0xfd, 0xff, 0xff, 0x7f, 0xa1, 0x87, 0x20, 0x53, 0x58, 0x0a, 0x11,
+  0x01, 0x2f, 0x96, 0x06, 0x06, 0x0e, 0xc8, 0x62, 0xf6, 0xff, 0xc1, 0x60,
+  0x03, 0x21, 0x31, 0x46, 0x41, 0x30, 0x60, 0x18, 0x05, 0xa3, 0x00, 0x0b,
+  0x10, 0xc2, 0xc8, 0xd3, 0x9e, 0xf7, 0x31, 0xf2, 0x34, 0xfb, 0x7f, 0xcc,
+  0x3c, 0xcd, 0xfe, 0xa7, 0xc4, 0x38, 0xf2, 0xff, 0x0f, 0x14, 0x31, 0x66,
+  0x05, 0x70, 0x22, 0xc4, 0x30, 0x92, 0x81, 0xf3, 0x7f, 0x00, 0x7a, 0xc9,
+  0x21, 0x28, 0xf6, 0xbf, 0x01, 0x35, 0x7f, 0xac, 0x03, 0x59, 0x82, 0x92,
+  0xb7, 0x18, 0xcf, 0x63, 0x5a, 0xcc, 0xfb, 0xff, 0x65, 0xaa, 0x8b, 0x07,
+  0xaa, 0x58, 0xfc, 0x5f, 0xa0, 0x95, 0x6c, 0xa8, 0x62, 0xf3, 0xbf, 0x81,
+  0xed, 0x45, 0x11, 0x5b, 0xff, 0x15, 0x56, 0xf0, 0x20, 0xa9, 0xfb, 0x05,
+  0xce, 0xaf, 0x0b, 0x50, 0x8b, 0xb0, 0x45, 0x0c, 0xd6, 0x68, 0xf6, 0x72,
+  0x81, 0x5c, 0xf2, 0x1c, 0x2d, 0x10, 0xfa, 0xff, 0xff, 0xff, 0x29, 0x8a,
+  0x26, 0xc6, 0xe0, 0x06, 0xcc, 0xd2, 0x82, 0xa3, 0x79, 0x7a, 0xe4, 0x00,
+  0x00, 0xf5, 0x1d, 0xa1, 0x12
+};
 #endif // TOUCH_UI_UTF8_ORDINALS
 
 #if ENABLED(TOUCH_UI_UTF8_COPYRIGHT)
-  /* 30 COPYRIGHT_SIGN */
-  0xA0, 0x00, 0x01, 0x01, 0x01, 0x45, 0x01, 0x76, 0x01, 0x43, 0x0E, 0x00,
-  0x01, 0x28, 0x01, 0xDF, 0x03, 0xFF, 0x01, 0xE9, 0x01, 0x40, 0x0B, 0x00,
-  0x01, 0x19, 0x02, 0xFF, 0x01, 0xDB, 0x01, 0xAB, 0x01, 0xCE, 0x01, 0xFF,
-  0x01, 0xFB, 0x01, 0x30, 0x09, 0x00, 0x01, 0x03, 0x01, 0xEF, 0x01, 0xFB,
-  0x01, 0x50, 0x03, 0x00, 0x01, 0x38, 0x01, 0xFF, 0x01, 0xF7, 0x09, 0x00,
-  0x01, 0x6F, 0x01, 0xFC, 0x01, 0x30, 0x05, 0x00, 0x01, 0x19, 0x01, 0xFF,
-  0x01, 0xA0, 0x07, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xA0, 0x07, 0x00,
-  0x01, 0x5F, 0x01, 0xFB, 0x07, 0x00, 0x01, 0x3F, 0x01, 0xF8, 0x03, 0x00,
-  0x01, 0x46, 0x01, 0x88, 0x01, 0x65, 0x01, 0x10, 0x01, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0x80, 0x06, 0x00, 0x01, 0xEF, 0x01, 0xA0, 0x01, 0x00,
-  0x01, 0x01, 0x01, 0x9F, 0x03, 0xFF, 0x01, 0xFC, 0x01, 0x60, 0x01, 0x00,
-  0x01, 0x4F, 0x01, 0xF4, 0x05, 0x00, 0x01, 0x08, 0x01, 0xFD, 0x02, 0x00,
-  0x01, 0x4E, 0x02, 0xFF, 0x01, 0xED, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0,
-  0x01, 0x00, 0x01, 0x08, 0x01, 0xFD, 0x05, 0x00, 0x01, 0x1F, 0x01, 0xF4,
-  0x01, 0x00, 0x01, 0x04, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0x61, 0x01, 0x00,
-  0x01, 0x01, 0x01, 0x4A, 0x01, 0xA0, 0x02, 0x00, 0x01, 0xEF, 0x01, 0x60,
-  0x04, 0x00, 0x01, 0x6F, 0x01, 0xC0, 0x01, 0x00, 0x01, 0x0E, 0x01, 0xFF,
-  0x01, 0xC1, 0x07, 0x00, 0x01, 0x7F, 0x01, 0xB0, 0x04, 0x00, 0x01, 0xBF,
-  0x01, 0x60, 0x01, 0x00, 0x01, 0x7F, 0x01, 0xFF, 0x01, 0x10, 0x07, 0x00,
-  0x01, 0x1F, 0x01, 0xF0, 0x04, 0x00, 0x01, 0xFF, 0x01, 0x20, 0x01, 0x00,
-  0x01, 0xDF, 0x01, 0xF9, 0x08, 0x00, 0x01, 0x0D, 0x01, 0xF4, 0x03, 0x00,
-  0x01, 0x01, 0x01, 0xFE, 0x01, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF4,
-  0x08, 0x00, 0x01, 0x0A, 0x01, 0xF6, 0x03, 0x00, 0x01, 0x03, 0x01, 0xFD,
-  0x01, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xF1, 0x08, 0x00, 0x01, 0x08,
-  0x01, 0xF8, 0x03, 0x00, 0x01, 0x04, 0x01, 0xFC, 0x01, 0x00, 0x01, 0x03,
-  0x01, 0xFF, 0x01, 0xF0, 0x08, 0x00, 0x01, 0x07, 0x01, 0xF9, 0x03, 0x00,
-  0x01, 0x03, 0x01, 0xFD, 0x01, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xF1,
-  0x08, 0x00, 0x01, 0x08, 0x01, 0xF8, 0x03, 0x00, 0x01, 0x01, 0x01, 0xFE,
-  0x01, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF3, 0x08, 0x00, 0x01, 0x09,
-  0x01, 0xF7, 0x04, 0x00, 0x01, 0xFF, 0x01, 0x10, 0x01, 0x00, 0x01, 0xDF,
-  0x01, 0xF8, 0x08, 0x00, 0x01, 0x0C, 0x01, 0xF5, 0x04, 0x00, 0x01, 0xBF,
-  0x01, 0x60, 0x01, 0x00, 0x01, 0x8F, 0x01, 0xFE, 0x01, 0x10, 0x07, 0x00,
-  0x01, 0x1F, 0x01, 0xF1, 0x04, 0x00, 0x01, 0x6F, 0x01, 0xB0, 0x01, 0x00,
-  0x01, 0x1F, 0x01, 0xFF, 0x01, 0xB0, 0x07, 0x00, 0x01, 0x6F, 0x01, 0xC0,
-  0x04, 0x00, 0x01, 0x1F, 0x01, 0xF4, 0x01, 0x00, 0x01, 0x05, 0x01, 0xFF,
-  0x01, 0xFD, 0x01, 0x50, 0x02, 0x00, 0x01, 0x29, 0x01, 0xA0, 0x02, 0x00,
-  0x01, 0xEF, 0x01, 0x60, 0x04, 0x00, 0x01, 0x08, 0x01, 0xFD, 0x02, 0x00,
-  0x01, 0x6F, 0x02, 0xFF, 0x01, 0xDB, 0x01, 0xCE, 0x01, 0xFF, 0x01, 0xB0,
-  0x01, 0x00, 0x01, 0x07, 0x01, 0xFD, 0x05, 0x00, 0x01, 0x01, 0x01, 0xEF,
-  0x01, 0x90, 0x01, 0x00, 0x01, 0x02, 0x01, 0xBF, 0x03, 0xFF, 0x01, 0xFE,
-  0x01, 0x70, 0x01, 0x00, 0x01, 0x4F, 0x01, 0xF4, 0x06, 0x00, 0x01, 0x4F,
-  0x01, 0xF7, 0x02, 0x00, 0x01, 0x01, 0x01, 0x58, 0x01, 0x9A, 0x01, 0x86,
-  0x01, 0x30, 0x01, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x01, 0x80, 0x06, 0x00,
-  0x01, 0x06, 0x01, 0xFF, 0x01, 0x90, 0x07, 0x00, 0x01, 0x4F, 0x01, 0xFB,
-  0x08, 0x00, 0x01, 0x6F, 0x01, 0xFC, 0x01, 0x30, 0x05, 0x00, 0x01, 0x18,
-  0x01, 0xFF, 0x01, 0xB0, 0x08, 0x00, 0x01, 0x04, 0x01, 0xEF, 0x01, 0xFA,
-  0x01, 0x40, 0x03, 0x00, 0x01, 0x27, 0x01, 0xEF, 0x01, 0xF8, 0x0A, 0x00,
-  0x01, 0x19, 0x02, 0xFF, 0x01, 0xCA, 0x01, 0x9A, 0x01, 0xBE, 0x01, 0xFF,
-  0x01, 0xFC, 0x01, 0x30, 0x0B, 0x00, 0x01, 0x29, 0x01, 0xDF, 0x03, 0xFF,
-  0x01, 0xFA, 0x01, 0x40, 0x0D, 0x00, 0x01, 0x02, 0x01, 0x46, 0x01, 0x76,
-  0x01, 0x53, 0xC5, 0x00,
-
-  /* 31 REGISTERED_SIGN */
-  0xA0, 0x00, 0x01, 0x02, 0x01, 0x46, 0x01, 0x76, 0x01, 0x53, 0x0E, 0x00,
-  0x01, 0x28, 0x01, 0xDF, 0x03, 0xFF, 0x01, 0xEA, 0x01, 0x40, 0x0B, 0x00,
-  0x01, 0x19, 0x02, 0xFF, 0x01, 0xCB, 0x01, 0x9A, 0x01, 0xCE, 0x01, 0xFF,
-  0x01, 0xFC, 0x01, 0x30, 0x09, 0x00, 0x01, 0x04, 0x01, 0xEF, 0x01, 0xFA,
-  0x01, 0x40, 0x03, 0x00, 0x01, 0x38, 0x01, 0xFF, 0x01, 0xF8, 0x09, 0x00,
-  0x01, 0x6F, 0x01, 0xFC, 0x01, 0x30, 0x05, 0x00, 0x01, 0x18, 0x01, 0xFF,
-  0x01, 0xA0, 0x07, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0x90, 0x07, 0x00,
-  0x01, 0x4F, 0x01, 0xFB, 0x07, 0x00, 0x01, 0x3F, 0x01, 0xF7, 0x01, 0x00,
-  0x01, 0x13, 0x02, 0x33, 0x01, 0x32, 0x03, 0x00, 0x01, 0x02, 0x01, 0xFF,
-  0x01, 0x80, 0x06, 0x00, 0x01, 0xEF, 0x01, 0xA0, 0x01, 0x00, 0x01, 0x7F,
-  0x03, 0xFF, 0x01, 0xFD, 0x01, 0x81, 0x02, 0x00, 0x01, 0x4F, 0x01, 0xF5,
-  0x05, 0x00, 0x01, 0x08, 0x01, 0xFD, 0x02, 0x00, 0x01, 0x7F, 0x01, 0xFF,
-  0x01, 0xDD, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0x30, 0x01, 0x00,
-  0x01, 0x08, 0x01, 0xFE, 0x05, 0x00, 0x01, 0x1F, 0x01, 0xF4, 0x02, 0x00,
-  0x01, 0x7F, 0x01, 0xFA, 0x02, 0x00, 0x01, 0x3C, 0x01, 0xFF, 0x01, 0xD0,
-  0x02, 0x00, 0x01, 0xEF, 0x01, 0x60, 0x04, 0x00, 0x01, 0x6F, 0x01, 0xC0,
-  0x02, 0x00, 0x01, 0x7F, 0x01, 0xFA, 0x02, 0x00, 0x01, 0x02, 0x01, 0xFF,
-  0x01, 0xF3, 0x02, 0x00, 0x01, 0x7F, 0x01, 0xB0, 0x04, 0x00, 0x01, 0xBF,
-  0x01, 0x60, 0x02, 0x00, 0x01, 0x7F, 0x01, 0xFA, 0x03, 0x00, 0x01, 0xFF,
-  0x01, 0xF4, 0x02, 0x00, 0x01, 0x1F, 0x01, 0xF0, 0x04, 0x00, 0x01, 0xFF,
-  0x01, 0x10, 0x02, 0x00, 0x01, 0x7F, 0x01, 0xFA, 0x03, 0x00, 0x01, 0xFF,
-  0x01, 0xF2, 0x02, 0x00, 0x01, 0x0C, 0x01, 0xF5, 0x03, 0x00, 0x01, 0x01,
-  0x01, 0xFE, 0x03, 0x00, 0x01, 0x7F, 0x01, 0xFA, 0x02, 0x00, 0x01, 0x08,
-  0x01, 0xFF, 0x01, 0xE0, 0x02, 0x00, 0x01, 0x0A, 0x01, 0xF6, 0x03, 0x00,
-  0x01, 0x03, 0x01, 0xFD, 0x03, 0x00, 0x01, 0x7F, 0x01, 0xFD, 0x01, 0x88,
-  0x01, 0x9A, 0x01, 0xEF, 0x01, 0xFE, 0x01, 0x30, 0x02, 0x00, 0x01, 0x08,
-  0x01, 0xF8, 0x03, 0x00, 0x01, 0x04, 0x01, 0xFC, 0x03, 0x00, 0x01, 0x7F,
-  0x03, 0xFF, 0x01, 0xFE, 0x01, 0x91, 0x03, 0x00, 0x01, 0x07, 0x01, 0xF9,
-  0x03, 0x00, 0x01, 0x03, 0x01, 0xFD, 0x03, 0x00, 0x01, 0x7F, 0x01, 0xFC,
-  0x01, 0x78, 0x01, 0xDF, 0x01, 0xFD, 0x01, 0x20, 0x03, 0x00, 0x01, 0x08,
-  0x01, 0xF8, 0x03, 0x00, 0x01, 0x01, 0x01, 0xFE, 0x03, 0x00, 0x01, 0x7F,
-  0x01, 0xFA, 0x01, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0xC0, 0x03, 0x00,
-  0x01, 0x09, 0x01, 0xF6, 0x04, 0x00, 0x01, 0xFF, 0x01, 0x10, 0x02, 0x00,
-  0x01, 0x7F, 0x01, 0xFA, 0x02, 0x00, 0x01, 0xDF, 0x01, 0xF8, 0x03, 0x00,
-  0x01, 0x0C, 0x01, 0xF5, 0x04, 0x00, 0x01, 0xBF, 0x01, 0x60, 0x02, 0x00,
-  0x01, 0x7F, 0x01, 0xFA, 0x02, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0x30,
-  0x02, 0x00, 0x01, 0x1F, 0x01, 0xF1, 0x04, 0x00, 0x01, 0x6F, 0x01, 0xC0,
-  0x02, 0x00, 0x01, 0x7F, 0x01, 0xFA, 0x02, 0x00, 0x01, 0x09, 0x01, 0xFF,
-  0x01, 0xD0, 0x02, 0x00, 0x01, 0x6F, 0x01, 0xB0, 0x04, 0x00, 0x01, 0x1F,
-  0x01, 0xF4, 0x02, 0x00, 0x01, 0x7F, 0x01, 0xFA, 0x02, 0x00, 0x01, 0x01,
-  0x01, 0xEF, 0x01, 0xF7, 0x02, 0x00, 0x01, 0xEF, 0x01, 0x60, 0x04, 0x00,
-  0x01, 0x08, 0x01, 0xFD, 0x02, 0x00, 0x01, 0x7F, 0x01, 0xFA, 0x03, 0x00,
-  0x01, 0x6F, 0x01, 0xFF, 0x01, 0x20, 0x01, 0x08, 0x01, 0xFE, 0x06, 0x00,
-  0x01, 0xEF, 0x01, 0xA0, 0x01, 0x00, 0x01, 0x5A, 0x01, 0xA6, 0x03, 0x00,
-  0x01, 0x09, 0x01, 0xAA, 0x01, 0x60, 0x01, 0x4F, 0x01, 0xF4, 0x06, 0x00,
-  0x01, 0x3F, 0x01, 0xF8, 0x08, 0x00, 0x01, 0x03, 0x01, 0xFF, 0x01, 0x80,
-  0x06, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0x90, 0x07, 0x00, 0x01, 0x4F,
-  0x01, 0xFB, 0x08, 0x00, 0x01, 0x6F, 0x01, 0xFC, 0x01, 0x30, 0x05, 0x00,
-  0x01, 0x19, 0x01, 0xFF, 0x01, 0xA0, 0x08, 0x00, 0x01, 0x04, 0x01, 0xEF,
-  0x01, 0xFA, 0x01, 0x40, 0x03, 0x00, 0x01, 0x38, 0x01, 0xEF, 0x01, 0xF8,
-  0x0A, 0x00, 0x01, 0x19, 0x02, 0xFF, 0x01, 0xCB, 0x01, 0x9A, 0x01, 0xCE,
-  0x01, 0xFF, 0x01, 0xFC, 0x01, 0x30, 0x0B, 0x00, 0x01, 0x28, 0x01, 0xDF,
-  0x03, 0xFF, 0x01, 0xEA, 0x01, 0x40, 0x0D, 0x00, 0x01, 0x02, 0x01, 0x45,
-  0x01, 0x76, 0x01, 0x43, 0xC5, 0x00,
+constexpr uint32_t font_copyright_size = 1960; // Inflated size
+
+const unsigned char font_copyright[] PROGMEM = {
+  0x78, 0xda, 0xed, 0x95, 0xbf, 0x4f, 0xdb, 0x40, 0x14, 0xc7, 0xdf, 0x19,
+  0x02, 0x49, 0x7f, 0xa0, 0x48, 0x2c, 0x30, 0x25, 0x5b, 0xcb, 0x66, 0x95,
+  0x85, 0xa1, 0x52, 0x90, 0x10, 0x0c, 0x0c, 0x0d, 0x12, 0x0b, 0x62, 0x69,
+  0x3a, 0x74, 0x76, 0x27, 0xd4, 0xcd, 0x65, 0x41, 0x6c, 0x85, 0x35, 0x4b,
+  0x99, 0x3a, 0xc0, 0xe2, 0xbf, 0x80, 0x1f, 0x6b, 0x2b, 0x45, 0xdd, 0xab,
+  0x2a, 0xac, 0x20, 0xa1, 0x03, 0x1a, 0x48, 0x48, 0x6c, 0xbf, 0xbe, 0xbb,
+  0xf8, 0xdd, 0xd9, 0x21, 0xed, 0x5a, 0x21, 0xf1, 0x86, 0x9c, 0xf5, 0xcd,
+  0xe9, 0xfd, 0xfe, 0xd8, 0x00, 0x0f, 0xc3, 0xc4, 0xe2, 0xc6, 0xc2, 0x80,
+  0xf4, 0xb2, 0x89, 0x88, 0x67, 0xf3, 0x69, 0x69, 0x1a, 0xf1, 0xe7, 0x41,
+  0x03, 0x7b, 0xae, 0x95, 0x46, 0x64, 0x6f, 0x85, 0x8e, 0x39, 0x6c, 0x5b,
+  0xcd, 0x0b, 0xdd, 0xe4, 0xfa, 0x1e, 0x4b, 0x39, 0xf3, 0xf8, 0xb6, 0xc7,
+  0x5a, 0xa5, 0x43, 0x3f, 0x4b, 0xdb, 0xef, 0x8b, 0x30, 0x82, 0x9f, 0x12,
+  0x4d, 0xee, 0x81, 0xf8, 0x42, 0x71, 0xc3, 0x1a, 0x54, 0x5b, 0x7d, 0x29,
+  0x1f, 0x01, 0xbc, 0x41, 0xbc, 0x90, 0x18, 0xe8, 0x67, 0x65, 0xa5, 0x16,
+  0x8c, 0x62, 0xfc, 0x0e, 0xc4, 0x32, 0xb9, 0x95, 0xb5, 0x7e, 0xd4, 0x63,
+  0x98, 0xc0, 0x93, 0xc4, 0x8f, 0x1f, 0xe8, 0xe3, 0xa8, 0x06, 0x3e, 0x16,
+  0x13, 0xad, 0x74, 0xa9, 0x0f, 0x2c, 0x43, 0xf3, 0x8e, 0x73, 0x78, 0xae,
+  0x83, 0x88, 0x18, 0x04, 0xb6, 0x58, 0x7b, 0x72, 0xab, 0x0b, 0x8b, 0xc0,
+  0xc1, 0x2b, 0xd6, 0xf2, 0x2a, 0x57, 0x18, 0x0d, 0x29, 0xd5, 0x4b, 0xd6,
+  0xc6, 0xef, 0xfe, 0x76, 0x4f, 0xfb, 0xfb, 0xcd, 0x5a, 0xa1, 0xdf, 0x1a,
+  0xca, 0xa3, 0xd9, 0x61, 0xed, 0xd9, 0x0d, 0xe7, 0xf7, 0x39, 0x36, 0xf9,
+  0xf5, 0xbd, 0x78, 0x01, 0x94, 0x30, 0xe0, 0x56, 0x1e, 0x73, 0xbd, 0x39,
+  0x8c, 0xa8, 0xd1, 0x33, 0xb6, 0x5e, 0xd5, 0x0b, 0x8f, 0x06, 0xd2, 0xa0,
+  0xcb, 0xe3, 0x49, 0x5f, 0x84, 0xdc, 0x01, 0xe7, 0x88, 0xfa, 0x17, 0x7f,
+  0x30, 0xfd, 0x83, 0x2a, 0xc5, 0x17, 0x6b, 0xf5, 0x2d, 0x17, 0x1c, 0xc9,
+  0x7d, 0x1e, 0xc3, 0x1d, 0xfe, 0xb7, 0x77, 0x6f, 0x6e, 0x53, 0x26, 0x3c,
+  0x95, 0x2c, 0xbb, 0x6a, 0x05, 0x5e, 0xc8, 0x4e, 0x76, 0x0f, 0xbe, 0xd5,
+  0x0f, 0x31, 0x74, 0xd3, 0xcb, 0x31, 0xa3, 0xf6, 0xa5, 0x3b, 0x9f, 0x5d,
+  0x22, 0x67, 0x69, 0x63, 0x15, 0x1e, 0xed, 0xbf, 0xd8, 0x90, 0xde, 0x6b,
+  0xa6, 0xcf, 0x07, 0x99, 0xfe, 0x5e, 0x6f, 0x64, 0x66, 0x99, 0xcc, 0x7c,
+  0x0e, 0x3b, 0x30, 0x64, 0x37, 0x0c, 0xd3, 0xc3, 0x76, 0xa8, 0xd2, 0x86,
+  0xc9, 0xd9, 0xd9, 0x57, 0x2a, 0x7a, 0x9a, 0x69, 0x9f, 0xc2, 0x46, 0x9b,
+  0x74, 0xf1, 0xc6, 0x32, 0xed, 0xe3, 0x2f, 0x89, 0xb1, 0x0b, 0xf9, 0xd8,
+  0x30, 0x0d, 0x7e, 0x17, 0xe0, 0x35, 0xfe, 0x48, 0x33, 0xad, 0x35, 0x47,
+  0xd1, 0x64, 0x99, 0xd6, 0x1a, 0x28, 0x62, 0x99, 0xe9, 0x22, 0x6b, 0xd7,
+  0xcc, 0x96, 0x50, 0x6e, 0x95, 0x96, 0xc7, 0xd3, 0x14, 0xd3, 0xa4, 0x45,
+  0xdb, 0x75, 0x49, 0x71, 0x2d, 0xd3, 0xa0, 0xf3, 0x8b, 0x77, 0xd3, 0x4c,
+  0x93, 0x16, 0x7e, 0x6c, 0x46, 0xe5, 0x34, 0xd3, 0xda, 0xdf, 0x53, 0x54,
+  0x48, 0x16, 0x6e, 0x33, 0x71, 0x35, 0xd8, 0x96, 0x69, 0xad, 0x55, 0xd1,
+  0xb5, 0x4c, 0x27, 0x75, 0x14, 0x54, 0x6d, 0x5e, 0x90, 0xa9, 0x57, 0xc8,
+  0x76, 0x86, 0x69, 0x5d, 0x87, 0x87, 0x65, 0xee, 0x8b, 0xea, 0xdf, 0xfa,
+  0x57, 0x15, 0x73, 0xbf, 0x66, 0x98, 0xae, 0x98, 0xd1, 0xd8, 0x77, 0x67,
+  0xee, 0x5f, 0x4c, 0xa7, 0xde, 0xc5, 0x66, 0xbe, 0x83, 0x4c, 0x0f, 0xee,
+  0xc1, 0xd0, 0x7d, 0xa1, 0x61, 0xdc, 0xff, 0x56, 0x3c, 0x78, 0xfb, 0x03,
+  0xdc, 0x01, 0x25, 0xda
+};
 #endif // TOUCH_UI_UTF8_COPYRIGHT
 
 #if ENABLED(TOUCH_UI_UTF8_MATHEMATICS)
-  /* 32 PLUS_MINUS_SIGN */
-  0xEB, 0x00, 0x01, 0x02, 0x01, 0x77, 0x01, 0x70, 0x10, 0x00, 0x01, 0x06,
-  0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0,
-  0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x06,
-  0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0,
-  0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x06,
-  0x01, 0xFF, 0x01, 0xF0, 0x0B, 0x00, 0x01, 0x6A, 0x04, 0xAA, 0x01, 0xAC,
-  0x01, 0xFF, 0x01, 0xFA, 0x05, 0xAA, 0x01, 0x20, 0x05, 0x00, 0x01, 0x9F,
-  0x0C, 0xFF, 0x01, 0x40, 0x05, 0x00, 0x01, 0x9F, 0x0C, 0xFF, 0x01, 0x40,
-  0x05, 0x00, 0x01, 0x7C, 0x04, 0xCC, 0x01, 0xCD, 0x01, 0xFF, 0x01, 0xFC,
-  0x05, 0xCC, 0x01, 0x30, 0x0A, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0,
-  0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x06,
-  0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0,
-  0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x06,
-  0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF0,
-  0x10, 0x00, 0x01, 0x03, 0x01, 0x99, 0x01, 0x90, 0x44, 0x00, 0x01, 0x9F,
-  0x0C, 0xFF, 0x01, 0x30, 0x05, 0x00, 0x01, 0x9F, 0x0C, 0xFF, 0x01, 0x40,
-  0x05, 0x00, 0x01, 0x9F, 0x0C, 0xFF, 0x01, 0x40, 0x05, 0x00, 0x01, 0x47,
-  0x0C, 0x77, 0x01, 0x10, 0xC1, 0x00,
-
-  /* 33 MULTIPLICATION_SIGN */
-  0xFF, 0x00, 0x0E, 0x00, 0x01, 0x09, 0x01, 0xB0, 0x07, 0x00, 0x01, 0x03,
-  0x01, 0xE4, 0x08, 0x00, 0x01, 0x9F, 0x01, 0xFB, 0x07, 0x00, 0x01, 0x3E,
-  0x01, 0xFF, 0x01, 0x40, 0x06, 0x00, 0x01, 0x01, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xB0, 0x05, 0x00, 0x01, 0x03, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xA0,
-  0x07, 0x00, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0xFB, 0x05, 0x00, 0x01, 0x3E,
-  0x01, 0xFF, 0x01, 0xFB, 0x08, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xB0, 0x03, 0x00, 0x01, 0x03, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0,
-  0x09, 0x00, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0xFB, 0x03, 0x00, 0x01, 0x3E,
-  0x01, 0xFF, 0x01, 0xFB, 0x0A, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xB0, 0x01, 0x00, 0x01, 0x03, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0,
-  0x0B, 0x00, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0xFB, 0x01, 0x00, 0x01, 0x3E,
-  0x01, 0xFF, 0x01, 0xFB, 0x0C, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xB3, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0, 0x0D, 0x00, 0x01, 0x3E,
-  0x03, 0xFF, 0x01, 0xFB, 0x0E, 0x00, 0x01, 0x03, 0x01, 0xEF, 0x02, 0xFF,
-  0x01, 0xB0, 0x0F, 0x00, 0x01, 0x5F, 0x02, 0xFF, 0x01, 0x10, 0x0E, 0x00,
-  0x01, 0x03, 0x01, 0xEF, 0x02, 0xFF, 0x01, 0xB0, 0x0E, 0x00, 0x01, 0x3E,
-  0x03, 0xFF, 0x01, 0xFB, 0x0D, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xB3, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0, 0x0C, 0x00, 0x01, 0x2E,
-  0x01, 0xFF, 0x01, 0xFB, 0x01, 0x00, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0xFB,
-  0x0B, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0, 0x01, 0x00,
-  0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0, 0x0A, 0x00, 0x01, 0x2E,
-  0x01, 0xFF, 0x01, 0xFB, 0x03, 0x00, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0xFB,
-  0x09, 0x00, 0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0, 0x03, 0x00,
-  0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0, 0x08, 0x00, 0x01, 0x2E,
-  0x01, 0xFF, 0x01, 0xFB, 0x05, 0x00, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0xFB,
-  0x07, 0x00, 0x01, 0x01, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xB0, 0x05, 0x00,
-  0x01, 0x02, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xA0, 0x07, 0x00, 0x01, 0x8F,
-  0x01, 0xFB, 0x07, 0x00, 0x01, 0x2E, 0x01, 0xFF, 0x01, 0x40, 0x07, 0x00,
-  0x01, 0x09, 0x01, 0xB0, 0x07, 0x00, 0x01, 0x02, 0x01, 0xE4, 0xE9, 0x00,
-
-  /* 34 DIVISION_SIGN */
-  0xFF, 0x00, 0x25, 0x00, 0x01, 0x17, 0x01, 0x77, 0x01, 0x76, 0x10, 0x00,
-  0x01, 0x2F, 0x01, 0xFF, 0x01, 0xFC, 0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF,
-  0x01, 0xFC, 0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0xFC, 0x10, 0x00,
-  0x01, 0x2F, 0x01, 0xFF, 0x01, 0xFC, 0x10, 0x00, 0x01, 0x17, 0x01, 0x77,
-  0x01, 0x76, 0x31, 0x00, 0x01, 0x24, 0x0C, 0x44, 0x01, 0x10, 0x05, 0x00,
-  0x01, 0x9F, 0x0C, 0xFF, 0x01, 0x40, 0x05, 0x00, 0x01, 0x9F, 0x0C, 0xFF,
-  0x01, 0x40, 0x05, 0x00, 0x01, 0x9F, 0x0C, 0xFF, 0x01, 0x40, 0x05, 0x00,
-  0x01, 0x12, 0x0C, 0x22, 0x31, 0x00, 0x01, 0x18, 0x01, 0x88, 0x01, 0x87,
-  0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0xFC, 0x10, 0x00, 0x01, 0x2F,
-  0x01, 0xFF, 0x01, 0xFC, 0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0xFC,
-  0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0xFC, 0x10, 0x00, 0x01, 0x16,
-  0x01, 0x66, 0x01, 0x65, 0xFF, 0x00, 0x01, 0x00,
+constexpr uint32_t font_mathematics_size = 2940; // Inflated size
+
+const unsigned char font_mathematics[] PROGMEM = {
+  0x78, 0xda, 0x63, 0x60, 0x18, 0x91, 0x80, 0xa9, 0xbc, 0x00, 0x43, 0x8c,
+  0xed, 0xff, 0x87, 0xc1, 0x20, 0x96, 0xb5, 0x0a, 0x08, 0xd6, 0xfc, 0xff,
+  0x05, 0xa2, 0x56, 0x29, 0x40, 0xc4, 0xe6, 0xff, 0x47, 0x02, 0x0e, 0xb8,
+  0xc5, 0x6a, 0xce, 0x00, 0xc1, 0xd9, 0xff, 0x7f, 0x40, 0xd4, 0x19, 0x83,
+  0xc1, 0xe7, 0x37, 0x30, 0x60, 0x9e, 0x39, 0x81, 0x5a, 0xd1, 0x88, 0x12,
+  0x06, 0x06, 0xa4, 0x85, 0x95, 0x7b, 0x39, 0x12, 0x10, 0x60, 0x18, 0x05,
+  0x23, 0x01, 0x70, 0x6e, 0x80, 0x25, 0xc2, 0x27, 0x88, 0x44, 0xf4, 0x1b,
+  0xca, 0xb0, 0x83, 0x25, 0x0d, 0x06, 0xc6, 0xf7, 0xff, 0x21, 0x0a, 0x99,
+  0xdf, 0xff, 0x5f, 0x00, 0x53, 0xa7, 0xf7, 0xff, 0x37, 0x54, 0xd9, 0x6f,
+  0x44, 0x39, 0x02, 0x51, 0xc8, 0x0c, 0x53, 0x8f, 0xa4, 0x10, 0x59, 0x19,
+  0x54, 0x21, 0xaa, 0x32, 0x88, 0x42, 0x54, 0x65, 0x60, 0x85, 0x9b, 0xd1,
+  0x94, 0x81, 0xcc, 0xfa, 0x8f, 0xa6, 0x0c, 0x6c, 0x27, 0xba, 0x32, 0x06,
+  0x86, 0xf8, 0xff, 0xff, 0x05, 0x88, 0x50, 0x87, 0xc5, 0x3c, 0x6c, 0xf6,
+  0x82, 0xdc, 0xa7, 0x87, 0xaa, 0x10, 0xec, 0x0f, 0x26, 0x54, 0x85, 0x10,
+  0x25, 0x28, 0x0a, 0xa1, 0x2a, 0x50, 0x14, 0xc2, 0x14, 0x20, 0x29, 0x84,
+  0x87, 0x33, 0x13, 0x52, 0x38, 0xf7, 0xff, 0x86, 0x6b, 0x70, 0xc0, 0x88,
+  0x37, 0xa6, 0x27, 0xa3, 0x89, 0x78, 0x14, 0x10, 0x05, 0xc4, 0xcb, 0xcb,
+  0x30, 0xc4, 0xf4, 0xff, 0xff, 0xa1, 0xaa, 0x18, 0x36, 0x3b, 0x88, 0x00,
+  0x2a, 0x2e, 0x48, 0x40, 0x80, 0xb4, 0x7a, 0x0b, 0x9b, 0x98, 0x90, 0x12,
+  0x12, 0x20, 0xc7, 0x41, 0x12, 0x1d, 0xed, 0x34, 0x0f, 0x2b, 0xb1, 0xb4,
+  0xd4, 0xd1, 0x44, 0x89, 0x0c, 0x00, 0xf0, 0xee, 0x17, 0x8e
+};
 #endif // TOUCH_UI_UTF8_MATHEMATICS
 
 #if ENABLED(TOUCH_UI_UTF8_FRACTIONS)
-  /* 35 FRACTION_QUARTER */
-  0x92, 0x00, 0x01, 0x01, 0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04,
-  0x01, 0x79, 0x01, 0xCE, 0x01, 0xEE, 0x01, 0x20, 0x07, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0x90, 0x04, 0x00, 0x01, 0x3F, 0x03, 0xFF, 0x01, 0x20,
-  0x07, 0x00, 0x01, 0x3F, 0x01, 0xFE, 0x01, 0x10, 0x04, 0x00, 0x01, 0x3F,
-  0x01, 0xDB, 0x01, 0x8D, 0x01, 0xFF, 0x01, 0x20, 0x07, 0x00, 0x01, 0xDF,
-  0x01, 0xF5, 0x05, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0B, 0x01, 0xFF,
-  0x01, 0x20, 0x06, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xC0, 0x07, 0x00,
-  0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x06, 0x00, 0x01, 0x1F, 0x01, 0xFF,
-  0x01, 0x20, 0x07, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x06, 0x00,
-  0x01, 0xAF, 0x01, 0xF8, 0x08, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20,
-  0x05, 0x00, 0x01, 0x04, 0x01, 0xFF, 0x01, 0xE1, 0x08, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x20, 0x05, 0x00, 0x01, 0x0D, 0x01, 0xFF, 0x01, 0x50,
-  0x08, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x05, 0x00, 0x01, 0x7F,
-  0x01, 0xFC, 0x09, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x04, 0x00,
-  0x01, 0x01, 0x01, 0xFF, 0x01, 0xF2, 0x09, 0x00, 0x01, 0x0B, 0x01, 0xFF,
-  0x01, 0x20, 0x04, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0x80, 0x09, 0x00,
-  0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x04, 0x00, 0x01, 0x4F, 0x01, 0xFE,
-  0x0A, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x04, 0x00, 0x01, 0xDF,
-  0x01, 0xF5, 0x0A, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x03, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xB0, 0x04, 0x00, 0x01, 0x37, 0x01, 0x77,
-  0x02, 0x00, 0x01, 0x04, 0x01, 0x55, 0x01, 0x5D, 0x01, 0xFF, 0x01, 0x75,
-  0x01, 0x55, 0x01, 0x10, 0x01, 0x00, 0x01, 0x1F, 0x01, 0xFF, 0x01, 0x20,
-  0x03, 0x00, 0x01, 0x01, 0x01, 0xEF, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x0D,
-  0x05, 0xFF, 0x01, 0x40, 0x01, 0x00, 0x01, 0xAF, 0x01, 0xF8, 0x04, 0x00,
-  0x01, 0x0C, 0x02, 0xFF, 0x02, 0x00, 0x01, 0x0C, 0x05, 0xEE, 0x01, 0x40,
-  0x01, 0x04, 0x01, 0xFF, 0x01, 0xE0, 0x04, 0x00, 0x01, 0x8F, 0x01, 0xBE,
-  0x01, 0xFF, 0x09, 0x00, 0x01, 0x0D, 0x01, 0xFF, 0x01, 0x50, 0x03, 0x00,
-  0x01, 0x04, 0x01, 0xFE, 0x01, 0x1E, 0x01, 0xFF, 0x09, 0x00, 0x01, 0x7F,
-  0x01, 0xFC, 0x04, 0x00, 0x01, 0x1E, 0x01, 0xF4, 0x01, 0x0E, 0x01, 0xFF,
-  0x08, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF2, 0x04, 0x00, 0x01, 0xBF,
-  0x01, 0x80, 0x01, 0x0E, 0x01, 0xFF, 0x08, 0x00, 0x01, 0x0B, 0x01, 0xFF,
-  0x01, 0x80, 0x03, 0x00, 0x01, 0x08, 0x01, 0xFC, 0x01, 0x00, 0x01, 0x0E,
-  0x01, 0xFF, 0x08, 0x00, 0x01, 0x4F, 0x01, 0xFE, 0x04, 0x00, 0x01, 0x4F,
-  0x01, 0xE1, 0x01, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x08, 0x00, 0x01, 0xDF,
-  0x01, 0xF5, 0x03, 0x00, 0x01, 0x01, 0x01, 0xEF, 0x01, 0x40, 0x01, 0x00,
-  0x01, 0x0E, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xB0,
-  0x03, 0x00, 0x01, 0x0B, 0x01, 0xF8, 0x02, 0x00, 0x01, 0x0E, 0x01, 0xFF,
-  0x07, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0x20, 0x03, 0x00, 0x01, 0x3F,
-  0x01, 0xF8, 0x02, 0x88, 0x01, 0x8F, 0x01, 0xFF, 0x01, 0x88, 0x06, 0x00,
-  0x01, 0xBF, 0x01, 0xF8, 0x04, 0x00, 0x01, 0x4F, 0x06, 0xFF, 0x05, 0x00,
-  0x01, 0x04, 0x01, 0xFF, 0x01, 0xE0, 0x04, 0x00, 0x01, 0x2A, 0x03, 0xAA,
-  0x01, 0xAF, 0x01, 0xFF, 0x01, 0xAA, 0x05, 0x00, 0x01, 0x0D, 0x01, 0xFF,
-  0x01, 0x50, 0x08, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x06, 0x00, 0x01, 0x8F,
-  0x01, 0xFB, 0x09, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x05, 0x00, 0x01, 0x02,
-  0x01, 0xFF, 0x01, 0xF2, 0x09, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x05, 0x00,
-  0x01, 0x0B, 0x01, 0xFF, 0x01, 0x80, 0x09, 0x00, 0x01, 0x05, 0x01, 0x66,
-  0xBF, 0x00,
-
-  /* 36 FRACTION_HALF */
-  0x92, 0x00, 0x01, 0x01, 0x01, 0x44, 0x01, 0x40, 0x04, 0x00, 0x01, 0x04,
-  0x01, 0x7A, 0x01, 0xCE, 0x01, 0xEE, 0x01, 0x20, 0x07, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0x80, 0x04, 0x00, 0x01, 0x3F, 0x03, 0xFF, 0x01, 0x20,
-  0x07, 0x00, 0x01, 0x4F, 0x01, 0xFE, 0x05, 0x00, 0x01, 0x3F, 0x01, 0xDA,
-  0x01, 0x7D, 0x01, 0xFF, 0x01, 0x20, 0x07, 0x00, 0x01, 0xDF, 0x01, 0xF5,
-  0x07, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x06, 0x00, 0x01, 0x07,
-  0x01, 0xFF, 0x01, 0xC0, 0x07, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20,
-  0x06, 0x00, 0x01, 0x1F, 0x01, 0xFF, 0x01, 0x20, 0x07, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x20, 0x06, 0x00, 0x01, 0xAF, 0x01, 0xF8, 0x08, 0x00,
-  0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x05, 0x00, 0x01, 0x04, 0x01, 0xFF,
-  0x01, 0xE0, 0x08, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x05, 0x00,
-  0x01, 0x0D, 0x01, 0xFF, 0x01, 0x50, 0x08, 0x00, 0x01, 0x0B, 0x01, 0xFF,
-  0x01, 0x20, 0x05, 0x00, 0x01, 0x7F, 0x01, 0xFC, 0x09, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x20, 0x04, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF2,
-  0x09, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20, 0x04, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0x80, 0x09, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0x20,
-  0x04, 0x00, 0x01, 0x4F, 0x01, 0xFE, 0x0A, 0x00, 0x01, 0x0B, 0x01, 0xFF,
-  0x01, 0x20, 0x04, 0x00, 0x01, 0xDF, 0x01, 0xF5, 0x0A, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0x20, 0x03, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xB0,
-  0x01, 0x00, 0x01, 0x04, 0x01, 0x8A, 0x01, 0xCC, 0x01, 0xA7, 0x01, 0x10,
-  0x02, 0x00, 0x01, 0x04, 0x01, 0x55, 0x01, 0x5D, 0x01, 0xFF, 0x01, 0x75,
-  0x01, 0x55, 0x01, 0x10, 0x01, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0x20,
-  0x01, 0x06, 0x04, 0xFF, 0x01, 0xF7, 0x02, 0x00, 0x01, 0x0D, 0x05, 0xFF,
-  0x01, 0x40, 0x01, 0x00, 0x01, 0xBF, 0x01, 0xF8, 0x01, 0x00, 0x01, 0x08,
-  0x01, 0xFF, 0x01, 0xA7, 0x01, 0x68, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0x70,
-  0x01, 0x00, 0x01, 0x0B, 0x05, 0xDD, 0x01, 0x40, 0x01, 0x04, 0x01, 0xFF,
-  0x01, 0xE0, 0x01, 0x00, 0x01, 0x05, 0x01, 0x60, 0x02, 0x00, 0x01, 0x08,
-  0x01, 0xFF, 0x01, 0xF1, 0x08, 0x00, 0x01, 0x0D, 0x01, 0xFF, 0x01, 0x50,
-  0x06, 0x00, 0x01, 0xEF, 0x01, 0xF4, 0x08, 0x00, 0x01, 0x7F, 0x01, 0xFB,
-  0x07, 0x00, 0x01, 0xCF, 0x01, 0xF3, 0x07, 0x00, 0x01, 0x02, 0x01, 0xFF,
-  0x01, 0xF2, 0x06, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xE0, 0x07, 0x00,
-  0x01, 0x0B, 0x01, 0xFF, 0x01, 0x80, 0x06, 0x00, 0x01, 0x0D, 0x01, 0xFF,
-  0x01, 0x50, 0x07, 0x00, 0x01, 0x4F, 0x01, 0xFE, 0x07, 0x00, 0x01, 0xAF,
-  0x01, 0xFA, 0x08, 0x00, 0x01, 0xDF, 0x01, 0xF5, 0x06, 0x00, 0x01, 0x09,
-  0x01, 0xFF, 0x01, 0xC0, 0x07, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xB0,
-  0x06, 0x00, 0x01, 0x8F, 0x01, 0xFD, 0x01, 0x10, 0x07, 0x00, 0x01, 0x2F,
-  0x01, 0xFF, 0x01, 0x20, 0x05, 0x00, 0x01, 0x09, 0x01, 0xFF, 0x01, 0xC1,
-  0x08, 0x00, 0x01, 0xBF, 0x01, 0xF8, 0x06, 0x00, 0x01, 0xAF, 0x01, 0xFB,
-  0x08, 0x00, 0x01, 0x05, 0x01, 0xFF, 0x01, 0xE0, 0x05, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0xA0, 0x08, 0x00, 0x01, 0x0D, 0x01, 0xFF, 0x01, 0x50,
-  0x04, 0x00, 0x01, 0x01, 0x01, 0xCF, 0x01, 0xF9, 0x09, 0x00, 0x01, 0x8F,
-  0x01, 0xFB, 0x05, 0x00, 0x01, 0x09, 0x01, 0xFF, 0x01, 0xFE, 0x03, 0xEE,
-  0x01, 0xE6, 0x04, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xF2, 0x05, 0x00,
-  0x01, 0x0A, 0x05, 0xFF, 0x01, 0xF7, 0x04, 0x00, 0x01, 0x0A, 0x01, 0xEE,
-  0x01, 0x70, 0x05, 0x00, 0x01, 0x04, 0x05, 0x66, 0x01, 0x62, 0xBE, 0x00,
-
-  /* 37 FRACTION_THREE_FOURTHS */
-  0x87, 0x00, 0x01, 0x02, 0x01, 0x34, 0x01, 0x42, 0x08, 0x00, 0x01, 0x01,
-  0x01, 0x55, 0x01, 0x50, 0x04, 0x00, 0x01, 0x4C, 0x03, 0xFF, 0x01, 0xE9,
-  0x01, 0x10, 0x06, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0x80, 0x04, 0x00,
-  0x01, 0x7F, 0x01, 0xFF, 0x01, 0xFE, 0x02, 0xFF, 0x01, 0xE2, 0x06, 0x00,
-  0x01, 0x4F, 0x01, 0xFE, 0x05, 0x00, 0x01, 0x47, 0x01, 0x30, 0x01, 0x00,
-  0x01, 0x05, 0x01, 0xEF, 0x01, 0xFB, 0x06, 0x00, 0x01, 0xDF, 0x01, 0xF5,
-  0x09, 0x00, 0x01, 0x3F, 0x01, 0xFF, 0x05, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xB0, 0x09, 0x00, 0x01, 0x1F, 0x01, 0xFF, 0x05, 0x00, 0x01, 0x2F,
-  0x01, 0xFF, 0x01, 0x20, 0x09, 0x00, 0x01, 0x6F, 0x01, 0xFB, 0x05, 0x00,
-  0x01, 0xBF, 0x01, 0xF8, 0x07, 0x00, 0x01, 0x03, 0x01, 0x44, 0x01, 0x5A,
-  0x01, 0xFF, 0x01, 0xD1, 0x04, 0x00, 0x01, 0x04, 0x01, 0xFF, 0x01, 0xE0,
-  0x07, 0x00, 0x01, 0x0C, 0x02, 0xFF, 0x01, 0xE7, 0x05, 0x00, 0x01, 0x0D,
-  0x01, 0xFF, 0x01, 0x50, 0x07, 0x00, 0x01, 0x0B, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0xFE, 0x01, 0x70, 0x04, 0x00, 0x01, 0x7F, 0x01, 0xFB, 0x0A, 0x00,
-  0x01, 0x16, 0x01, 0xDF, 0x01, 0xF9, 0x03, 0x00, 0x01, 0x02, 0x01, 0xFF,
-  0x01, 0xF2, 0x0B, 0x00, 0x01, 0x1E, 0x01, 0xFF, 0x01, 0x20, 0x02, 0x00,
-  0x01, 0x0B, 0x01, 0xFF, 0x01, 0x80, 0x0B, 0x00, 0x01, 0x0A, 0x01, 0xFF,
-  0x01, 0x60, 0x02, 0x00, 0x01, 0x4F, 0x01, 0xFE, 0x0C, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0x60, 0x02, 0x00, 0x01, 0xDF, 0x01, 0xF5, 0x0C, 0x00,
-  0x01, 0x2F, 0x01, 0xFF, 0x01, 0x30, 0x01, 0x00, 0x01, 0x08, 0x01, 0xFF,
-  0x01, 0xB0, 0x04, 0x00, 0x01, 0x47, 0x01, 0x77, 0x02, 0x00, 0x01, 0xD7,
-  0x01, 0x42, 0x01, 0x01, 0x01, 0x38, 0x01, 0xEF, 0x01, 0xFC, 0x02, 0x00,
-  0x01, 0x2F, 0x01, 0xFF, 0x01, 0x20, 0x03, 0x00, 0x01, 0x02, 0x02, 0xFF,
-  0x02, 0x00, 0x05, 0xFF, 0x01, 0xC1, 0x02, 0x00, 0x01, 0xBF, 0x01, 0xF8,
-  0x04, 0x00, 0x01, 0x0C, 0x02, 0xFF, 0x02, 0x00, 0x01, 0x7B, 0x01, 0xEF,
-  0x02, 0xFF, 0x01, 0xB6, 0x02, 0x00, 0x01, 0x04, 0x01, 0xFF, 0x01, 0xE0,
-  0x04, 0x00, 0x01, 0x9F, 0x01, 0xBE, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x22,
-  0x01, 0x10, 0x03, 0x00, 0x01, 0x0D, 0x01, 0xFF, 0x01, 0x50, 0x03, 0x00,
-  0x01, 0x04, 0x01, 0xFE, 0x01, 0x1E, 0x01, 0xFF, 0x09, 0x00, 0x01, 0x8F,
-  0x01, 0xFB, 0x04, 0x00, 0x01, 0x1E, 0x01, 0xF3, 0x01, 0x0E, 0x01, 0xFF,
-  0x08, 0x00, 0x01, 0x02, 0x01, 0xFF, 0x01, 0xF2, 0x04, 0x00, 0x01, 0xCF,
-  0x01, 0x70, 0x01, 0x0E, 0x01, 0xFF, 0x08, 0x00, 0x01, 0x0B, 0x01, 0xFF,
-  0x01, 0x80, 0x03, 0x00, 0x01, 0x08, 0x01, 0xFB, 0x01, 0x00, 0x01, 0x0E,
-  0x01, 0xFF, 0x08, 0x00, 0x01, 0x5F, 0x01, 0xFE, 0x04, 0x00, 0x01, 0x4F,
-  0x01, 0xE1, 0x01, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x08, 0x00, 0x01, 0xDF,
-  0x01, 0xF4, 0x03, 0x00, 0x01, 0x01, 0x01, 0xEF, 0x01, 0x40, 0x01, 0x00,
-  0x01, 0x0E, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x08, 0x01, 0xFF, 0x01, 0xB0,
-  0x03, 0x00, 0x01, 0x0B, 0x01, 0xF8, 0x02, 0x00, 0x01, 0x0E, 0x01, 0xFF,
-  0x07, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0x20, 0x03, 0x00, 0x01, 0x3F,
-  0x01, 0xF9, 0x02, 0x99, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0x99, 0x06, 0x00,
-  0x01, 0xBF, 0x01, 0xF8, 0x04, 0x00, 0x01, 0x4F, 0x06, 0xFF, 0x05, 0x00,
-  0x01, 0x05, 0x01, 0xFF, 0x01, 0xD0, 0x04, 0x00, 0x01, 0x29, 0x03, 0x99,
-  0x01, 0x9F, 0x01, 0xFF, 0x01, 0x99, 0x05, 0x00, 0x01, 0x0D, 0x01, 0xFF,
-  0x01, 0x40, 0x08, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x06, 0x00, 0x01, 0x8F,
-  0x01, 0xFB, 0x09, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x05, 0x00, 0x01, 0x02,
-  0x01, 0xFF, 0x01, 0xF2, 0x09, 0x00, 0x01, 0x0E, 0x01, 0xFF, 0x05, 0x00,
-  0x01, 0x0A, 0x01, 0xEE, 0x01, 0x70, 0x09, 0x00, 0x01, 0x04, 0x01, 0x55,
-  0xBF, 0x00,
+constexpr uint32_t font_fractions_size = 2940; // Inflated size
+
+const unsigned char font_fractions[] PROGMEM = {
+  0x78, 0xda, 0xed, 0x95, 0x3f, 0x88, 0x13, 0x41, 0x14, 0xc6, 0x67, 0xe3,
+  0xae, 0x97, 0xcb, 0xde, 0xc9, 0x56, 0x96, 0x51, 0xec, 0xb4, 0xf1, 0x0a,
+  0x41, 0xbb, 0x2c, 0xc7, 0xc1, 0x35, 0x42, 0x6c, 0xd2, 0x08, 0xe2, 0x61,
+  0x71, 0xd8, 0x99, 0x46, 0x44, 0x45, 0x2e, 0x65, 0x10, 0x24, 0xb6, 0xa9,
+  0xce, 0xee, 0x20, 0x4d, 0xac, 0x2c, 0x8d, 0xd7, 0x8b, 0xd1, 0x4a, 0x50,
+  0x24, 0x77, 0x16, 0x8a, 0x4d, 0x16, 0xbd, 0x88, 0x17, 0x13, 0xf7, 0x39,
+  0xff, 0xe7, 0xcd, 0x8c, 0x69, 0x44, 0xe5, 0x90, 0x7b, 0xcd, 0x24, 0x1f,
+  0xbb, 0x93, 0xf9, 0xe6, 0xbd, 0x5f, 0x3e, 0x42, 0x0e, 0x68, 0x05, 0x2b,
+  0x29, 0x5f, 0xc3, 0xdb, 0x2f, 0x86, 0x27, 0xa5, 0x56, 0x82, 0x87, 0x7c,
+  0xad, 0x00, 0x80, 0xd2, 0x2a, 0x79, 0x22, 0xd6, 0xb7, 0x0f, 0xb4, 0x36,
+  0xf8, 0x2a, 0xf7, 0x20, 0xb1, 0xd2, 0xe6, 0xe0, 0x99, 0xda, 0x59, 0x6b,
+  0x27, 0xf4, 0x0b, 0x46, 0xeb, 0xee, 0x13, 0x57, 0x0b, 0x61, 0xd7, 0xd3,
+  0x16, 0xe1, 0x92, 0xa7, 0x6d, 0x4c, 0x89, 0xab, 0x05, 0xf0, 0xc5, 0xd3,
+  0x4a, 0xd0, 0xf0, 0xb4, 0x6a, 0x4e, 0x3c, 0x4d, 0x99, 0x40, 0xda, 0x1c,
+  0x3c, 0x66, 0x5f, 0xce, 0xdf, 0x62, 0xa7, 0xaa, 0x5d, 0x81, 0x9b, 0xb5,
+  0x44, 0x9a, 0x08, 0x32, 0xe0, 0xa7, 0x62, 0x95, 0x4a, 0x13, 0x0b, 0xc0,
+  0xb4, 0x85, 0x21, 0xab, 0x34, 0x84, 0x1d, 0xa6, 0xb5, 0x9e, 0x82, 0xd9,
+  0x54, 0x98, 0x08, 0xf3, 0x32, 0xd2, 0x84, 0x89, 0xf2, 0xe8, 0x98, 0xd1,
+  0xa4, 0x89, 0x5e, 0x03, 0x69, 0x31, 0x37, 0x51, 0x9c, 0x12, 0xa4, 0x09,
+  0x13, 0xd5, 0x5d, 0xac, 0x71, 0x13, 0x41, 0x96, 0x22, 0x4d, 0x98, 0x88,
+  0xe9, 0x11, 0x8d, 0x76, 0x96, 0x9b, 0xa8, 0xec, 0x37, 0x9b, 0x2d, 0x68,
+  0x4a, 0xad, 0xc7, 0x4d, 0x54, 0xb9, 0x25, 0xf9, 0xa0, 0x34, 0x71, 0xa6,
+  0xd3, 0xe9, 0x74, 0xa1, 0x43, 0xdc, 0x4e, 0xe8, 0xfd, 0x5a, 0x13, 0xe2,
+  0x6a, 0x05, 0xd4, 0x09, 0xa5, 0xc5, 0xa8, 0x13, 0xd1, 0x3a, 0x39, 0xac,
+  0x7f, 0xc6, 0xf4, 0x1d, 0xcc, 0x74, 0xc3, 0x63, 0x5a, 0xe1, 0x50, 0x79,
+  0x73, 0xcf, 0x63, 0x9a, 0xfc, 0x21, 0xa6, 0x77, 0x0e, 0x10, 0xd3, 0xe1,
+  0xfd, 0xe7, 0x5b, 0x09, 0x62, 0x9a, 0xe2, 0x70, 0x94, 0x4d, 0xfd, 0x37,
+  0xc4, 0x34, 0xc5, 0xa1, 0x08, 0x5b, 0xd7, 0x07, 0x50, 0xa7, 0x6f, 0xbe,
+  0x63, 0xc5, 0x99, 0x8e, 0xd6, 0x28, 0x86, 0xf0, 0xd9, 0x61, 0x9a, 0x56,
+  0x36, 0x32, 0x4c, 0x2b, 0x1c, 0xfa, 0x7b, 0x4a, 0xd2, 0x38, 0x14, 0xcc,
+  0x45, 0x68, 0x1c, 0xd0, 0x45, 0x68, 0x13, 0xdd, 0xef, 0x36, 0xd3, 0xb4,
+  0xe6, 0xcd, 0xf5, 0x17, 0xc5, 0x1f, 0x13, 0x25, 0xef, 0x47, 0x62, 0x33,
+  0xcd, 0x1e, 0xdb, 0xd6, 0xaf, 0xf6, 0x64, 0x27, 0xba, 0x06, 0xd0, 0x48,
+  0x1e, 0x20, 0x86, 0x47, 0xae, 0x89, 0xa0, 0x3f, 0x36, 0xb7, 0x25, 0x99,
+  0x9e, 0x87, 0x9c, 0xfe, 0x9d, 0x7d, 0xb0, 0x4c, 0x94, 0x40, 0x5d, 0x16,
+  0xfd, 0x3c, 0xac, 0x8b, 0x06, 0xaf, 0xb3, 0xba, 0x76, 0xc8, 0xdc, 0x5f,
+  0xa9, 0xc2, 0xb9, 0x65, 0xcd, 0x74, 0x4d, 0x0c, 0xcb, 0x45, 0xda, 0x82,
+  0x4f, 0x89, 0xcd, 0xf4, 0x06, 0xe4, 0x00, 0xef, 0xed, 0x49, 0x5a, 0x5d,
+  0x22, 0x51, 0x36, 0x71, 0x99, 0x66, 0xfc, 0xa3, 0x74, 0x20, 0x0a, 0x66,
+  0x6b, 0x92, 0x78, 0xdd, 0x98, 0x58, 0x93, 0x44, 0xc8, 0x91, 0x95, 0xcb,
+  0xf0, 0xca, 0x61, 0x9a, 0x46, 0xdf, 0x47, 0x77, 0x94, 0xe3, 0x0c, 0xf2,
+  0xba, 0x85, 0x03, 0xab, 0xe3, 0x83, 0xb1, 0x93, 0x0e, 0x2c, 0xfe, 0xd8,
+  0x0f, 0xe2, 0x74, 0xe0, 0x9e, 0xd6, 0x1c, 0xa6, 0xa5, 0x66, 0x31, 0xcd,
+  0x0e, 0xbb, 0xa4, 0x70, 0x58, 0x65, 0x39, 0xfd, 0x7a, 0x39, 0xb8, 0x90,
+  0x4d, 0x95, 0x89, 0x02, 0x8f, 0x32, 0x3e, 0xaf, 0xdb, 0xca, 0x84, 0xc8,
+  0xe9, 0xbb, 0x19, 0xc0, 0x13, 0x6d, 0x62, 0x53, 0xe6, 0xf4, 0xa9, 0x64,
+  0x46, 0x4e, 0x0b, 0x1c, 0xca, 0x7b, 0x28, 0x6b, 0xa5, 0x89, 0x7e, 0xdd,
+  0xcf, 0xe9, 0x09, 0xce, 0xe4, 0xab, 0xbf, 0xca, 0xe9, 0x91, 0x97, 0xd3,
+  0xc5, 0xd9, 0x39, 0x3d, 0x6e, 0xb7, 0x37, 0xa1, 0x3d, 0x3b, 0xa7, 0x23,
+  0x78, 0xc9, 0x96, 0xd3, 0x6d, 0xf4, 0xdc, 0x22, 0xa4, 0xbf, 0x9b, 0xd3,
+  0x8a, 0x69, 0xde, 0xe4, 0xda, 0xff, 0x43, 0xd1, 0x4f, 0x80, 0x93, 0x88,
+  0x8c
+};
 #endif // TOUCH_UI_UTF8_FRACTIONS
 
 #if ENABLED(TOUCH_UI_UTF8_SYMBOLS)
-  /* 38 MICRON_SIGN */
-  0xFF, 0x00, 0x1F, 0x00, 0x01, 0x02, 0x01, 0x44, 0x01, 0x40, 0x05, 0x00,
-  0x01, 0x14, 0x01, 0x44, 0x01, 0x10, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF,
-  0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00,
-  0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF,
-  0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00,
-  0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF,
-  0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00,
-  0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF,
-  0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00,
-  0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x05, 0x00, 0x01, 0x4F, 0x01, 0xFF,
-  0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF4, 0x05, 0x00,
-  0x01, 0x6F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF6, 0x05, 0x00, 0x01, 0x9F, 0x01, 0xFF, 0x01, 0x70, 0x08, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xFA, 0x05, 0x00, 0x01, 0xEF, 0x01, 0xFF,
-  0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x02, 0xFF, 0x01, 0x20, 0x03, 0x00,
-  0x01, 0x07, 0x02, 0xFF, 0x01, 0x70, 0x08, 0x00, 0x01, 0x07, 0x02, 0xFF,
-  0x01, 0xD2, 0x03, 0x00, 0x01, 0x6F, 0x02, 0xFF, 0x01, 0xA0, 0x08, 0x00,
-  0x01, 0x07, 0x03, 0xFF, 0x01, 0xA6, 0x01, 0x55, 0x01, 0x8D, 0x03, 0xFF,
-  0x01, 0xF9, 0x01, 0xA4, 0x07, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF7,
-  0x05, 0xFF, 0x01, 0x5D, 0x02, 0xFF, 0x01, 0xF4, 0x07, 0x00, 0x01, 0x07,
-  0x01, 0xFF, 0x01, 0xF3, 0x01, 0x5F, 0x03, 0xFF, 0x01, 0xF5, 0x01, 0x06,
-  0x02, 0xFF, 0x01, 0xF4, 0x07, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3,
-  0x01, 0x01, 0x01, 0x7C, 0x01, 0xDD, 0x01, 0xC7, 0x01, 0x10, 0x01, 0x00,
-  0x01, 0x6C, 0x01, 0xDB, 0x01, 0x50, 0x07, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF3, 0x10, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x10, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x10, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF3, 0x10, 0x00, 0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x10, 0x00,
-  0x01, 0x07, 0x01, 0xFF, 0x01, 0xF3, 0x10, 0x00, 0x01, 0x07, 0x01, 0xFF,
-  0x01, 0xF3, 0x10, 0x00, 0x01, 0x07, 0x01, 0xEE, 0x01, 0xE3, 0x35, 0x00,
-
-  /* 39 PILCROW_SIGN */
-  0x9C, 0x00, 0x01, 0x16, 0x01, 0x9B, 0x04, 0xCC, 0x01, 0xCA, 0x0B, 0x00,
-  0x01, 0x19, 0x06, 0xFF, 0x01, 0xFD, 0x0A, 0x00, 0x01, 0x03, 0x01, 0xEF,
-  0x03, 0xFF, 0x01, 0xFB, 0x01, 0xAA, 0x01, 0xAF, 0x01, 0xFD, 0x0A, 0x00,
-  0x01, 0x2E, 0x04, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD,
-  0x0A, 0x00, 0x01, 0xBF, 0x04, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F,
-  0x01, 0xFD, 0x09, 0x00, 0x01, 0x03, 0x05, 0xFF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x09, 0x00, 0x01, 0x08, 0x05, 0xFF, 0x01, 0xF2,
-  0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD, 0x09, 0x00, 0x01, 0x0B, 0x05, 0xFF,
-  0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD, 0x09, 0x00, 0x01, 0x0C,
-  0x05, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD, 0x09, 0x00,
-  0x01, 0x0B, 0x05, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD,
-  0x09, 0x00, 0x01, 0x0A, 0x05, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F,
-  0x01, 0xFD, 0x09, 0x00, 0x01, 0x06, 0x05, 0xFF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0A, 0x00, 0x01, 0xEF, 0x04, 0xFF, 0x01, 0xF2,
-  0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD, 0x0A, 0x00, 0x01, 0x6F, 0x04, 0xFF,
-  0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD, 0x0A, 0x00, 0x01, 0x08,
-  0x04, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD, 0x0B, 0x00,
-  0x01, 0x5E, 0x03, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F, 0x01, 0xFD,
-  0x0C, 0x00, 0x01, 0x6B, 0x02, 0xFF, 0x01, 0xF2, 0x01, 0x00, 0x01, 0x0F,
-  0x01, 0xFD, 0x0D, 0x00, 0x01, 0x01, 0x01, 0xCF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0xBF, 0x01, 0xF2, 0x01, 0x00,
-  0x01, 0x0F, 0x01, 0xFD, 0x0E, 0x00, 0x01, 0x34, 0x01, 0x40, 0x01, 0x00,
-  0x01, 0x04, 0x01, 0x43, 0x7A, 0x00,
-
-  /* 40 BROKEN_BAR */
-  0xAD, 0x00, 0x01, 0x07, 0x01, 0x99, 0x01, 0x60, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x08, 0x01, 0xBB, 0x01, 0x70, 0x6F, 0x00, 0x01, 0x0B,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0,
-  0x10, 0x00, 0x01, 0x0C, 0x01, 0xFF, 0x01, 0xA0, 0x10, 0x00, 0x01, 0x04,
-  0x01, 0x55, 0x01, 0x30, 0x47, 0x00,
-
-  /* 41 SECTION_SIGN */
-  0x89, 0x00, 0x01, 0x35, 0x01, 0x64, 0x01, 0x31, 0x0E, 0x00, 0x01, 0x01,
-  0x01, 0x9E, 0x03, 0xFF, 0x01, 0xD9, 0x01, 0x30, 0x0C, 0x00, 0x01, 0x2E,
-  0x05, 0xFF, 0x01, 0xB0, 0x0C, 0x00, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xFB,
-  0x01, 0x98, 0x01, 0xAE, 0x01, 0xFF, 0x01, 0xB0, 0x0B, 0x00, 0x01, 0x07,
-  0x01, 0xFF, 0x01, 0xFC, 0x01, 0x10, 0x02, 0x00, 0x01, 0x39, 0x01, 0xA0,
-  0x0B, 0x00, 0x01, 0x0B, 0x01, 0xFF, 0x01, 0xF2, 0x10, 0x00, 0x01, 0x0C,
-  0x01, 0xFF, 0x01, 0xF0, 0x10, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xF3,
-  0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0x20, 0x10, 0x00,
-  0x01, 0xDF, 0x01, 0xFF, 0x01, 0xE4, 0x10, 0x00, 0x01, 0x1D, 0x02, 0xFF,
-  0x01, 0xA1, 0x0F, 0x00, 0x01, 0x4E, 0x03, 0xFF, 0x01, 0x70, 0x0D, 0x00,
-  0x01, 0x06, 0x01, 0xFF, 0x01, 0xF9, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xFD,
-  0x01, 0x30, 0x0C, 0x00, 0x01, 0x3F, 0x01, 0xFF, 0x01, 0x60, 0x01, 0x07,
-  0x02, 0xFF, 0x01, 0xF8, 0x0C, 0x00, 0x01, 0xBF, 0x01, 0xF9, 0x02, 0x00,
-  0x01, 0x19, 0x02, 0xFF, 0x01, 0xC0, 0x0B, 0x00, 0x01, 0xFF, 0x01, 0xF3,
-  0x03, 0x00, 0x01, 0x4E, 0x01, 0xFF, 0x01, 0xFB, 0x0A, 0x00, 0x01, 0x01,
-  0x01, 0xFF, 0x01, 0xF2, 0x03, 0x00, 0x01, 0x01, 0x01, 0xDF, 0x01, 0xFF,
-  0x01, 0x40, 0x09, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x01, 0xF7, 0x04, 0x00,
-  0x01, 0x2F, 0x01, 0xFF, 0x01, 0x90, 0x0A, 0x00, 0x01, 0xDF, 0x01, 0xFF,
-  0x01, 0x20, 0x03, 0x00, 0x01, 0x0A, 0x01, 0xFF, 0x01, 0xB0, 0x0A, 0x00,
-  0x01, 0x6F, 0x01, 0xFF, 0x01, 0xF5, 0x03, 0x00, 0x01, 0x08, 0x01, 0xFF,
-  0x01, 0xA0, 0x0A, 0x00, 0x01, 0x0A, 0x02, 0xFF, 0x01, 0x91, 0x02, 0x00,
-  0x01, 0x0C, 0x01, 0xFF, 0x01, 0x70, 0x0B, 0x00, 0x01, 0x8F, 0x01, 0xFF,
-  0x01, 0xFE, 0x01, 0x60, 0x01, 0x00, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0x10,
-  0x0B, 0x00, 0x01, 0x03, 0x01, 0xDF, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0x46,
-  0x01, 0xFF, 0x01, 0xF5, 0x0D, 0x00, 0x01, 0x07, 0x04, 0xFF, 0x01, 0x50,
-  0x0E, 0x00, 0x01, 0x2A, 0x02, 0xFF, 0x01, 0xF5, 0x10, 0x00, 0x01, 0x4E,
-  0x01, 0xFF, 0x01, 0xFE, 0x01, 0x20, 0x0F, 0x00, 0x01, 0x01, 0x01, 0xCF,
-  0x01, 0xFF, 0x01, 0xC0, 0x10, 0x00, 0x01, 0x1E, 0x01, 0xFF, 0x01, 0xF3,
-  0x10, 0x00, 0x01, 0x06, 0x01, 0xFF, 0x01, 0xF6, 0x10, 0x00, 0x01, 0x05,
-  0x01, 0xFF, 0x01, 0xF6, 0x0B, 0x00, 0x01, 0x01, 0x04, 0x00, 0x01, 0x0A,
-  0x01, 0xFF, 0x01, 0xF3, 0x0B, 0x00, 0x01, 0x08, 0x01, 0xE8, 0x01, 0x20,
-  0x01, 0x00, 0x01, 0x01, 0x01, 0x8F, 0x01, 0xFF, 0x01, 0xE0, 0x0B, 0x00,
-  0x01, 0x08, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0xCB, 0x01, 0xDF, 0x02, 0xFF,
-  0x01, 0x40, 0x0B, 0x00, 0x01, 0x08, 0x05, 0xFF, 0x01, 0xF5, 0x0D, 0x00,
-  0x01, 0x49, 0x01, 0xDF, 0x02, 0xFF, 0x01, 0xE8, 0x01, 0x20, 0x0F, 0x00,
-  0x01, 0x12, 0x01, 0x21, 0x7F, 0x00,
-
-  /* 42 NOT_SIGN */
-  0xFF, 0x00, 0x7F, 0x00, 0x01, 0x12, 0x0C, 0x22, 0x06, 0x00, 0x01, 0x9F,
-  0x0C, 0xFF, 0x01, 0x40, 0x05, 0x00, 0x01, 0x9F, 0x0C, 0xFF, 0x01, 0x40,
-  0x05, 0x00, 0x01, 0x9F, 0x0C, 0xFF, 0x01, 0x40, 0x05, 0x00, 0x01, 0x24,
-  0x0A, 0x44, 0x01, 0x6F, 0x01, 0xFF, 0x01, 0x40, 0x10, 0x00, 0x01, 0x2F,
-  0x01, 0xFF, 0x01, 0x40, 0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0x40,
-  0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0x40, 0x10, 0x00, 0x01, 0x2F,
-  0x01, 0xFF, 0x01, 0x40, 0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0x40,
-  0x10, 0x00, 0x01, 0x2F, 0x01, 0xFF, 0x01, 0x40, 0x10, 0x00, 0x01, 0x2F,
-  0x01, 0xFF, 0x01, 0x40, 0x10, 0x00, 0x01, 0x17, 0x01, 0x77, 0x01, 0x10,
-  0xFF, 0x00, 0x34, 0x00
-#endif // TOUCH_UI_UTF8_SYMBOLS
+constexpr uint32_t font_symbols_size = 4900; // Inflated size
+
+const unsigned char font_symbols[] PROGMEM = {
+  0x78, 0xda, 0xed, 0xd6, 0xbf, 0x4b, 0xc2, 0x41, 0x14, 0x00, 0xf0, 0xfb,
+  0xa6, 0xa9, 0xa8, 0x90, 0x48, 0x14, 0x0d, 0x85, 0x45, 0x53, 0x43, 0x3f,
+  0xa0, 0x86, 0xa6, 0x84, 0x24, 0x68, 0x31, 0x17, 0xc7, 0xca, 0xa1, 0xad,
+  0x40, 0xb7, 0x96, 0xfe, 0x85, 0xb0, 0xb6, 0x22, 0x48, 0x83, 0x68, 0x68,
+  0x28, 0xf7, 0x06, 0xdb, 0x82, 0x0a, 0x84, 0xb6, 0x88, 0x30, 0xa8, 0xc1,
+  0x29, 0xc3, 0x52, 0x33, 0xd3, 0xd7, 0x79, 0x9a, 0xdd, 0xfb, 0xde, 0x0d,
+  0x96, 0x83, 0x21, 0xf7, 0x06, 0x0f, 0x3e, 0x1c, 0xc7, 0x7b, 0xef, 0xbe,
+  0xe7, 0x1d, 0x21, 0x2a, 0x1a, 0x8e, 0x0e, 0x8f, 0x9b, 0x8d, 0xdd, 0x1e,
+  0x47, 0xdd, 0xcc, 0xf0, 0xca, 0xc6, 0x05, 0x08, 0x29, 0x43, 0xf6, 0xc6,
+  0xc6, 0x20, 0xb2, 0x1c, 0x1b, 0x23, 0xc8, 0x3e, 0xd8, 0x98, 0x46, 0x06,
+  0xae, 0xea, 0x80, 0xec, 0x86, 0x2d, 0x07, 0x51, 0xde, 0xe0, 0xc8, 0xbf,
+  0x49, 0x7f, 0x0b, 0x87, 0x3f, 0x96, 0x87, 0x4a, 0x2c, 0x42, 0x2d, 0x81,
+  0x6a, 0x7e, 0xcb, 0x94, 0xb2, 0x26, 0x6c, 0xda, 0xc6, 0xfd, 0x85, 0x83,
+  0xac, 0xdd, 0xf9, 0xf4, 0x75, 0xf0, 0xd1, 0x32, 0x7b, 0x7e, 0x6c, 0xe7,
+  0xa3, 0xd4, 0xb3, 0x77, 0x4d, 0xe3, 0x92, 0xa7, 0x3e, 0xb6, 0x6f, 0x50,
+  0xe2, 0xc8, 0x90, 0xa6, 0x50, 0x3c, 0x3e, 0xe5, 0x6d, 0xb4, 0x32, 0x29,
+  0x43, 0xba, 0x78, 0x8b, 0x8b, 0x66, 0x00, 0xd1, 0x2c, 0x12, 0xb3, 0x49,
+  0xcc, 0xde, 0xe0, 0x3c, 0xab, 0xc4, 0x4c, 0x12, 0x23, 0x69, 0x89, 0x05,
+  0x25, 0x66, 0x91, 0x18, 0x59, 0x92, 0x18, 0x59, 0x95, 0x18, 0xd1, 0x12,
+  0xa2, 0x91, 0xb8, 0xb2, 0xa6, 0x6c, 0xd2, 0x4d, 0x8c, 0xb3, 0xea, 0xee,
+  0xfb, 0x53, 0x98, 0x77, 0x03, 0x82, 0xd9, 0xb9, 0x3f, 0x70, 0x65, 0xdc,
+  0xd9, 0x3f, 0x0b, 0xb5, 0x64, 0x8f, 0x6c, 0xaa, 0xf7, 0x0d, 0x9b, 0xd1,
+  0x3f, 0xde, 0xc6, 0xa7, 0x75, 0x6a, 0x65, 0x42, 0x27, 0xda, 0x3e, 0xbd,
+  0x7b, 0x6e, 0x71, 0xcd, 0xec, 0xfe, 0x85, 0x18, 0xb2, 0x34, 0x14, 0x77,
+  0x4e, 0xb0, 0x99, 0xe1, 0x93, 0x3e, 0x92, 0xa7, 0xa3, 0xf8, 0x53, 0xcb,
+  0x48, 0xda, 0xfc, 0x22, 0x98, 0x55, 0xf2, 0x1e, 0x32, 0x41, 0xc9, 0x25,
+  0x60, 0x12, 0x9e, 0x04, 0xeb, 0x07, 0x38, 0xd0, 0x9b, 0x17, 0xf8, 0xa7,
+  0x64, 0x6d, 0xbd, 0x42, 0x12, 0x4a, 0xb8, 0xb4, 0x19, 0x08, 0xd0, 0x27,
+  0xe5, 0x3b, 0xbe, 0x12, 0x0a, 0xec, 0x65, 0x72, 0xce, 0x1b, 0x4b, 0xcf,
+  0x0b, 0x45, 0xbe, 0x53, 0xac, 0x34, 0x2d, 0x09, 0x6e, 0xde, 0xf2, 0x95,
+  0x61, 0x0c, 0xb6, 0x50, 0xca, 0x2e, 0x56, 0x61, 0x0c, 0x3d, 0x05, 0xb2,
+  0xec, 0xf2, 0x8f, 0xa2, 0x1e, 0xc0, 0x76, 0xa5, 0x3b, 0x28, 0xed, 0x30,
+  0x94, 0x03, 0x74, 0xb6, 0x83, 0x37, 0x03, 0x2d, 0x63, 0x8e, 0x2d, 0x80,
+  0xba, 0x4f, 0xc3, 0xa7, 0xeb, 0xc2, 0x08, 0xe8, 0xa7, 0xb1, 0x32, 0xca,
+  0x42, 0x5f, 0xb5, 0x04, 0xae, 0x97, 0xc5, 0x80, 0x74, 0x53, 0x72, 0x82,
+  0x75, 0x62, 0xd3, 0x24, 0x1b, 0x6a, 0x49, 0xb9, 0x88, 0x16, 0x86, 0x07,
+  0x64, 0x50, 0xbe, 0x4a, 0x02, 0xdf, 0xbe, 0xef, 0xf7, 0x9a, 0x2e, 0xe7,
+  0x79, 0x3a, 0x2b, 0x25, 0xa4, 0xec, 0x1c, 0x54, 0xb7, 0xad, 0x0a, 0x59,
+  0x38, 0x87, 0xb8, 0xa8, 0x59, 0x04, 0xb8, 0x70, 0xff, 0xce, 0x86, 0x3d,
+  0xf5, 0x08, 0xe2, 0xcf, 0x95, 0x54, 0x4f, 0xfb, 0xff, 0xb1, 0xde, 0x75,
+  0x87, 0xda, 0xff, 0xe6, 0xe3, 0x0b, 0x59, 0x06, 0x02, 0xaa
 };
+#endif // TOUCH_UI_UTF8_SYMBOLS
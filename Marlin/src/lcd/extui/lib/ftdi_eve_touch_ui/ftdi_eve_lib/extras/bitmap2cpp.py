@@ -16,9 +16,10 @@
 # location: <https://www.gnu.org/licenses/>.
 
 from __future__ import print_function
-from PIL import Image
 import argparse
 import textwrap
+import zlib
+import re
 
 def pack_rle(data):
   """Use run-length encoding to pack the bytes"""
@@ -37,17 +38,57 @@ def pack_rle(data):
   rle.append(value)
   return rle
 
+def unpack_rle(data):
+  """Expand (count, value) pairs back into bytes"""
+  raw = []
+  for count, value in zip(data[0::2], data[1::2]):
+    raw += [value] * count
+  return raw
+
+def read_rle_groups(filename):
+  """Read back the RLE bytes from a header previously written by this tool,
+     split into the glyph groups wrapped in '#if ENABLED(...)' blocks"""
+  with open(filename) as f:
+    src = f.read()
+  src = src[src.rindex('PROGMEM = {'):]
+  src = src[:src.index('};')]
+  src = re.sub(r'/\*.*?\*/', '', src, flags=re.S)
+  groups = [[None, []]]
+  for line in src.split('\n'):
+    m = re.match(r'\s*#if ENABLED\((\w+)\)', line)
+    if m:
+      groups.append([m.group(1), []])
+    elif re.match(r'\s*#endif', line):
+      groups.append([None, []])
+    else:
+      groups[-1][1] += [int(i, 16) for i in re.findall(r'0x[0-9a-fA-F]+', line)]
+  return [g for g in groups if len(g[1])]
+
+def align_rows(raw, row_bytes):
+  """Pad each row of packed bytes with blank pixels to a multiple of 4 bytes,
+     so every glyph cell, and every group of cells, is 4-byte aligned"""
+  stride = (row_bytes + 3) & ~3
+  out = []
+  for i in range(0, len(raw), row_bytes):
+    row = raw[i:i + row_bytes]
+    out += row + [0] * (stride - len(row))
+  return out
+
 class WriteSource:
-  def __init__(self, lines_in_blocks):
+  def __init__(self, lines_in_blocks, name = 'font', deflate = False, align = False):
     self.blocks      = []
     self.values      = []
     self.block_size  = lines_in_blocks
     self.rows        = 0
+    self.row_start   = 0
+    self.name        = name
+    self.deflate     = deflate
+    self.align       = align
 
   def add_pixel(self, value):
     self.values.append(value)
 
-  def convert_to_4bpp(self, data, chunk_size = 0):
+  def pack_4bpp(self, data):
     # Invert the image
     data = list(map(lambda i: 255 - i, data))
     # Quanitize 8-bit values into 4-bits
@@ -57,9 +98,11 @@ class WriteSource:
       data.append(0)
     # Combine each two adjacent values into one
     i = iter(data)
-    data = list(map(lambda a, b: a << 4 | b, i ,i))
+    return list(map(lambda a, b: a << 4 | b, i ,i))
+
+  def convert_to_4bpp(self, data, chunk_size = 0):
     # Pack the data
-    data = pack_rle(data)
+    data = pack_rle(self.pack_4bpp(data))
     # Convert values into hex strings
     return list(map(lambda a: "0x" + format(a, '02x'), data))
 
@@ -68,15 +111,28 @@ class WriteSource:
     if len(self.values) & 1:
       self.values.append(0)
 
+    # Pad each row with white to a multiple of 4 bytes (8 values)
+    if self.align:
+      while (len(self.values) - self.row_start) % 8:
+        self.values.append(255)
+
     self.rows += 1
     if self.block_size and (self.rows % self.block_size) == 0:
       self.blocks.append(self.values)
       self.values = []
+    self.row_start = len(self.values)
 
   def write(self):
     if len(self.values):
       self.blocks.append(self.values)
 
+    if self.deflate:
+      raw = []
+      for b in self.blocks:
+        raw += self.pack_4bpp(b)
+      write_deflate(raw, self.name)
+      return
+
     block_strs = [];
     for b in self.blocks:
       data = self.convert_to_4bpp(b)
@@ -84,7 +140,7 @@ class WriteSource:
       data = textwrap.fill(data, 75, initial_indent = '  ', subsequent_indent = '  ')
       block_strs.append(data)
 
-    print("const unsigned char font[] PROGMEM = {")
+    print("const unsigned char {}[] PROGMEM = {{".format(self.name))
     for i, b in enumerate(block_strs):
       if i:
         print(',')
@@ -92,13 +148,48 @@ class WriteSource:
       print(b, end='')
     print("\n};")
 
+def write_deflate(raw, name):
+  """Write the bytes as a zlib stream, which CMD_INFLATE expands into RAMG"""
+  data = zlib.compress(bytes(bytearray(raw)), 9)
+  data = ', '.join(map(lambda a: "0x" + format(a, '02x'), bytearray(data)))
+  data = textwrap.fill(data, 75, initial_indent = '  ', subsequent_indent = '  ')
+  print("constexpr uint32_t {}_size = {}; // Inflated size\n".format(name, len(raw)))
+  print("const unsigned char {}[] PROGMEM = {{".format(name))
+  print(data)
+  print("};")
+
 if __name__ == "__main__":
-  parser = argparse.ArgumentParser(description='Converts a grayscale bitmap into a 16-level RLE packed C array for use as font data')
-  parser.add_argument("input")
+  parser = argparse.ArgumentParser(description='Converts a grayscale bitmap into a 16-level RLE or zlib packed C array for use as font data')
+  parser.add_argument("input", help='Image file, or a header previously written by this tool')
   parser.add_argument('--char_height', help='Adds a separator every so many lines', type=int)
+  parser.add_argument('--name', help='Name of the C array', default='font')
+  parser.add_argument('--deflate', help='Compress with zlib for CMD_INFLATE instead of RLE', action='store_true')
+  parser.add_argument('--align_rows', help='Pad each row to a multiple of 4 bytes', action='store_true')
+  parser.add_argument('--row_bytes', help='Bytes per row in a header being repacked, for --align_rows', type=int)
   args = parser.parse_args()
 
-  writer = WriteSource(args.char_height)
+  if args.input.endswith('.h'):
+    # Repack the RLE data from an existing header. Each optional group of
+    # glyphs gets its own stream, so only the enabled ones are inflated.
+    if args.align_rows and not args.row_bytes:
+      parser.error('--align_rows needs --row_bytes to repack a header')
+    for i, (option, data) in enumerate(read_rle_groups(args.input)):
+      raw = unpack_rle(data)
+      if args.align_rows:
+        raw = align_rows(raw, args.row_bytes)
+      if i:
+        print()
+      if option:
+        print("#if ENABLED({})".format(option))
+        write_deflate(raw, args.name + '_' + option.split('_')[-1].lower())
+        print("#endif // {}".format(option))
+      else:
+        write_deflate(raw, args.name)
+    exit()
+
+  from PIL import Image
+
+  writer = WriteSource(args.char_height, args.name, args.deflate, args.align_rows)
 
   img = Image.open(args.input).convert('L')
   for y in range(img.height):
@@ -143,6 +143,14 @@ namespace ExtUI {
     inline uint32_t getProgress_seconds_remaining() { return ui.get_remaining_time(); }
   #endif
 
+  #if ENABLED(PRINT_TIME_ESTIMATOR)
+    // Shadow planner estimate for the SD print. The total is extrapolated until isPrintTimeEstimateFinal().
+    inline bool hasPrintTimeEstimate() { return time_estimator.active(); }
+    inline bool isPrintTimeEstimateFinal() { return time_estimator.final(); }
+    inline uint32_t getPrintTimeEstimate_seconds_remaining() { return time_estimator.remaining(); }
+    inline uint32_t getPrintTimeEstimate_seconds_total() { return time_estimator.total(); }
+  #endif
+
   #if HAS_LEVELING
     bool getLevelingActive();
     void setLevelingActive(const bool);
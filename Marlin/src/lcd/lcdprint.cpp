@@ -52,7 +52,13 @@ lcd_uint_t lcd_put_u8str_ind_P(PGM_P const pstr, const int8_t ind, PGM_P const i
         if (ch == '*') { lcd_put_wchar('E'); n--; }
         if (n) {
           int8_t inum = ind + ((ch == '=') ? 0 : LCD_FIRST_TOOL);
-          if (inum >= 10) {
+          if (inum >= 100) {
+            lcd_put_wchar('0' + (inum / 100)); n--;
+            inum %= 100;
+            if (n) { lcd_put_wchar('0' + (inum / 10)); n--; }
+            inum %= 10;
+          }
+          else if (inum >= 10) {
             lcd_put_wchar('0' + (inum / 10)); n--;
             inum %= 10;
           }
@@ -131,6 +131,9 @@ constexpr uint8_t epps = ENCODER_PULSES_PER_STEP;
 
 #if HAS_MARLINUI_U8GLIB
   #include "dogm/marlinui_DOGM.h"
+  #if ENABLED(DOGM_PARTIAL_REFRESH)
+    #include "dogm/u8g_page_diff.h"
+  #endif
 #endif
 
 #include "lcdprint.h"
@@ -832,11 +835,25 @@ inline bool can_encode() {
   return !BUTTON_PRESSED(ENC_EN); // Update encoder only when ENC_EN is not LOW (pressed)
 }
 
+#if BOTH(SHOW_BOOTSCREEN, DEFERRED_STARTUP)
+  millis_t MarlinUI::bootscreen_hold_ms; // = 0
+#endif
+
 void MarlinUI::update() {
 
   static uint16_t max_display_update_time = 0;
   millis_t ms = millis();
 
+  #if BOTH(SHOW_BOOTSCREEN, DEFERRED_STARTUP)
+    // Leave the bootscreen up until its time is up
+    if (bootscreen_hold_ms) {
+      if (PENDING(ms, bootscreen_hold_ms)) return;
+      bootscreen_hold_ms = 0;
+      clear_lcd();
+      refresh(LCDVIEW_CLEAR_CALL_REDRAW);
+    }
+  #endif
+
   #if HAS_LCD_MENU && LCD_TIMEOUT_TO_STATUS > 0
     #define RESET_STATUS_TIMEOUT() (return_to_status_ms = ms + LCD_TIMEOUT_TO_STATUS)
   #else
@@ -1045,7 +1062,10 @@ void MarlinUI::update() {
           const bool in_status = on_status_screen(),
                      do_u8g_loop = !in_status;
           lcd_in_status(in_status);
-          if (in_status) status_screen();
+          if (in_status) {
+            status_screen();
+            TERN_(DOGM_PARTIAL_REFRESH, u8g_page_diff_reset()); // The lite status screen draws around u8g
+          }
         #else
           constexpr bool do_u8g_loop = true;
         #endif
@@ -1495,7 +1515,7 @@ void MarlinUI::update() {
     #ifdef ACTION_ON_CANCEL
       host_action_cancel();
     #endif
-    IF_DISABLED(SDSUPPORT, print_job_timer.stop());
+    IF_DISABLED(SDSUPPORT, print_job_timer.TERN(PRINTCOUNTER_HISTOGRAMS, abort, stop)()); // The histograms count canceled jobs
     TERN_(HOST_PROMPT_SUPPORT, host_prompt_open(PROMPT_INFO, PSTR("UI Aborted"), DISMISS_STR));
     LCD_MESSAGEPGM(MSG_PRINT_ABORTED);
     TERN_(HAS_LCD_MENU, return_to_status());
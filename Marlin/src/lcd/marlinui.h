@@ -246,6 +246,7 @@ public:
       static void progress_reset() { if (progress_override & (PROGRESS_MASK + 1U)) set_progress(0); }
       #if ENABLED(SHOW_REMAINING_TIME)
         static inline uint32_t _calculated_remaining_time() {
+          TERN_(PRINT_TIME_ESTIMATOR, if (time_estimator.active()) return time_estimator.remaining());
           const duration_t elapsed = print_job_timer.duration();
           const progress_t progress = _get_progress();
           return progress ? elapsed.value * (100 * (PROGRESS_SCALE) - progress) / progress : 0;
@@ -325,6 +326,10 @@ public:
         static void draw_marlin_bootscreen(const bool line2=false);
         static void show_marlin_bootscreen();
         static void show_bootscreen();
+        #if ENABLED(DEFERRED_STARTUP)
+          static millis_t bootscreen_hold_ms;   // The bootscreen stays up until this time
+          static inline void bootscreen_hold(const millis_t ms) { bootscreen_hold_ms = millis() + ms; }
+        #endif
       #endif
 
       #if HAS_MARLINUI_U8GLIB
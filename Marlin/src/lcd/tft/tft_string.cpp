@@ -105,7 +105,8 @@ void TFT_String::add(uint8_t *string, int8_t index, uint8_t *itemString) {
       if (index >= 0) {
         int8_t inum = index + ((ch == '=') ? 0 : LCD_FIRST_TOOL);
         if (ch == '*') add_character('E');
-        if (inum >= 10) { add_character('0' + (inum / 10)); inum %= 10; }
+        if (inum >= 100) { add_character('0' + (inum / 100)); inum %= 100; add_character('0' + (inum / 10)); inum %= 10; }
+        else if (inum >= 10) { add_character('0' + (inum / 10)); inum %= 10; }
         add_character('0' + inum);
       }
       else {
@@ -81,8 +81,12 @@ void MarlinUI::tft_idle() {
     #endif
 
     tft.queue.sync();
-    safe_delay(BOOTSCREEN_TIMEOUT);
-    clear_lcd();
+    #if ENABLED(DEFERRED_STARTUP)
+      bootscreen_hold(BOOTSCREEN_TIMEOUT);  // Cleared by update() when the time is up
+    #else
+      safe_delay(BOOTSCREEN_TIMEOUT);
+      clear_lcd();
+    #endif
   }
 #endif
 
@@ -23,7 +23,8 @@
 
 #include "../inc/MarlinConfig.h"
 
-template <typename Helper>
+// INTERVAL_MS is the length of one interval unit, one second by default
+template <typename Helper, const millis_t INTERVAL_MS=1000UL>
 struct AutoReporter {
   millis_t next_report_ms;
   uint8_t report_interval;
@@ -32,16 +33,16 @@ struct AutoReporter {
     AutoReporter() : report_port_mask(SERIAL_ALL) {}
   #endif
 
-  inline void set_interval(uint8_t seconds, const uint8_t limit=60) {
-    report_interval = _MIN(seconds, limit);
-    next_report_ms = millis() + SEC_TO_MS(seconds);
+  inline void set_interval(uint8_t interval, const uint8_t limit=60) {
+    report_interval = _MIN(interval, limit);
+    next_report_ms = millis() + millis_t(interval) * INTERVAL_MS;
   }
 
   inline void tick() {
     if (!report_interval) return;
     const millis_t ms = millis();
     if (ELAPSED(ms, next_report_ms)) {
-      next_report_ms = ms + SEC_TO_MS(report_interval);
+      next_report_ms = ms + millis_t(report_interval) * INTERVAL_MS;
       PORT_REDIRECT(report_port_mask);
       Helper::report();
       //PORT_RESTORE();
@@ -22,7 +22,7 @@
 
 #include "../../inc/MarlinConfigPre.h"
 
-#if ENABLED(BINARY_FILE_TRANSFER)
+#if EITHER(BINARY_FILE_TRANSFER, GCODE_HEATSHRINK)
 
 /**
  * libs/heatshrink/heatshrink_decoder.cpp
@@ -116,6 +116,7 @@ void heatshrink_decoder_reset(heatshrink_decoder *hsd) {
   hsd->input_index = 0;
   hsd->bit_index = 0x00;
   hsd->current_byte = 0x00;
+  hsd->input_buf = nullptr;
   hsd->output_count = 0;
   hsd->output_index = 0;
   hsd->head_index = 0;
@@ -159,6 +160,9 @@ static HSD_state st_backref_count_msb(heatshrink_decoder *hsd);
 static HSD_state st_backref_count_lsb(heatshrink_decoder *hsd);
 static HSD_state st_yield_backref(heatshrink_decoder *hsd, output_info *oi);
 
+/* Run the state machine until the input is exhausted or the output is full. */
+static HSD_poll_res decode(heatshrink_decoder *hsd, output_info *oi);
+
 HSD_poll_res heatshrink_decoder_poll(heatshrink_decoder *hsd, uint8_t *out_buf, size_t out_buf_size, size_t *output_size) {
   if (!hsd || !out_buf || !output_size)
     return HSDR_POLL_ERROR_NULL;
@@ -170,6 +174,45 @@ HSD_poll_res heatshrink_decoder_poll(heatshrink_decoder *hsd, uint8_t *out_buf,
   oi.buf_size = out_buf_size;
   oi.output_size = output_size;
 
+  return decode(hsd, &oi);
+}
+
+HSD_poll_res heatshrink_decoder_inflate(heatshrink_decoder *hsd, const uint8_t *in_buf, size_t size, heatshrink_sink *sink) {
+  if (!hsd || !in_buf || !sink || !sink->flush)
+    return HSDR_POLL_ERROR_NULL;
+  if (hsd->input_size) return HSDR_POLL_ERROR_UNKNOWN;
+
+  output_info oi;
+  oi.buf = sink->buf;
+  oi.buf_size = sink->size;
+  oi.output_size = &sink->count;
+
+  while (size) {
+    /* Point the decoder at the caller's input instead of copying it in */
+    const uint16_t chunk = size < 0xFFFF ? size : 0xFFFF;
+    hsd->input_buf = in_buf;
+    hsd->input_index = 0;
+    hsd->input_size = chunk;
+
+    for (;;) {
+      const HSD_poll_res res = decode(hsd, &oi);
+      if (res == HSDR_POLL_EMPTY) break;
+      if (res < 0 || !sink->flush(sink)) {
+        hsd->input_buf = nullptr;
+        hsd->input_index = hsd->input_size = 0;
+        return res < 0 ? res : HSDR_POLL_ERROR_UNKNOWN;
+      }
+    }
+
+    in_buf += chunk;
+    size -= chunk;
+  }
+
+  hsd->input_buf = nullptr;
+  return HSDR_POLL_EMPTY;
+}
+
+static HSD_poll_res decode(heatshrink_decoder *hsd, output_info *oi) {
   while (1) {
     LOG("-- poll, state is %d (%s), input_size %d\n", hsd->state, state_names[hsd->state], hsd->input_size);
     uint8_t in_state = hsd->state;
@@ -178,7 +221,7 @@ HSD_poll_res heatshrink_decoder_poll(heatshrink_decoder *hsd, uint8_t *out_buf,
         hsd->state = st_tag_bit(hsd);
         break;
       case HSDS_YIELD_LITERAL:
-        hsd->state = st_yield_literal(hsd, &oi);
+        hsd->state = st_yield_literal(hsd, oi);
         break;
       case HSDS_BACKREF_INDEX_MSB:
         hsd->state = st_backref_index_msb(hsd);
@@ -193,7 +236,7 @@ HSD_poll_res heatshrink_decoder_poll(heatshrink_decoder *hsd, uint8_t *out_buf,
         hsd->state = st_backref_count_lsb(hsd);
         break;
       case HSDS_YIELD_BACKREF:
-        hsd->state = st_yield_backref(hsd, &oi);
+        hsd->state = st_yield_backref(hsd, oi);
         break;
       default:
         return HSDR_POLL_ERROR_UNKNOWN;
@@ -202,7 +245,7 @@ HSD_poll_res heatshrink_decoder_poll(heatshrink_decoder *hsd, uint8_t *out_buf,
     // If the current state cannot advance, check if input or output
     // buffer are exhausted.
     if (hsd->state == in_state)
-      return (*output_size == out_buf_size) ? HSDR_POLL_MORE : HSDR_POLL_EMPTY;
+      return (*oi->output_size == oi->buf_size) ? HSDR_POLL_MORE : HSDR_POLL_EMPTY;
   }
 }
 
@@ -323,7 +366,7 @@ static uint16_t get_bits(heatshrink_decoder *hsd, uint8_t count) {
         LOG("  -- out of bits, suspending w/ accumulator of %u (0x%02x)\n", accumulator, accumulator);
         return NO_BITS;
       }
-      hsd->current_byte = hsd->buffers[hsd->input_index++];
+      hsd->current_byte = (hsd->input_buf ? hsd->input_buf : hsd->buffers)[hsd->input_index++];
       LOG("  -- pulled byte 0x%02x\n", hsd->current_byte);
       if (hsd->input_index == hsd->input_size) {
         hsd->input_index = 0; /* input is exhausted */
@@ -381,4 +424,4 @@ static void push_byte(heatshrink_decoder *hsd, output_info *oi, uint8_t byte) {
   (void)hsd;
 }
 
-#endif // BINARY_FILE_TRANSFER
+#endif // BINARY_FILE_TRANSFER || GCODE_HEATSHRINK
@@ -75,6 +75,7 @@ typedef struct {
   uint8_t state;              /* current state machine node */
   uint8_t current_byte;       /* current byte of input */
   uint8_t bit_index;          /* current bit index */
+  const uint8_t *input_buf;   /* caller's input, decoded in place by heatshrink_decoder_inflate */
 
 #if HEATSHRINK_DYNAMIC_ALLOC
   /* Fields that are only used if dynamically allocated. */
@@ -113,6 +114,20 @@ HSD_sink_res heatshrink_decoder_sink(heatshrink_decoder *hsd, uint8_t *in_buf, s
  * OUT_BUF (setting *OUTPUT_SIZE to the actual amount copied). */
 HSD_poll_res heatshrink_decoder_poll(heatshrink_decoder *hsd, uint8_t *out_buf, size_t out_buf_size, size_t *output_size);
 
+/* Output for heatshrink_decoder_inflate. Decoded bytes go straight into BUF,
+ * advancing COUNT. Once BUF holds SIZE bytes FLUSH is called to consume them
+ * and make room, usually by resetting COUNT. It returns false on failure. */
+typedef struct heatshrink_sink {
+  uint8_t *buf;
+  size_t size, count;
+  bool (*flush)(struct heatshrink_sink *sink);
+} heatshrink_sink;
+
+/* Decode all SIZE bytes of IN_BUF in one call, reading them in place and
+ * writing the output into SINK. Bytes left in SINK (COUNT) are kept for the
+ * next call. Don't use while input sunk by heatshrink_decoder_sink remains. */
+HSD_poll_res heatshrink_decoder_inflate(heatshrink_decoder *hsd, const uint8_t *in_buf, size_t size, heatshrink_sink *sink);
+
 /* Notify the dencoder that the input stream is finished.
  * If the return value is HSDR_FINISH_MORE, there is still more output, so
  * call heatshrink_decoder_poll and repeat. */
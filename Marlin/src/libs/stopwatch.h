@@ -57,6 +57,7 @@ class Stopwatch {
      */
     static bool stop();
     static inline bool abort() { return stop(); } // Alias by default
+    static inline bool halt()  { return stop(); } // Alias by default
 
     /**
      * @brief Pause the stopwatch
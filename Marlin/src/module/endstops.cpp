@@ -398,7 +398,7 @@ void Endstops::event_handler() {
         card.endFilePrint();
         quickstop_stepper();
         thermalManager.disable_all_heaters();
-        print_job_timer.stop();
+        print_job_timer.halt();
       }
     #endif
   }
@@ -647,6 +647,11 @@ void Endstops::update() {
     #endif
   #endif
 
+  #if BOTH(PROBE_STEP_LATCH, ENDSTOP_INTERRUPTS_FEATURE)
+    // Called on the probe's pin-change, so latch the Z position ahead of noise filtering
+    if (z_probe_enabled) stepper.update_probe_latch(TEST(live_state, TERN(HAS_CUSTOM_PROBE_PIN, Z_MIN_PROBE, Z_MIN)));
+  #endif
+
   #if ENDSTOP_NOISE_THRESHOLD
 
     /**
@@ -107,6 +107,10 @@
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(TMC_LOAD_TELEMETRY)
+  #include "../feature/tmc_telemetry.h"
+#endif
+
 #if HAS_CUTTER
   #include "../feature/spindle_laser.h"
 #endif
@@ -1238,6 +1242,7 @@ void Planner::recalculate_trapezoids() {
 }
 
 void Planner::recalculate() {
+  HAL_PROFILE(PLANNER_RECALC);
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
@@ -1724,6 +1729,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
+  TERN_(HAL_STEP_TRACE, HAL_step_trace_planned(block_buffer_head));
+
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
@@ -2630,6 +2637,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   TERN_(HAS_POSITION_FLOAT, position_float = target_float);
   TERN_(GRADIENT_MIX, mixer.gradient_control(target_float.z));
   TERN_(POWER_LOSS_RECOVERY, block->sdpos = recovery.command_sdpos());
+  TERN_(TMC_LOAD_TELEMETRY, block->telemetry_id = tmc_telemetry.next_move_id());
 
   return true;        // Movement was accepted
 
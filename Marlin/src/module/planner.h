@@ -170,7 +170,7 @@ typedef struct block_t {
     static constexpr uint8_t extruder = 0;
   #endif
 
-  TERN_(MIXING_EXTRUDER, MIXER_BLOCK_FIELD); // Normalized color for the mixing steppers
+  TERN_(MIXING_EXTRUDER, MIXER_BLOCK_FIELD); // Schedule of the mixing steppers for E steps
 
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
@@ -226,6 +226,10 @@ typedef struct block_t {
     uint32_t sdpos;
   #endif
 
+  #if ENABLED(TMC_LOAD_TELEMETRY)
+    uint16_t telemetry_id;                  // Tags load samples taken during this block
+  #endif
+
   #if ENABLED(LASER_POWER_INLINE)
     block_laser_t laser;
   #endif
@@ -74,6 +74,48 @@ const PrintCounter::eeprom_address_t PrintCounter::address = STATS_EEPROM_ADDRES
 millis_t PrintCounter::lastDuration;
 bool PrintCounter::loaded = false;
 
+#if ENABLED(PRINTCOUNTER_RING)
+  printStatsRecord PrintCounter::record;
+  uint8_t PrintCounter::slot, // = 0
+          PrintCounter::written = sizeof(printStatsRecord);
+
+  static_assert(sizeof(printStatsRecord) < 256, "printStatsRecord is too large for PRINTCOUNTER_RING.");
+
+  // Seed the CRC so an all-zero record doesn't pass
+  inline uint16_t record_crc(const printStatsRecord &r) {
+    uint16_t crc = 0x16;
+    crc16(&crc, &r, offsetof(printStatsRecord, crc));
+    return crc;
+  }
+
+  int PrintCounter::ringAddress(const uint8_t s) {
+    return persistentStore.capacity() - (STATS_RING_SIZE) + s * sizeof(printStatsRecord);
+  }
+
+  void PrintCounter::writeRecord(const uint8_t chunk) {
+    if (written >= sizeof(printStatsRecord)) return;
+    const uint8_t n = _MIN(chunk, sizeof(printStatsRecord) - written);
+    persistentStore.access_start();
+    persistentStore.write_data(ringAddress(slot) + written, (uint8_t*)&record + written, n);
+    persistentStore.access_finish();
+    written += n;
+    #if ENABLED(EXTENSIBLE_UI)
+      if (written == sizeof(printStatsRecord)) ExtUI::onConfigurationStoreWritten(true);
+    #endif
+  }
+#endif
+
+#if ENABLED(PRINTCOUNTER_HISTOGRAMS)
+  float PrintCounter::jobFilament; // = 0
+
+  // Bin 0 is below 'base', and each following bin is twice as wide
+  static uint8_t hist_bin(uint32_t value, const uint32_t base) {
+    uint8_t b = 0;
+    for (; b < JOB_HIST_BINS - 1 && value >= base; b++) value >>= 1;
+    return b;
+  }
+#endif
+
 millis_t PrintCounter::deltaDuration() {
   TERN_(DEBUG_PRINTCOUNTER, debug(PSTR("deltaDuration")));
   millis_t tmp = lastDuration;
@@ -88,6 +130,7 @@ void PrintCounter::incFilamentUsed(float const &amount) {
   if (!isLoaded()) return;
 
   data.filamentUsed += amount; // mm
+  TERN_(PRINTCOUNTER_HISTOGRAMS, jobFilament += amount);
 }
 
 void PrintCounter::initStats() {
@@ -109,9 +152,13 @@ void PrintCounter::initStats() {
   };
 
   saveStats();
-  persistentStore.access_start();
-  persistentStore.write_data(address, (uint8_t)0x16);
-  persistentStore.access_finish();
+  #if ENABLED(PRINTCOUNTER_RING)
+    flushStats();
+  #else
+    persistentStore.access_start();
+    persistentStore.write_data(address, (uint8_t)0x16);
+    persistentStore.access_finish();
+  #endif
 }
 
 #if HAS_SERVICE_INTERVALS
@@ -129,15 +176,56 @@ void PrintCounter::initStats() {
 void PrintCounter::loadStats() {
   TERN_(DEBUG_PRINTCOUNTER, debug(PSTR("loadStats")));
 
-  // Check if the EEPROM block is initialized
-  uint8_t value = 0;
-  persistentStore.access_start();
-  persistentStore.read_data(address, &value, sizeof(uint8_t));
-  if (value != 0x16)
-    initStats();
-  else
-    persistentStore.read_data(address + sizeof(uint8_t), (uint8_t*)&data, sizeof(printStatistics));
-  persistentStore.access_finish();
+  #if ENABLED(PRINTCOUNTER_RING)
+
+    // Find the newest intact record in the ring
+    bool found = false;
+    persistentStore.access_start();
+    LOOP_L_N(s, PRINTCOUNTER_RING_SLOTS) {
+      printStatsRecord r;
+      persistentStore.read_data(ringAddress(s), (uint8_t*)&r, sizeof(r));
+      if (r.crc == record_crc(r) && (!found || int16_t(r.seq - record.seq) > 0)) {
+        record = r;
+        slot = s;
+        found = true;
+      }
+    }
+
+    if (found) {
+      data = record.data;
+      persistentStore.access_finish();
+    }
+    else {
+      // Carry over the statistics from the old single block, if there are any
+      uint8_t value = 0;
+      persistentStore.read_data(address, &value, sizeof(uint8_t));
+      if (value != 0x16) {
+        persistentStore.access_finish();
+        initStats();
+      }
+      else {
+        memset(&data, 0, sizeof(data));
+        persistentStore.read_data(address + sizeof(uint8_t), (uint8_t*)&data, TERN(PRINTCOUNTER_HISTOGRAMS, offsetof(printStatistics, hist), sizeof(printStatistics)));
+        persistentStore.access_finish();
+        loaded = true;
+        saveStats();
+      }
+    }
+
+  #else
+
+    // Check if the EEPROM block is initialized
+    uint8_t value = 0;
+    persistentStore.access_start();
+    persistentStore.read_data(address, &value, sizeof(uint8_t));
+    if (value != 0x16)
+      initStats();
+    else
+      persistentStore.read_data(address + sizeof(uint8_t), (uint8_t*)&data, sizeof(printStatistics));
+    persistentStore.access_finish();
+
+  #endif
+
   loaded = true;
 
   #if HAS_SERVICE_INTERVALS
@@ -165,16 +253,44 @@ void PrintCounter::saveStats() {
   // Refuses to save data if object is not loaded
   if (!isLoaded()) return;
 
-  TERN_(PRINTCOUNTER_SYNC, planner.synchronize());
+  #if ENABLED(PRINTCOUNTER_RING)
+
+    // Move on to the next slot, unless the last record never got finished
+    if (written >= sizeof(printStatsRecord)) slot = (slot + 1) % (PRINTCOUNTER_RING_SLOTS);
+    record.seq++;
+    record.data = data;
+    record.crc = record_crc(record);
+    written = 0;
 
-  // Saves the struct to EEPROM
-  persistentStore.access_start();
-  persistentStore.write_data(address + sizeof(uint8_t), (uint8_t*)&data, sizeof(printStatistics));
-  persistentStore.access_finish();
+    // tick() writes the record out a piece at a time
+    #if ENABLED(USE_EMULATED_EEPROM)
+      TERN_(PRINTCOUNTER_SYNC, planner.synchronize());
+      flushStats();
+    #endif
+
+  #else
 
-  TERN_(EXTENSIBLE_UI, ExtUI::onConfigurationStoreWritten(true));
+    TERN_(PRINTCOUNTER_SYNC, planner.synchronize());
+
+    // Saves the struct to EEPROM
+    persistentStore.access_start();
+    persistentStore.write_data(address + sizeof(uint8_t), (uint8_t*)&data, sizeof(printStatistics));
+    persistentStore.access_finish();
+
+    TERN_(EXTENSIBLE_UI, ExtUI::onConfigurationStoreWritten(true));
+
+  #endif
 }
 
+#if ENABLED(PRINTCOUNTER_HISTOGRAMS)
+  inline void _show_hist(PGM_P const label, const uint16_t bins[JOB_HIST_BINS]) {
+    SERIAL_ECHOPGM(STR_STATS);
+    SERIAL_ECHOPGM_P(label);
+    LOOP_L_N(b, JOB_HIST_BINS) SERIAL_ECHOPAIR(" ", bins[b]);
+    SERIAL_EOL();
+  }
+#endif
+
 #if HAS_SERVICE_INTERVALS
   inline void _service_when(char buffer[], const char * const msg, const uint32_t when) {
     SERIAL_ECHOPGM(STR_STATS);
@@ -224,9 +340,28 @@ void PrintCounter::showStats() {
   #if SERVICE_INTERVAL_3 > 0
     _service_when(buffer, PSTR(SERVICE_NAME_3), data.nextService3);
   #endif
+
+  #if ENABLED(PRINTCOUNTER_HISTOGRAMS)
+    const printHistograms &h = data.hist;
+    _show_hist(PSTR("Jobs by time (<15m, doubling):"), h.time);
+    _show_hist(PSTR("Jobs by filament (<1m, doubling):"), h.filament);
+
+    // Jobs that started but never ended were cut off by a reset or power loss
+    const uint16_t ended = h.ended[JOB_FINISHED] + h.ended[JOB_CANCELED] + h.ended[JOB_HALTED],
+                   active = (isRunning() || isPaused()) ? 1 : 0;
+    SERIAL_ECHOPGM(STR_STATS);
+    SERIAL_ECHOLNPAIR(
+      "Finished: ", h.ended[JOB_FINISHED],
+      ", Canceled: ", h.ended[JOB_CANCELED],
+      ", Halted: ", h.ended[JOB_HALTED],
+      ", Interrupted: ", h.started > ended + active ? h.started - ended - active : 0
+    );
+  #endif
 }
 
 void PrintCounter::tick() {
+  TERN_(PRINTCOUNTER_RING, writeRecord(ringChunk));
+
   if (!isRunning()) return;
 
   millis_t now = millis();
@@ -264,12 +399,18 @@ void PrintCounter::tick() {
 bool PrintCounter::start() {
   TERN_(DEBUG_PRINTCOUNTER, debug(PSTR("start")));
 
+  ensureLoaded();
+
   bool paused = isPaused();
 
   if (super::start()) {
     if (!paused) {
       data.totalPrints++;
       lastDuration = 0;
+      #if ENABLED(PRINTCOUNTER_HISTOGRAMS)
+        data.hist.started++;
+        jobFilament = 0;
+      #endif
     }
     return true;
   }
@@ -277,17 +418,23 @@ bool PrintCounter::start() {
   return false;
 }
 
-bool PrintCounter::_stop(const bool completed) {
+bool PrintCounter::_stop(const PrintJobEnd why) {
   TERN_(DEBUG_PRINTCOUNTER, debug(PSTR("stop")));
 
   const bool did_stop = super::stop();
   if (did_stop) {
     data.printTime += deltaDuration();
-    if (completed) {
+    if (why == JOB_FINISHED) {
       data.finishedPrints++;
       if (duration() > data.longestPrint)
         data.longestPrint = duration();
     }
+    #if ENABLED(PRINTCOUNTER_HISTOGRAMS)
+      printHistograms &h = data.hist;
+      h.time[hist_bin(duration(), 15 * 60)]++;
+      h.filament[hist_bin(jobFilament, 1000)]++;
+      h.ended[why]++;
+    #endif
   }
   saveStats();
   return did_stop;
@@ -31,6 +31,24 @@
 // Round up I2C / SPI address to next page boundary (assuming 32 byte pages)
 #define STATS_EEPROM_ADDRESS TERN(USE_WIRED_EEPROM, 0x40, 0x32)
 
+// How a print job came to an end
+enum PrintJobEnd : uint8_t {
+  JOB_FINISHED,   // Ran to completion
+  JOB_CANCELED,   // Canceled by the user or host
+  JOB_HALTED,     // Stopped by an error (thermal, endstop hit, etc.)
+  JOB_END_REASONS
+};
+
+#if ENABLED(PRINTCOUNTER_HISTOGRAMS)
+  #define JOB_HIST_BINS 8
+  struct printHistograms {
+    uint16_t started;                   // Jobs counted since the histograms began
+    uint16_t time[JOB_HIST_BINS];       // Jobs by duration: <15m, <30m, <1h ... <16h, longer
+    uint16_t filament[JOB_HIST_BINS];   // Jobs by filament: <1m, <2m, <4m ... <64m, longer
+    uint16_t ended[JOB_END_REASONS];    // Jobs by how they ended
+  };
+#endif
+
 struct printStatistics {    // 16 bytes
   //const uint8_t magic;    // Magic header, it will always be 0x16
   uint16_t totalPrints;     // Number of prints
@@ -47,8 +65,26 @@ struct printStatistics {    // 16 bytes
   #if SERVICE_INTERVAL_3 > 0
     uint32_t nextService3;
   #endif
+  #if ENABLED(PRINTCOUNTER_HISTOGRAMS)
+    printHistograms hist;   // Must stay last, after the fields of the original layout
+  #endif
 };
 
+#if ENABLED(PRINTCOUNTER_RING)
+  /**
+   * The statistics are kept in a ring of records at the top of the EEPROM.
+   * Each save goes to the next slot, so every slot sees only 1/N of the writes.
+   * The record with the highest valid sequence number is the current one.
+   * The CRC is written last, so a record torn by a reset is simply skipped.
+   */
+  struct printStatsRecord {
+    uint16_t seq;           // Sequence number, incremented with each save
+    printStatistics data;
+    uint16_t crc;           // CRC16 of the fields above
+  };
+  #define STATS_RING_SIZE (PRINTCOUNTER_RING_SLOTS * sizeof(printStatsRecord))
+#endif
+
 class PrintCounter: public Stopwatch {
   private:
     typedef Stopwatch super;
@@ -98,6 +134,27 @@ class PrintCounter: public Stopwatch {
      */
     static bool loaded;
 
+    #if ENABLED(PRINTCOUNTER_RING)
+      static printStatsRecord record; // The newest record, or the one being written
+      static uint8_t slot;            // Ring slot of that record
+      static uint8_t written;         // Bytes of the record already in EEPROM
+
+      /**
+       * @brief Bytes of a pending record to write per tick
+       * @details A true EEPROM blocks for several milliseconds per byte, so the
+       * record goes out in small pieces. Emulated EEPROM commits a whole page on
+       * each access, so it gets the whole record at once.
+       */
+      static constexpr uint8_t ringChunk = TERN(USE_EMULATED_EEPROM, sizeof(printStatsRecord), 4);
+
+      static int ringAddress(const uint8_t s);
+      static void writeRecord(const uint8_t chunk);
+    #endif
+
+    #if ENABLED(PRINTCOUNTER_HISTOGRAMS)
+      static float jobFilament;       // Filament used by the current job, in mm
+    #endif
+
   protected:
     /**
      * @brief dT since the last call
@@ -112,11 +169,17 @@ class PrintCounter: public Stopwatch {
     /**
      * @brief Initialize the print counter
      */
-    static inline void init() {
+    static inline void init(const bool load=true) {
       super::init();
-      loadStats();
+      if (load) loadStats();
     }
 
+    /**
+     * @brief Load the Print Statistics
+     * @details Load the statistics from EEPROM
+     */
+    static void loadStats();
+
     /**
      * @brief Check if Print Statistics has been loaded
      * @details Return true if the statistical data has been loaded.
@@ -124,6 +187,13 @@ class PrintCounter: public Stopwatch {
      */
     FORCE_INLINE static bool isLoaded() { return loaded; }
 
+    /**
+     * @brief Load the Print Statistics unless they are loaded already
+     * @details A print may start before a deferred load has run, so
+     *          start() loads them first. The later load is then skipped.
+     */
+    static inline void ensureLoaded() { if (!loaded) loadStats(); }
+
     /**
      * @brief Increment the total filament used
      * @details The total filament used counter will be incremented by "amount".
@@ -139,18 +209,20 @@ class PrintCounter: public Stopwatch {
      */
     static void initStats();
 
-    /**
-     * @brief Load the Print Statistics
-     * @details Load the statistics from EEPROM
-     */
-    static void loadStats();
-
     /**
      * @brief Save the Print Statistics
      * @details Save the statistics to EEPROM
      */
     static void saveStats();
 
+    #if ENABLED(PRINTCOUNTER_RING)
+      /**
+       * @brief Finish any pending save
+       * @details Write the rest of the pending record now, e.g., before power-off
+       */
+      static inline void flushStats() { writeRecord(sizeof(printStatsRecord)); }
+    #endif
+
     /**
      * @brief Serial output the Print Statistics
      * @details This function may change in the future, for now it directly
@@ -175,9 +247,11 @@ class PrintCounter: public Stopwatch {
      * The following functions are being overridden
      */
     static bool start();
-    static bool _stop(const bool completed);
-    static inline bool stop()  { return _stop(true);  }
-    static inline bool abort() { return _stop(false); }
+    static bool _stop(const PrintJobEnd why);
+    static inline bool stop()  { return _stop(JOB_FINISHED); }
+    static inline bool abort() { return _stop(JOB_CANCELED); }
+    // Only the job histograms count a halted job apart from a finished one
+    static inline bool halt()  { return _stop(TERN(PRINTCOUNTER_HISTOGRAMS, JOB_HALTED, JOB_FINISHED)); }
 
     static void reset();
 
@@ -48,7 +48,7 @@
   #include "delta.h"
 #endif
 
-#if ENABLED(BABYSTEP_ZPROBE_OFFSET)
+#if EITHER(BABYSTEP_ZPROBE_OFFSET, PROBE_STEP_LATCH)
   #include "planner.h"
 #endif
 
@@ -73,6 +73,10 @@
   #include "../feature/tmc_util.h"
 #endif
 
+#if ENABLED(PROBE_STEP_LATCH)
+  #include "stepper.h"
+#endif
+
 #if HAS_QUIET_PROBING
   #include "stepper/indirection.h"
 #endif
@@ -88,6 +92,10 @@ Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load()
 
+#if ENABLED(PROBE_STEP_LATCH)
+  float Probe::latched_z;
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xy_pos_t &Probe::offset_xy = Probe::offset;
 #endif
@@ -504,9 +512,18 @@ bool Probe::probe_down_to_z(const float z, const feedRate_t fr_mm_s) {
 
   TERN_(HAS_QUIET_PROBING, set_probing_paused(true));
 
+  TERN_(PROBE_STEP_LATCH, stepper.arm_probe_latch());
+
   // Move down until the probe is triggered
   do_blocking_move_to_z(z, fr_mm_s);
 
+  #if ENABLED(PROBE_STEP_LATCH)
+    // Take the latched step right away, before a stow or pin change can
+    // disturb it. This also disarms the latch for every exit path below.
+    int32_t z_steps;
+    const bool latched = stepper.probe_latched_position(z_steps);
+  #endif
+
   // Check to see if the probe was triggered
   const bool probe_triggered =
     #if BOTH(DELTA, SENSORLESS_PROBING)
@@ -540,6 +557,14 @@ bool Probe::probe_down_to_z(const float z, const feedRate_t fr_mm_s) {
   // Tell the planner where we actually are
   sync_plan_position();
 
+  #if ENABLED(PROBE_STEP_LATCH)
+    // The steppers stop some steps after the trigger, depending on endstop
+    // polling and noise filtering. Measure from the step that was latched.
+    latched_z = current_position.z;
+    if (latched && probe_triggered)
+      latched_z += (z_steps - stepper.position(Z_AXIS)) * planner.steps_to_mm[Z_AXIS];
+  #endif
+
   return !probe_triggered;
 }
 
@@ -597,7 +622,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
     // Do a first probe at the fast speed
     const bool probe_fail = probe_down_to_z(z_probe_low_point, fr_mm_s),            // No probe trigger?
-               early_fail = (scheck && current_position.z > -offset.z + clearance); // Probe triggered too high?
+               early_fail = (scheck && probed_z() > -offset.z + clearance);        // Probe triggered too high?
     #if ENABLED(DEBUG_LEVELING_FEATURE)
       if (DEBUGGING(LEVELING) && (probe_fail || early_fail)) {
         DEBUG_ECHOPGM_P(plbl);
@@ -626,7 +651,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s,
                      sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
 
-    const float first_probe_z = current_position.z;
+    const float first_probe_z = probed_z();
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("1st Probe Z:", first_probe_z);
 
@@ -669,7 +694,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
       TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
 
-      const float z = current_position.z;
+      const float z = probed_z();
 
       #if EXTRA_PROBING > 0
         // Insert Z measurement into probes[]. Keep it sorted ascending.
@@ -752,7 +777,7 @@ float Probe::probe_at_point(const float &rx, const float &ry, const ProbePtRaise
   if (DEBUGGING(LEVELING)) {
     DEBUG_ECHOLNPAIR(
       "...(", LOGICAL_X_POSITION(rx), ", ", LOGICAL_Y_POSITION(ry),
-      ", ", raise_after == PROBE_PT_RAISE ? "raise" : raise_after == PROBE_PT_STOW ? "stow" : "none",
+      ", ", raise_after == PROBE_PT_RAISE ? "raise" : raise_after == PROBE_PT_NEAR_RAISE ? "near raise" : raise_after == PROBE_PT_STOW ? "stow" : "none",
       ", ", verbose_level,
       ", ", probe_relative ? "probe" : "nozzle", "_relative)"
     );
@@ -783,6 +808,8 @@ float Probe::probe_at_point(const float &rx, const float &ry, const ProbePtRaise
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
     if (big_raise || raise_after == PROBE_PT_RAISE)
       do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), z_probe_fast_mm_s);
+    else if (raise_after == PROBE_PT_NEAR_RAISE)
+      do_blocking_move_to_z(current_position.z + Z_CLEARANCE_ADJACENT_PROBES, z_probe_fast_mm_s);
     else if (raise_after == PROBE_PT_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
 
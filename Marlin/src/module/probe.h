@@ -34,7 +34,8 @@
     PROBE_PT_NONE,      // No raise or stow after run_z_probe
     PROBE_PT_STOW,      // Do a complete stow after run_z_probe
     PROBE_PT_RAISE,     // Raise to "between" clearance after run_z_probe
-    PROBE_PT_BIG_RAISE  // Raise to big clearance after run_z_probe
+    PROBE_PT_BIG_RAISE, // Raise to big clearance after run_z_probe
+    PROBE_PT_NEAR_RAISE // Raise to "adjacent" clearance, the next point being a grid neighbor
   };
 #endif
 
@@ -257,6 +258,11 @@ public:
   #endif
 
 private:
+  #if ENABLED(PROBE_STEP_LATCH)
+    static float latched_z; // Z at the step where probe_down_to_z saw the probe trigger
+  #endif
+  static inline float probed_z() { return TERN(PROBE_STEP_LATCH, latched_z, current_position.z); }
+
   static bool probe_down_to_z(const float z, const feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
   static float run_z_probe(const bool sanity_check=true);
@@ -529,11 +529,16 @@ void MarlinSettings::postprocess() {
 
 #if BOTH(PRINTCOUNTER, EEPROM_SETTINGS)
   #include "printcounter.h"
+  // With PRINTCOUNTER_RING the old block is only read once, to carry over its counts
   static_assert(
     !WITHIN(STATS_EEPROM_ADDRESS, EEPROM_OFFSET, EEPROM_OFFSET + sizeof(SettingsData)) &&
-    !WITHIN(STATS_EEPROM_ADDRESS + sizeof(printStatistics), EEPROM_OFFSET, EEPROM_OFFSET + sizeof(SettingsData)),
+    !WITHIN(STATS_EEPROM_ADDRESS + TERN(PRINTCOUNTER_HISTOGRAMS, offsetof(printStatistics, hist), sizeof(printStatistics)), EEPROM_OFFSET, EEPROM_OFFSET + sizeof(SettingsData)),
     "STATS_EEPROM_ADDRESS collides with EEPROM settings storage."
   );
+  #if ENABLED(PRINTCOUNTER_RING) && defined(MARLIN_EEPROM_SIZE)
+    static_assert(EEPROM_OFFSET + sizeof(SettingsData) + (STATS_RING_SIZE) <= (MARLIN_EEPROM_SIZE),
+                  "EEPROM settings storage collides with the PRINTCOUNTER_RING statistics.");
+  #endif
 #endif
 
 #if ENABLED(SD_FIRMWARE_UPDATE)
@@ -614,6 +619,15 @@ void MarlinSettings::postprocess() {
 
     EEPROM_START();
 
+    #if BOTH(PRINTCOUNTER, PRINTCOUNTER_RING)
+      // The EEPROM size isn't always known at build time, so don't write over the statistics
+      if (size_t(EEPROM_OFFSET + datasize()) + (STATS_RING_SIZE) > persistentStore.capacity()) {
+        DEBUG_ERROR_MSG("EEPROM settings collide with PRINTCOUNTER_RING.");
+        persistentStore.access_finish();
+        return false;
+      }
+    #endif
+
     eeprom_error = false;
 
     // Write or Skip version. (Flash doesn't allow rewrite without erase.)
@@ -2434,9 +2448,10 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
-    const uint16_t MarlinSettings::meshes_end = persistentStore.capacity() - 129; // 128 (+1 because of the change to capacity rather than last valid address)
-                                                                                  // is a placeholder for the size of the MAT; the MAT will always
-                                                                                  // live at the very end of the eeprom
+    const uint16_t MarlinSettings::meshes_end = persistentStore.capacity() - 129 // 128 (+1 because of the change to capacity rather than last valid address)
+                                                                                 // is a placeholder for the size of the MAT; the MAT will always
+                                                                                 // live at the very end of the eeprom
+                                                - TERN0(PRINTCOUNTER_RING, STATS_RING_SIZE); // PRINTCOUNTER_RING keeps the print statistics past the MAT
 
     uint16_t MarlinSettings::meshes_start_index() {
       return (datasize() + EEPROM_OFFSET + 32) & 0xFFF8;  // Pad the end of configuration data so it can float up
@@ -89,6 +89,9 @@ Stepper stepper; // Singleton
 
 #include "endstops.h"
 #include "planner.h"
+#if ENABLED(PROBE_STEP_LATCH)
+  #include "probe.h"
+#endif
 #include "motion.h"
 
 #include "../lcd/marlinui.h"
@@ -236,6 +239,11 @@ int32_t Stepper::ticks_nominal = -1;
 #endif
 
 xyz_long_t Stepper::endstops_trigsteps;
+
+#if ENABLED(PROBE_STEP_LATCH)
+  volatile Stepper::ProbeLatchState Stepper::probe_latch_state; // = PROBE_LATCH_IDLE
+  int32_t Stepper::probe_latch_z;
+#endif
 xyze_long_t Stepper::count_position{0};
 xyze_int8_t Stepper::count_direction{0};
 
@@ -1356,6 +1364,7 @@ HAL_STEP_TIMER_ISR() {
 #endif
 
 void Stepper::isr() {
+  HAL_PROFILE(STEPPER_ISR);
 
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
@@ -1525,7 +1534,10 @@ void Stepper::pulse_phase_isr() {
   // If we must abort the current block, do so!
   if (abort_current_block) {
     abort_current_block = false;
-    if (current_block) discard_current_block();
+    if (current_block) {
+      TERN_(HAL_STEP_TRACE, HAL_step_trace_aborted(planner.block_buffer_tail));
+      discard_current_block();
+    }
   }
 
   // If there is no current block, do nothing
@@ -1769,10 +1781,20 @@ void Stepper::pulse_phase_isr() {
       #endif
     #endif
 
+    #if ENABLED(PROBE_STEP_LATCH) && DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      // Sample the probe right after stepping so the trigger is known to the exact step.
+      // With endstop interrupts the pin-change handler does the latching instead.
+      if (probe_latch_state) update_probe_latch(PROBE_TRIGGERED());
+    #endif
+
     #if ISR_MULTI_STEPS
       if (events_to_do) START_LOW_PULSE();
     #endif
 
+    #if ENABLED(I2S_STEPPER_STREAM)
+      if (events_to_do > 1) i2s_push_sample(); // A low sample between steps, or they merge into one pulse
+    #endif
+
   } while (--events_to_do);
 }
 
@@ -1998,6 +2020,8 @@ uint32_t Stepper::block_phase_isr() {
           return interval; // No more queued movements!
       }
 
+      TERN_(HAL_STEP_TRACE, HAL_step_trace_started(planner.block_buffer_tail));
+
       // For non-inline cutter, grossly apply power
       #if ENABLED(LASER_FEATURE) && DISABLED(LASER_POWER_INLINE)
         cutter.apply_power(current_block->cutter_power);
@@ -2712,6 +2736,26 @@ int32_t Stepper::triggered_position(const AxisEnum axis) {
   return v;
 }
 
+#if ENABLED(PROBE_STEP_LATCH)
+
+  bool Stepper::probe_latched_position(int32_t &z_steps) {
+    #ifdef __AVR__
+      const bool was_enabled = suspend();
+    #endif
+
+    const bool valid = probe_latch_state == PROBE_LATCH_HELD;
+    z_steps = probe_latch_z;
+    probe_latch_state = PROBE_LATCH_IDLE;
+
+    #ifdef __AVR__
+      if (was_enabled) wake_up();
+    #endif
+
+    return valid;
+  }
+
+#endif
+
 void Stepper::report_a_position(const xyz_long_t &pos) {
   #if ANY(CORE_IS_XY, CORE_IS_XZ, MARKFORGED_XY, DELTA, IS_SCARA)
     SERIAL_ECHOPAIR(STR_COUNT_A, pos.x, " B:", pos.y);
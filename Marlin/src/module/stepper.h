@@ -73,7 +73,9 @@
    * take longer, pulses will be longer. For example the SKR Pro
    * (stm32f407zgt6) requires ~60 cyles.
    */
-  #define TIMER_READ_ADD_AND_STORE_CYCLES 34UL
+  #ifndef TIMER_READ_ADD_AND_STORE_CYCLES
+    #define TIMER_READ_ADD_AND_STORE_CYCLES 34UL
+  #endif
 
   // The base ISR takes 792 cycles
   #define ISR_BASE_CYCLES  792UL
@@ -154,9 +156,15 @@
 // E is always interpolated, even for mixing extruders
 #define ISR_E_STEPPER_CYCLES         ISR_STEPPER_CYCLES
 
+// Mixing steps one E stepper, picked by reading the packed step schedule in get_next_stepper().
+// The read is a few loads and shifts, charged as one more stepper to stay on the safe side.
+#if ENABLED(MIXING_EXTRUDER)
+  #define ISR_MIXING_SCHEDULE_CYCLES ISR_STEPPER_CYCLES
+#endif
+
 // If linear advance is disabled, the loop also handles them
 #if DISABLED(LIN_ADVANCE) && ENABLED(MIXING_EXTRUDER)
-  #define ISR_MIXING_STEPPER_CYCLES ((MIXING_STEPPERS) * (ISR_STEPPER_CYCLES))
+  #define ISR_MIXING_STEPPER_CYCLES ISR_MIXING_SCHEDULE_CYCLES
 #else
   #define ISR_MIXING_STEPPER_CYCLES  0UL
 #endif
@@ -198,13 +206,9 @@
 #if ENABLED(LIN_ADVANCE)
 
   // Estimate the minimum LA loop time
-  #if ENABLED(MIXING_EXTRUDER) // ToDo: ???
-    // HELP ME: What is what?
-    // Directions are set up for MIXING_STEPPERS - like before.
-    // Finding the right stepper may last up to MIXING_STEPPERS loops in get_next_stepper().
-    //   These loops are a bit faster than advancing a bresenham counter.
-    // Always only one e-stepper is stepped.
-    #define MIN_ISR_LA_LOOP_CYCLES ((MIXING_STEPPERS) * (ISR_STEPPER_CYCLES))
+  #if ENABLED(MIXING_EXTRUDER)
+    // One E stepper, plus the schedule read that picks it
+    #define MIN_ISR_LA_LOOP_CYCLES (ISR_STEPPER_CYCLES + ISR_MIXING_SCHEDULE_CYCLES)
   #else
     #define MIN_ISR_LA_LOOP_CYCLES ISR_STEPPER_CYCLES
   #endif
@@ -353,6 +357,12 @@ class Stepper {
     // Exact steps at which an endstop was triggered
     static xyz_long_t endstops_trigsteps;
 
+    #if ENABLED(PROBE_STEP_LATCH)
+      enum ProbeLatchState : uint8_t { PROBE_LATCH_IDLE, PROBE_LATCH_ARMED, PROBE_LATCH_HELD };
+      static volatile ProbeLatchState probe_latch_state;
+      static int32_t probe_latch_z;   // Z stepper position on the step where the probe triggered
+    #endif
+
     // Positions of stepper motors, in step units
     static xyze_long_t count_position;
 
@@ -463,6 +473,29 @@ class Stepper {
     // Triggered position of an axis in steps
     static int32_t triggered_position(const AxisEnum axis);
 
+    #if ENABLED(PROBE_STEP_LATCH)
+      // Latch the Z position on the next probe trigger
+      static inline void arm_probe_latch() { probe_latch_state = PROBE_LATCH_ARMED; }
+
+      // Track the probe state while armed. Called from ISR contexts.
+      // A trigger that goes away while the probing move is still running
+      // was noise, so wait for the next one. Once the move has ended the
+      // trigger was accepted, so the latched step is kept.
+      FORCE_INLINE static void update_probe_latch(const bool triggered) {
+        if (triggered) {
+          if (probe_latch_state == PROBE_LATCH_ARMED) {
+            probe_latch_z = count_position.z;
+            probe_latch_state = PROBE_LATCH_HELD;
+          }
+        }
+        else if (probe_latch_state == PROBE_LATCH_HELD && current_block && !abort_current_block)
+          probe_latch_state = PROBE_LATCH_ARMED;
+      }
+
+      // Get the Z position latched by the last trigger, if any
+      static bool probe_latched_position(int32_t &z_steps);
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       static void set_digipot_value_spi(const int16_t address, const int16_t value);
       static void set_digipot_current(const uint8_t driver, const int16_t current);
@@ -167,6 +167,10 @@
   #include "../feature/filwidth.h"
 #endif
 
+#if ENABLED(PROBE_ANALOG_SCAN)
+  #include "../feature/probe_scan.h"
+#endif
+
 #if HAS_POWER_MONITOR
   #include "../feature/power_monitor.h"
 #endif
@@ -2007,6 +2011,9 @@ void Temperature::init() {
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
     HAL_ANALOG_SELECT(FILWIDTH_PIN);
   #endif
+  #if ENABLED(PROBE_ANALOG_SCAN)
+    HAL_ANALOG_SELECT(PROBE_ANALOG_PIN);
+  #endif
   #if HAS_ADC_BUTTONS
     HAL_ANALOG_SELECT(ADC_KEYPAD_PIN);
   #endif
@@ -2710,6 +2717,7 @@ public:
  *  - Planner clean buffer
  */
 void Temperature::tick() {
+  HAL_PROFILE(TEMP_TICK);
 
   static int8_t temp_count = -1;
   static ADCSensorState adc_sensor_state = StartupDelay;
@@ -2991,12 +2999,19 @@ void Temperature::tick() {
    * On the next pass, the ADC value is read and accumulated.
    *
    * This gives each ADC 0.9765ms to charge up.
+   *
+   * With HAL_ADC_SCAN the HAL samples every input in the background,
+   * so one call goes through all the sensors at once.
    */
   #define ACCUMULATE_ADC(obj) do{ \
     if (!HAL_ADC_READY()) next_sensor_state = adc_sensor_state; \
     else obj.sample(HAL_READ_ADC()); \
   }while(0)
 
+  #if ENABLED(HAL_ADC_SCAN)
+    do {
+  #endif
+
   ADCSensorState next_sensor_state = adc_sensor_state < SensorsReady ? (ADCSensorState)(int(adc_sensor_state) + 1) : StartSampling;
 
   switch (adc_sensor_state) {
@@ -3004,7 +3019,7 @@ void Temperature::tick() {
     case SensorsReady: {
       // All sensors have been read. Stay in this state for a few
       // ISRs to save on calls to temp update/checking code below.
-      constexpr int8_t extra_loops = MIN_ADC_ISR_LOOPS - (int8_t)SensorsReady;
+      constexpr int8_t extra_loops = TERN(HAL_ADC_SCAN, ADC_SCAN_LOOPS - 1, MIN_ADC_ISR_LOOPS - (int8_t)SensorsReady);
       static uint8_t delay_count = 0;
       if (extra_loops > 0) {
         if (delay_count == 0) delay_count = extra_loops;  // Init this delay
@@ -3088,6 +3103,14 @@ void Temperature::tick() {
       break;
     #endif
 
+    #if ENABLED(PROBE_ANALOG_SCAN)
+      case Prepare_PROBE_SCAN: HAL_START_ADC(PROBE_ANALOG_PIN); break;
+      case Measure_PROBE_SCAN:
+        if (!HAL_ADC_READY()) next_sensor_state = adc_sensor_state; // Redo this state
+        else probe_scan.sample(HAL_READ_ADC());
+      break;
+    #endif
+
     #if ENABLED(POWER_MONITOR_CURRENT)
       case Prepare_POWER_MONITOR_CURRENT:
         HAL_START_ADC(POWER_MONITOR_CURRENT_PIN);
@@ -3156,6 +3179,10 @@ void Temperature::tick() {
   // Go to the next state
   adc_sensor_state = next_sensor_state;
 
+  #if ENABLED(HAL_ADC_SCAN)
+    } while (adc_sensor_state > StartSampling && adc_sensor_state < SensorsReady);
+  #endif
+
   //
   // Additional ~1KHz Tasks
   //
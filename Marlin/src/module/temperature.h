@@ -135,6 +135,9 @@ enum ADCSensorState : char {
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
     Prepare_FILWIDTH, Measure_FILWIDTH,
   #endif
+  #if ENABLED(PROBE_ANALOG_SCAN)
+    Prepare_PROBE_SCAN, Measure_PROBE_SCAN,
+  #endif
   #if ENABLED(POWER_MONITOR_CURRENT)
     Prepare_POWER_MONITOR_CURRENT,
     Measure_POWER_MONITOR_CURRENT,
@@ -155,7 +158,12 @@ enum ADCSensorState : char {
 // get all oversampled sensor readings
 #define MIN_ADC_ISR_LOOPS 10
 
-#define ACTUAL_ADC_SAMPLES _MAX(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
+#if ENABLED(HAL_ADC_SCAN)
+  // All sensors are read in one loop, once every ADC_SCAN_LOOPS loops
+  #define ACTUAL_ADC_SAMPLES (ADC_SCAN_LOOPS)
+#else
+  #define ACTUAL_ADC_SAMPLES _MAX(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
+#endif
 
 #if HAS_PID_HEATING
   #define PID_K2 (1-float(PID_K1))
@@ -213,6 +213,10 @@
   #define FILWIDTH_PIN                         5  // Analog Input on AUX2
 #endif
 
+#ifndef PROBE_ANALOG_PIN
+  #define PROBE_ANALOG_PIN                     6  // Analog Input for the simulated height sensor
+#endif
+
 // define digital pin 4 for the filament runout sensor. Use the RAMPS 1.4 digital input 4 on the servos connector
 #ifndef FIL_RUNOUT_PIN
   #define FIL_RUNOUT_PIN                       4
@@ -50,6 +50,9 @@
 #if PIN_EXISTS(FILWIDTH) && ANALOG_OK(FILWIDTH_PIN)
   REPORT_NAME_ANALOG(__LINE__, FILWIDTH_PIN)
 #endif
+#if PIN_EXISTS(PROBE_ANALOG) && ANALOG_OK(PROBE_ANALOG_PIN)
+  REPORT_NAME_ANALOG(__LINE__, PROBE_ANALOG_PIN)
+#endif
 #if PIN_EXISTS(MAIN_VOLTAGE_MEASURE) && ANALOG_OK(MAIN_VOLTAGE_MEASURE_PIN)
   REPORT_NAME_ANALOG(__LINE__, MAIN_VOLTAGE_MEASURE_PIN)
 #endif
@@ -132,6 +132,11 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(GCODE_HEATSHRINK)
+  GcodeInflater CardReader::inflater;
+  uint32_t CardReader::inflate_pos;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -193,6 +198,9 @@ bool CardReader::is_dir_or_gcode(const dir_t &p) {
   return (
     flag.filenameIsDir                                  // All Directories are ok
     || (p.name[8] == 'G' && p.name[9] != '~')           // Non-backup *.G* files are accepted
+    #if ENABLED(GCODE_HEATSHRINK)
+      || (p.name[8] == 'H' && p.name[9] == 'S')         // Compressed *.HS files are accepted
+    #endif
   );
 }
 
@@ -512,6 +520,10 @@ void CardReader::endFilePrint(TERN_(SD_RESORT, const bool re_sort/*=false*/)) {
   TERN_(DWIN_CREALITY_LCD, HMI_flag.print_finish = flag.sdprinting);
   flag.sdprinting = flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  TERN_(SD_LAYER_INDEX, layer_index.close());
+  TERN_(PRINT_TIME_ESTIMATOR, time_estimator.close());
+  TERN_(TOOLCHANGE_PREHEAT, toolchange_preheat.close());
+  TERN_(HAS_SD_LOOKAHEAD, sd_lookahead.close());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -614,6 +626,18 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
     filesize = file.fileSize();
     sdpos = 0;
 
+    #if ENABLED(GCODE_HEATSHRINK)
+      const char * const ext = strrchr(fname, '.');
+      flag.inflating = ext && !strcasecmp_P(ext, PSTR(".HS"));
+      if (flag.inflating) rewind_inflated();
+    #endif
+
+    // A new print gets the layer index of its file
+    TERN_(SD_LAYER_INDEX, if (subcall_type == 0) layer_index.open(diveDir, fname, file));
+    TERN_(PRINT_TIME_ESTIMATOR, if (subcall_type == 0) time_estimator.open(filesize));
+    TERN_(TOOLCHANGE_PREHEAT, if (subcall_type == 0) toolchange_preheat.open());
+    TERN_(HAS_SD_LOOKAHEAD, if (subcall_type == 0) sd_lookahead.open(diveDir, fname));
+
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SERIAL_ALL);
       SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -712,9 +736,59 @@ void CardReader::removeFile(const char * const name) {
   #endif
 }
 
+#if ENABLED(GCODE_HEATSHRINK)
+
+  //
+  // Get the next decoded byte of a compressed file,
+  // reading the file in pieces the decoder can take
+  //
+  int16_t CardReader::get_inflated() {
+    while (!inflater.has_output()) {
+      inflate_pos = file.curPosition();
+      uint8_t buf[GcodeInflater::sink_size];
+      const int16_t count = file.read(buf, sizeof(buf));
+      if (count <= 0) return -1;
+      inflater.sink(buf, count);
+    }
+    sdpos++;
+    return inflater.read();
+  }
+
+  void CardReader::rewind_inflated() {
+    file.seekSet((sdpos = inflate_pos = 0));
+    inflater.reset();
+  }
+
+  //
+  // A compressed file can't seek, so decode up to the index,
+  // starting over from the top when going backward
+  //
+  void CardReader::setIndex(const uint32_t index) {
+    if (!flag.inflating) { file.seekSet((sdpos = index)); return; }
+    if (index < sdpos) rewind_inflated();
+    while (sdpos < index && get_inflated() >= 0)
+      if (!(sdpos & 0x3FFF)) watchdog_refresh();
+  }
+
+  //
+  // Decode up to the point where the decoder runs dry at or past
+  // the file position, so a position from M27 resumes exactly
+  //
+  void CardReader::setFileIndex(const uint32_t index) {
+    if (!flag.inflating) { setIndex(index); return; }
+    if (index < inflate_pos || (index == inflate_pos && index < file.curPosition())) rewind_inflated();
+    while (inflater.has_output() || file.curPosition() < index) {
+      if (get_inflated() < 0) break;
+      if (!(sdpos & 0x3FFF)) watchdog_refresh();
+    }
+    inflate_pos = file.curPosition();
+  }
+
+#endif
+
 void CardReader::report_status() {
   if (isPrinting()) {
-    SERIAL_ECHOPAIR(STR_SD_PRINTING_BYTE, sdpos);
+    SERIAL_ECHOPAIR(STR_SD_PRINTING_BYTE, getFileIndex());
     SERIAL_CHAR('/');
     SERIAL_ECHOLN(filesize);
   }
@@ -56,6 +56,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(GCODE_HEATSHRINK)
+         , inflating:1
+       #endif
     ;
 } card_flags_t;
 
@@ -63,6 +66,26 @@ typedef struct {
   #include "../libs/autoreport.h"
 #endif
 
+#if ENABLED(GCODE_HEATSHRINK)
+  #include "../feature/heatshrink_gcode.h"
+#endif
+
+#if ENABLED(SD_LAYER_INDEX)
+  #include "../feature/layer_index.h"
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "../feature/time_estimator.h"
+#endif
+
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #include "../feature/toolchange_preheat.h"
+#endif
+
+#if HAS_SD_LOOKAHEAD
+  #include "../feature/sd_lookahead.h"
+#endif
+
 class CardReader {
 public:
   static card_flags_t flag;                         // Flags (above)
@@ -137,10 +160,19 @@ public:
   static inline void pauseSDPrint() { flag.sdprinting = false; }
   static inline bool isPaused() { return isFileOpen() && !flag.sdprinting; }
   static inline bool isPrinting() { return flag.sdprinting; }
+  // With a layer index, progress follows the estimated print time
   #if HAS_PRINT_PROGRESS_PERMYRIAD
-    static inline uint16_t permyriadDone() { return (isFileOpen() && filesize) ? sdpos / ((filesize + 9999) / 10000) : 0; }
+    static inline uint16_t permyriadDone() {
+      if (!isFileOpen() || !filesize) return 0;
+      TERN_(SD_LAYER_INDEX, if (layer_index.loaded()) return layer_index.permyriad(sdpos));
+      return filePos() / ((filesize + 9999) / 10000);
+    }
   #endif
-  static inline uint8_t percentDone() { return (isFileOpen() && filesize) ? sdpos / ((filesize + 99) / 100) : 0; }
+  static inline uint8_t percentDone() {
+    if (!isFileOpen() || !filesize) return 0;
+    TERN_(SD_LAYER_INDEX, if (layer_index.loaded()) return layer_index.permyriad(sdpos) / 100);
+    return filePos() / ((filesize + 99) / 100);
+  }
 
   // Helper for open and remove
   static const char* diveToFile(const bool update_cwd, SdFile*& curDir, const char * const path, const bool echo=false);
@@ -166,10 +198,25 @@ public:
   static inline bool isFileOpen() { return isMounted() && file.isOpen(); }
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
-  static inline bool eof() { return sdpos >= filesize; }
-  static inline void setIndex(const uint32_t index) { file.seekSet((sdpos = index)); }
+  #if ENABLED(GCODE_HEATSHRINK)
+    // Compressed files are indexed by their decoded bytes
+    static inline bool eof() { return flag.inflating ? (filePos() >= filesize && !inflater.has_output()) : sdpos >= filesize; }
+    static void setIndex(const uint32_t index);
+    static inline int16_t get() {
+      if (flag.inflating) return get_inflated();
+      int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out;
+    }
+    // M26 and M27 use the position in the compressed file where all prior bytes were decoded
+    static inline uint32_t getFileIndex() { return flag.inflating ? inflate_pos : sdpos; }
+    static void setFileIndex(const uint32_t index);
+  #else
+    static inline bool eof() { return sdpos >= filesize; }
+    static inline void setIndex(const uint32_t index) { file.seekSet((sdpos = index)); }
+    static inline int16_t get() { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+    static inline uint32_t getFileIndex() { return sdpos; }
+    static inline void setFileIndex(const uint32_t index) { setIndex(index); }
+  #endif
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
   static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
   static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
 
@@ -253,6 +300,16 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  // Position in the file itself, for progress through compressed files
+  static inline uint32_t filePos() { return TERN(GCODE_HEATSHRINK, flag.inflating ? file.curPosition() : sdpos, sdpos); }
+
+  #if ENABLED(GCODE_HEATSHRINK)
+    static GcodeInflater inflater;
+    static uint32_t inflate_pos;  // File position where the decoder last ran dry
+    static int16_t get_inflated();
+    static void rewind_inflated();
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+Convert a binary GPIO trace from the LINUX simulator to CSV or VCD.
+
+Build the simulator with GPIO_LOGGING (HAL/LINUX/main.cpp) to record
+all_gpio_log.bin, then for example:
+
+  gpio_trace.py all_gpio_log.bin -o gpio.csv
+  gpio_trace.py all_gpio_log.bin -o gpio.vcd --pins 54,55,38
+
+read_trace() can also be imported by other analysis scripts.
+"""
+
+from __future__ import print_function
+
+import argparse
+import struct
+import sys
+
+# GpioEvent::Type
+NOP, FALL, RISE, SET_VALUE, SETM, SETD, MARK = range(7)
+EVENT_NAMES = ('NOP', 'FALL', 'RISE', 'SET_VALUE', 'SETM', 'SETD', 'MARK')
+
+HEADER = struct.Struct('<4sHHQQ')
+
+def _varint(data, pos):
+    value = shift = 0
+    while True:
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if b < 0x80:
+            return value, pos
+        shift += 7
+
+def read_trace(path):
+    """ Return the list of (timestamp_ns, pin, event, value) in time order, and the dropped event count. """
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    magic, version, streams, used, dropped = HEADER.unpack_from(data, 0)
+    if magic != b'MGPT' or version != 1:
+        raise ValueError('%s is not a version 1 GPIO trace' % path)
+
+    last = [0] * streams
+    events = []
+    pos, end = HEADER.size, min(used, len(data))
+    while pos < end:
+        tag = data[pos]
+        pos += 1
+        event, stream = tag & 0x07, tag >> 4
+        delta, pos = _varint(data, pos)
+        last[stream] += (delta >> 1) ^ -(delta & 1)
+        pin, pos = _varint(data, pos)
+        if tag & 0x08:
+            value, pos = _varint(data, pos)
+        else:
+            value = 1 if event == RISE else 0
+        events.append((last[stream], pin, event, value))
+
+    # Streams are stored one after another, so merge them by time
+    events.sort(key=lambda e: e[0])
+    return events, dropped
+
+def write_csv(events, out):
+    out.write('timestamp, pin, event, value\n')
+    for ts, pin, event, value in events:
+        out.write('%d, %d, %s, %d\n' % (ts, pin, EVENT_NAMES[event], value))
+
+def write_vcd(events, out):
+    # Only pin values are signals; mode and direction changes and markers are skipped
+    events = [e for e in events if e[2] in (FALL, RISE, SET_VALUE)]
+    width = {}
+    for _, pin, event, value in events:
+        width[pin] = max(width.get(pin, 1), value.bit_length())
+
+    def ident(pin):
+        s, n = '', pin
+        while True:
+            s += chr(33 + n % 94)
+            n //= 94
+            if not n: return s
+
+    def change(pin, value):
+        if width[pin] == 1: return '%d%s\n' % (value, ident(pin))
+        return 'b%s %s\n' % (format(value, 'b'), ident(pin))
+
+    out.write('$timescale 1ns $end\n$scope module marlin $end\n')
+    for pin in sorted(width):
+        out.write('$var wire %d %s pin%d $end\n' % (width[pin], ident(pin), pin))
+    out.write('$upscope $end\n$enddefinitions $end\n')
+
+    now = None
+    for ts, pin, _, value in events:
+        if ts != now:
+            out.write('#%d\n' % ts)
+            now = ts
+        out.write(change(pin, value))
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('trace', help='binary trace file, e.g. all_gpio_log.bin')
+    parser.add_argument('-o', '--output', help='output file, .csv or .vcd (default: CSV to stdout)')
+    parser.add_argument('--pins', help='comma-separated list of pins to keep')
+    args = parser.parse_args()
+
+    events, dropped = read_trace(args.trace)
+    if dropped:
+        print('warning: %d events were dropped while recording' % dropped, file=sys.stderr)
+    if args.pins:
+        keep = set(int(p) for p in args.pins.split(','))
+        events = [e for e in events if e[1] in keep]
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    if args.output and args.output.lower().endswith('.vcd'):
+        write_vcd(events, out)
+    else:
+        write_csv(events, out)
+    if args.output: out.close()
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+"""
+Check the step pulses recorded by the LINUX simulator against the planner.
+
+Build the simulator with GPIO_LOGGING (HAL/LINUX/main.cpp) and
+HAL_STEP_TRACE (HAL/LINUX/HAL.h), run a job, then:
+
+  step_trace_check.py all_gpio_log.bin planner_block_log.csv
+
+The trace marks where the stepper picks up each planner block, and where
+it cuts one short (endstop hit, quick stop), so the pulses on each axis
+are split per block. Per-axis velocity and
+acceleration are reconstructed over a sliding window of steps and checked
+against the block's nominal speed, acceleration and junction (jerk or
+junction deviation) limit, and against the machine's max feedrate, max
+acceleration, step rate ceiling and minimum pulse width. Each block is
+also checked for the right step counts and step directions.
+
+The simulator's timers jitter, so limits are checked with a tolerance
+(--tolerance) over a window of steps (--window). Exits with status 1 if
+any check fails.
+"""
+
+from __future__ import print_function
+
+import argparse
+import bisect
+import math
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gpio_trace import read_trace, FALL, RISE, SET_VALUE, MARK
+
+AXES = 'XYZE'  # Stepper labels, unless the block log names them (A/B/C on Core machines)
+MINIMAL_STEP_RATE = 120  # Planner floor for initial and final rates, in steps/s
+
+class Block(object):
+    def __init__(self, fields, settings):
+        self.index = int(fields[0])
+        self.steps = [int(f) for f in fields[1:5]]
+        self.direction_bits = int(fields[5])
+        self.step_event_count = int(fields[6])
+        self.extruder = int(fields[7])
+        self.millimeters, self.nominal_speed, self.acceleration, self.max_entry_speed = (float(f) for f in fields[8:12])
+        self.settings = settings
+        self.number = 0  # Position in the log, for reports
+
+def to_number(value):
+    try:
+        return float(value)
+    except ValueError:
+        return value
+
+def read_block_log(path):
+    settings, blocks = {}, []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line: continue
+            if line.startswith('#'):
+                key, _, values = line[1:].partition(':')
+                values = [to_number(v.strip()) for v in values.split(',')]
+                settings = dict(settings)
+                settings[key.strip()] = values if len(values) > 1 else values[0]
+                continue
+            block = Block([f.strip() for f in line.split(',')], settings)
+            block.number = len(blocks)
+            blocks.append(block)
+    return blocks
+
+class Report(object):
+    def __init__(self, limit):
+        self.checks = {}
+        self.limit = limit
+
+    def fail(self, check, ratio, where):
+        count, worst, examples = self.checks.get(check, (0, 0, []))
+        if len(examples) < self.limit: examples.append(where)
+        self.checks[check] = (count + 1, max(worst, ratio), examples)
+
+    def show(self):
+        if not self.checks:
+            print('All checks passed.')
+            return 0
+        for check in sorted(self.checks):
+            count, worst, examples = self.checks[check]
+            print('%s: %d violation(s)%s' % (check, count, ', worst %.2fx the limit' % worst if worst else ''))
+            for e in examples: print('    ' + e)
+        return 1
+
+def level_at(changes, ts):
+    """ Value of a pin at time ts, given its sorted [(ts, value)] changes """
+    i = bisect.bisect_right(changes, (ts, float('inf'))) - 1
+    return changes[i][1] if i >= 0 else 0
+
+def windowed_rates(times, window):
+    """ Step rates (steps/s) over each run of 'window' steps, with the time at the middle of the run """
+    return [(0.5 * (times[i] + times[i + window]), window * 1e9 / (times[i + window] - times[i]))
+            for i in range(len(times) - window) if times[i + window] > times[i]]
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('trace', help='binary GPIO trace, e.g. all_gpio_log.bin')
+    parser.add_argument('blocks', help='planner block log, e.g. planner_block_log.csv')
+    parser.add_argument('-w', '--window', type=int, default=32, help='steps per velocity sample (default 32)')
+    parser.add_argument('-t', '--tolerance', type=float, default=0.1, help='allowed excess over a limit (default 0.1 = 10%%)')
+    parser.add_argument('--max-jerk', type=float, help='also check the rate of change of acceleration, in mm/s^3')
+    parser.add_argument('--examples', type=int, default=3, help='examples to show per check (default 3)')
+    args = parser.parse_args()
+
+    events, dropped = read_trace(args.trace)
+    if dropped:
+        print('warning: %d events were dropped while recording, expect step count errors' % dropped)
+    blocks = read_block_log(args.blocks)
+    if not blocks:
+        print('No blocks in %s' % args.blocks)
+        return 1
+
+    last = blocks[-1].settings
+    step_pins = [int(p) for p in last['step_pins']]
+    dir_pins = [int(p) for p in last['dir_pins']]
+    axes = last.get('steppers', list(AXES))
+    # The simulator's timed pulses may end up to one pulse timer tick early
+    min_pulse = last.get('min_pulse_ns', 0) - last.get('pulse_tick_ns', 0)
+    max_rate = last.get('max_step_rate', 0)
+    lin_advance = bool(last.get('lin_advance', 0))
+    tol = 1 + args.tolerance
+
+    # Split the trace into markers and per-pin edges
+    markers, aborts, rises, falls, levels = [], [], {p: [] for p in step_pins}, {p: [] for p in step_pins}, {p: [] for p in dir_pins}
+    for ts, pin, event, value in events:
+        if event == MARK:
+            if value & 0x100:
+                aborts.append((ts, value & 0xFF))
+            else:
+                markers.append((ts, value))
+        elif pin in rises and event == RISE:
+            rises[pin].append(ts)
+        elif pin in falls and event == FALL:
+            falls[pin].append(ts)
+        if pin in levels and event in (FALL, RISE, SET_VALUE):
+            levels[pin].append((ts, value))
+
+    report = Report(args.examples)
+
+    # Pulse width and step rate ceiling, over the whole trace
+    for a, pin in enumerate(step_pins):
+        fl = falls[pin]
+        for ts in rises[pin]:
+            i = bisect.bisect_left(fl, ts)
+            if i < len(fl) and fl[i] - ts < min_pulse:
+                report.fail('pulse width', min_pulse / max(fl[i] - ts, 1), '%s pulse at %d ns: %d ns high' % (axes[a], ts, fl[i] - ts))
+        if max_rate:
+            for t0, t1 in zip(rises[pin], rises[pin][1:]):
+                if t1 > t0 and 1e9 / (t1 - t0) > max_rate * tol:
+                    report.fail('step rate', 1e9 / (t1 - t0) / max_rate, '%s steps at %d ns: %.0f steps/s' % (axes[a], t1, 1e9 / (t1 - t0)))
+
+    # Pair each marker with its block. Blocks the stepper never picked up (e.g., after a quick stop) are skipped.
+    segments, b, cut = [], 0, 0
+    for k, (ts, index) in enumerate(markers):
+        while b < len(blocks) and blocks[b].index != index: b += 1
+        if b == len(blocks):
+            print('warning: the trace has more blocks than the log, stopping at %d ns' % ts)
+            break
+        end = markers[k + 1][0] if k + 1 < len(markers) else float('inf')
+        # A block cut short ends at the abort marker and steps less than planned
+        while cut < len(aborts) and aborts[cut][0] < ts: cut += 1
+        aborted = cut < len(aborts) and aborts[cut][0] < end and aborts[cut][1] == index
+        if aborted: end = aborts[cut][0]
+        segments.append((blocks[b], ts, end, aborted))
+        b += 1
+    print('%d blocks planned, %d executed, %d cut short' % (len(blocks), len(segments), sum(1 for s in segments if s[3])))
+
+    for block, start, end, aborted in segments:
+        s = block.settings
+        where = 'block %d (at %d ns)' % (block.number, start)
+        mm = block.millimeters
+
+        # What the planner asked for must itself respect the machine limits
+        for a in range(4):
+            if not block.steps[a] or not mm: continue
+            share = block.steps[a] / s['steps_per_mm'][a] / mm
+            if block.nominal_speed * share > s['max_feedrate'][a] * tol:
+                report.fail('planned %s feedrate' % axes[a], block.nominal_speed * share / s['max_feedrate'][a], where)
+            if block.acceleration * share > s['max_acceleration'][a] * tol:
+                report.fail('planned %s acceleration' % axes[a], block.acceleration * share / s['max_acceleration'][a], where)
+
+        dominant = max(range(4), key=lambda a: block.steps[a])
+        for a, pin in enumerate(step_pins):
+            lo, hi = bisect.bisect_left(rises[pin], start), bisect.bisect_left(rises[pin], end)
+            times = rises[pin][lo:hi]
+
+            # With linear advance the E axis takes extra steps outside the block's count
+            if not (lin_advance and a == 3) and end != float('inf') and (len(times) > block.steps[a] if aborted else len(times) != block.steps[a]):
+                report.fail('step count', 0, '%s: %s took %d steps, planned %d' % (where, axes[a], len(times), block.steps[a]))
+
+            expected = int(s['invert_dir'][a]) if block.direction_bits >> a & 1 else 1 - int(s['invert_dir'][a])
+            wrong = sum(1 for ts in times if level_at(levels[dir_pins[a]], ts) != expected)
+            if wrong and not (lin_advance and a == 3):
+                report.fail('direction', 0, '%s: %d %s step(s) the wrong way' % (where, wrong, axes[a]))
+
+            rates = windowed_rates(times, args.window)
+            if not rates: continue
+
+            # Axis speed against the machine limit
+            spm = s['steps_per_mm'][a]
+            top = max(r for _, r in rates) / spm
+            if top > s['max_feedrate'][a] * tol and top * spm > MINIMAL_STEP_RATE:
+                report.fail('%s feedrate' % axes[a], top / s['max_feedrate'][a], '%s: %.1f mm/s' % (where, top))
+
+            if a != dominant or not block.step_event_count: continue
+
+            # Speed along the path, from the axis that steps on every step event
+            scale = mm / block.step_event_count
+            speeds = [(t, r * scale) for t, r in rates]
+            floor = MINIMAL_STEP_RATE * scale
+            top = max(v for _, v in speeds)
+            if top > block.nominal_speed * tol and top > floor:
+                report.fail('nominal speed', top / block.nominal_speed, '%s: %.1f mm/s for %.1f' % (where, top, block.nominal_speed))
+
+            # Entry speed against the junction limit, allowing for the speed gained within the first window
+            gain = 2 * block.acceleration * args.window * scale
+            entry_limit = math.sqrt(block.max_entry_speed ** 2 + gain)
+            if speeds[0][1] > entry_limit * tol and speeds[0][1] > floor:
+                report.fail('junction speed', speeds[0][1] / entry_limit, '%s: entered at %.1f mm/s, limit %.1f' % (where, speeds[0][1], block.max_entry_speed))
+
+            # Acceleration between samples a full window apart
+            samples = speeds[::args.window]
+            accels = [((t0 + t1) / 2, (v1 - v0) * 1e9 / (t1 - t0)) for (t0, v0), (t1, v1) in zip(samples, samples[1:]) if t1 > t0]
+            if accels:
+                worst = max(abs(acc) for _, acc in accels)
+                if worst > block.acceleration * tol:
+                    report.fail('acceleration', worst / max(block.acceleration, 1e-6), '%s: %.0f mm/s^2 for %.0f' % (where, worst, block.acceleration))
+            if args.max_jerk and len(accels) > 1:
+                worst = max(abs(a1 - a0) * 1e9 / (t1 - t0) for (t0, a0), (t1, a1) in zip(accels, accels[1:]) if t1 > t0)
+                if worst > args.max_jerk * tol:
+                    report.fail('jerk', worst / args.max_jerk, '%s: %.0f mm/s^3' % (where, worst))
+
+    return report.show()
+
+if __name__ == '__main__':
+    sys.exit(main())